@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Batch of symmetric positive definite n x n matrices.
+static Tensor RandomSPDMatrices(int64_t batch, int64_t n) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<float> values(batch * n * n);
+    for (auto& v : values) {
+        v = dist(rng);
+    }
+    Tensor A(values, {batch, n, n}, Dtype::Float32);
+    Tensor AAT;
+    BatchedMatmul(A, A.Transpose(1, 2), AAT);
+    return AAT.Add(Tensor::Eye(n, Dtype::Float32, Device("CPU:0")));
+}
+
+void SolveLoop(benchmark::State& state, int64_t n) {
+    const int64_t batch = state.range(0);
+    Tensor A = RandomSPDMatrices(batch, n);
+    Tensor B = Tensor::Ones({batch, n}, Dtype::Float32);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch; ++i) {
+            A[i].Solve(B[i]);
+        }
+    }
+}
+
+void BatchedSolve(benchmark::State& state, int64_t n) {
+    const int64_t batch = state.range(0);
+    Tensor A = RandomSPDMatrices(batch, n);
+    Tensor B = Tensor::Ones({batch, n}, Dtype::Float32);
+    Tensor X;
+    for (auto _ : state) {
+        BatchedSolve(A, B, X);
+    }
+}
+
+void SVDLoop(benchmark::State& state, int64_t n) {
+    const int64_t batch = state.range(0);
+    Tensor A = RandomSPDMatrices(batch, n);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch; ++i) {
+            A[i].SVD();
+        }
+    }
+}
+
+void BatchedSVD(benchmark::State& state, int64_t n) {
+    const int64_t batch = state.range(0);
+    Tensor A = RandomSPDMatrices(batch, n);
+    Tensor U, S, VT;
+    for (auto _ : state) {
+        BatchedSVD(A, U, S, VT);
+    }
+}
+
+void BatchedSymmetricEigen(benchmark::State& state, int64_t n) {
+    const int64_t batch = state.range(0);
+    Tensor A = RandomSPDMatrices(batch, n);
+    Tensor eigenvalues, eigenvectors;
+    for (auto _ : state) {
+        BatchedSymmetricEigen(A, eigenvalues, eigenvectors);
+    }
+}
+
+#define ENUM_BM_SIZE(FN)                                \
+    BENCHMARK_CAPTURE(FN, 3x3, 3)                       \
+            ->Arg(10000)                                \
+            ->Unit(benchmark::kMillisecond);            \
+    BENCHMARK_CAPTURE(FN, 6x6, 6)                       \
+            ->Arg(10000)                                \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_SIZE(SolveLoop)
+ENUM_BM_SIZE(BatchedSolve)
+ENUM_BM_SIZE(SVDLoop)
+ENUM_BM_SIZE(BatchedSVD)
+ENUM_BM_SIZE(BatchedSymmetricEigen)
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/hashmap/Hashmap.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Random int3 voxel coordinates, with about half of them duplicated.
+static Tensor RandomVoxelKeys(int64_t n, const Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(-64, 63);
+    std::vector<int> keys(n * 3);
+    for (auto& k : keys) {
+        k = dist(rng);
+    }
+    return Tensor(keys, {n, 3}, Dtype::Int32, device);
+}
+
+void HashmapInsert(benchmark::State& state,
+                   const Device& device,
+                   const HashmapBackend& backend) {
+    int64_t n = state.range(0);
+    Tensor keys = RandomVoxelKeys(n, device);
+    Tensor values = Tensor::Zeros({n}, Dtype::Int32, device);
+    for (auto _ : state) {
+        Hashmap hashmap(n, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                        backend);
+        Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+}
+
+void HashmapFind(benchmark::State& state,
+                 const Device& device,
+                 const HashmapBackend& backend) {
+    int64_t n = state.range(0);
+    Tensor keys = RandomVoxelKeys(n, device);
+    Tensor values = Tensor::Zeros({n}, Dtype::Int32, device);
+    Hashmap hashmap(n, Dtype::Int32, Dtype::Int32, {3}, {1}, device, backend);
+    Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+}
+
+void HashmapEraseAndCollect(benchmark::State& state,
+                            const Device& device,
+                            const HashmapBackend& backend) {
+    int64_t n = state.range(0);
+    Tensor keys = RandomVoxelKeys(n, device);
+    Tensor values = Tensor::Zeros({n}, Dtype::Int32, device);
+    Tensor erase_keys = keys.Slice(0, 0, n / 2);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(n, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                        backend);
+        Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        state.ResumeTiming();
+
+        hashmap.Erase(erase_keys, masks);
+        Tensor active_addrs;
+        hashmap.GetActiveIndices(active_addrs);
+    }
+}
+
+#define ENUM_BM_BACKEND(FN)                                             \
+    BENCHMARK_CAPTURE(FN, TBB, Device("CPU:0"), HashmapBackend::TBB)    \
+            ->Arg(100000)                                               \
+            ->Arg(1000000)                                              \
+            ->Unit(benchmark::kMillisecond);                            \
+    BENCHMARK_CAPTURE(FN, LinearProbing, Device("CPU:0"),               \
+                      HashmapBackend::LinearProbing)                    \
+            ->Arg(100000)                                               \
+            ->Arg(1000000)                                              \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_BACKEND(HashmapInsert)
+ENUM_BM_BACKEND(HashmapFind)
+ENUM_BM_BACKEND(HashmapEraseAndCollect)
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(HashmapInsert, Slab, Device("CUDA:0"), HashmapBackend::Slab)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashmapFind, Slab, Device("CUDA:0"), HashmapBackend::Slab)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/HNSWIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+
+/// Uniformly distributed points in the unit cube.
+static Tensor RandomPoints(int64_t n, const Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0, 1);
+    std::vector<float> points(n * 3);
+    for (auto& p : points) {
+        p = dist(rng);
+    }
+    return Tensor(points, {n, 3}, Dtype::Float32, device);
+}
+
+/// Radius with about 32 neighbors per point.
+static double RadiusForNeighbors(int64_t n) {
+    return std::cbrt(32.0 / n * 3.0 / (4.0 * M_PI));
+}
+
+void FixedRadiusSearch(benchmark::State& state,
+                       const Device& device,
+                       bool spatial_hash) {
+    int64_t n = state.range(0);
+    Tensor points = RandomPoints(n, device);
+    double radius = RadiusForNeighbors(n);
+    nns::NearestNeighborSearch nns(points);
+    if (spatial_hash) {
+        nns.FixedRadiusIndex(radius);
+    } else {
+        nns.FixedRadiusIndex();
+    }
+    for (auto _ : state) {
+        nns.FixedRadiusSearch(points, radius);
+    }
+}
+
+void FixedRadiusIndex(benchmark::State& state,
+                      const Device& device,
+                      bool spatial_hash) {
+    int64_t n = state.range(0);
+    Tensor points = RandomPoints(n, device);
+    double radius = RadiusForNeighbors(n);
+    for (auto _ : state) {
+        nns::NearestNeighborSearch nns(points);
+        if (spatial_hash) {
+            nns.FixedRadiusIndex(radius);
+        } else {
+            nns.FixedRadiusIndex();
+        }
+    }
+}
+
+void KnnSearch(benchmark::State& state,
+               const Device& device,
+               bool preallocated) {
+    int64_t n = state.range(0);
+    const int knn = 16;
+    Tensor points = RandomPoints(n, device);
+    nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    Tensor indices, distances;
+    for (auto _ : state) {
+        if (preallocated) {
+            nns.KnnSearch(points, knn, indices, distances);
+        } else {
+            std::tie(indices, distances) = nns.KnnSearch(points, knn);
+        }
+    }
+}
+
+/// Uniformly distributed 33 dimensional features, like FPFH.
+static Tensor RandomFeatures(int64_t n) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0, 1);
+    std::vector<float> features(n * 33);
+    for (auto& f : features) {
+        f = dist(rng);
+    }
+    return Tensor(features, {n, 33}, Dtype::Float32);
+}
+
+void FeatureIndex(benchmark::State& state, bool approximate) {
+    Tensor features = RandomFeatures(state.range(0));
+    for (auto _ : state) {
+        if (approximate) {
+            nns::HNSWIndex index(features);
+        } else {
+            nns::NanoFlannIndex index(features);
+        }
+    }
+}
+
+void FeatureSearch(benchmark::State& state, bool approximate) {
+    Tensor features = RandomFeatures(state.range(0));
+    Tensor queries = RandomFeatures(1000);
+    std::unique_ptr<nns::NNSIndex> index;
+    if (approximate) {
+        index.reset(new nns::HNSWIndex(features));
+    } else {
+        index.reset(new nns::NanoFlannIndex(features));
+    }
+    for (auto _ : state) {
+        index->SearchKnn(queries, 1);
+    }
+}
+
+#define ENUM_BM_INDEX(FN)                                           \
+    BENCHMARK_CAPTURE(FN, KDTree, Device("CPU:0"), false)           \
+            ->Arg(100000)                                           \
+            ->Arg(1000000)                                          \
+            ->Unit(benchmark::kMillisecond);                        \
+    BENCHMARK_CAPTURE(FN, SpatialHash, Device("CPU:0"), true)       \
+            ->Arg(100000)                                           \
+            ->Arg(1000000)                                          \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_INDEX(FixedRadiusIndex)
+ENUM_BM_INDEX(FixedRadiusSearch)
+
+BENCHMARK_CAPTURE(KnnSearch, Allocating, Device("CPU:0"), false)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(KnnSearch, Preallocated, Device("CPU:0"), true)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(FeatureIndex, KDTree, false)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FeatureIndex, HNSW, true)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FeatureSearch, KDTree, false)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FeatureSearch, HNSW, true)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
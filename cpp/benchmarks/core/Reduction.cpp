@@ -26,6 +26,13 @@
 
 #include <benchmark/benchmark.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <string>
+#include <vector>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -55,5 +62,102 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class ReductionBenchmarkOp { Sum, Max };
+
+/// Reduces a tensor of \p shape over \p dims with \p num_threads OpenMP
+/// threads (0 for the default number of threads).
+void ReductionMatrix(benchmark::State& state,
+                     const Device& device,
+                     const SizeVector& shape,
+                     const SizeVector& dims,
+                     const Dtype& dtype,
+                     ReductionBenchmarkOp op,
+                     int num_threads) {
+#ifdef _OPENMP
+    int prev_num_threads = omp_get_max_threads();
+    if (num_threads > 0) {
+        omp_set_num_threads(num_threads);
+    }
+#else
+    (void)num_threads;
+#endif
+    Tensor src = Tensor::Ones(shape, dtype, device);
+    auto reduce = [&]() {
+        return op == ReductionBenchmarkOp::Sum ? src.Sum(dims) : src.Max(dims);
+    };
+    Tensor warm_up = reduce();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = reduce();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            shape.NumElements() * dtype.ByteSize());
+#ifdef _OPENMP
+    omp_set_num_threads(prev_num_threads);
+#endif
+}
+
+/// Registers ReductionMatrix for all combinations of shapes, reduction dims,
+/// dtypes, ops and thread counts, e.g.
+/// ReductionMatrix/CPU/Sum/Float32/{4194304, 3}/dims:{0}/threads:1.
+static void RegisterReductionMatrix(const std::string& device_name) {
+    const Device device(device_name);
+    const std::vector<std::pair<SizeVector, std::vector<SizeVector>>> cases = {
+            // Full reduction of a 1D tensor.
+            {{1 << 24}, {{0}}},
+            // Point cloud like tensors: few outputs and many outputs.
+            {{1 << 22, 3}, {{0}, {1}, {0, 1}}},
+            {{3, 1 << 22}, {{0}, {1}}},
+            // Square matrix.
+            {{4096, 4096}, {{0}, {1}}},
+            // Image like tensors.
+            {{480, 640, 3}, {{0, 1}, {2}}},
+            {{64, 64, 64, 8}, {{0, 2}, {1, 3}, {3}}},
+    };
+    const std::vector<Dtype> dtypes = {Dtype::Float32, Dtype::Float64,
+                                       Dtype::Int32, Dtype::Int64};
+    const std::vector<std::pair<ReductionBenchmarkOp, std::string>> ops = {
+            {ReductionBenchmarkOp::Sum, "Sum"},
+            {ReductionBenchmarkOp::Max, "Max"}};
+    std::vector<int> thread_counts = {0};
+    if (device.GetType() == Device::DeviceType::CPU) {
+        thread_counts = {1, 2, 4, 0};
+    }
+
+    for (const auto& shape_dims : cases) {
+        const SizeVector& shape = shape_dims.first;
+        for (const SizeVector& dims : shape_dims.second) {
+            for (const Dtype& dtype : dtypes) {
+                for (const auto& op : ops) {
+                    for (int num_threads : thread_counts) {
+                        std::string name = fmt::format(
+                                "ReductionMatrix/{}/{}/{}/{}/dims:{}",
+                                device.GetType() == Device::DeviceType::CPU
+                                        ? "CPU"
+                                        : "CUDA",
+                                op.second, dtype.ToString(), shape.ToString(),
+                                dims.ToString());
+                        if (num_threads > 0) {
+                            name += fmt::format("/threads:{}", num_threads);
+                        }
+                        benchmark::RegisterBenchmark(
+                                name.c_str(), ReductionMatrix, device, shape,
+                                dims, dtype, op.first, num_threads)
+                                ->Unit(benchmark::kMillisecond);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static const bool s_reduction_matrix_registered BENCHMARK_UNUSED = []() {
+    RegisterReductionMatrix("CPU:0");
+#ifdef BUILD_CUDA_MODULE
+    RegisterReductionMatrix("CUDA:0");
+#endif
+    return true;
+}();
+
 }  // namespace core
 }  // namespace open3d
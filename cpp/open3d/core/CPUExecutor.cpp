@@ -0,0 +1,397 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/CPUExecutor.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+/// Ranges per thread of the task based executors, so that idle threads can
+/// balance uneven chunks.
+static constexpr int64_t kChunksPerThread = 4;
+
+int64_t CPUExecutor::NumChunks(int64_t n,
+                               int64_t grain_size,
+                               int64_t num_threads,
+                               int64_t chunks_per_thread) {
+    int64_t max_chunks = n / std::max<int64_t>(grain_size, 1);
+    return std::max<int64_t>(
+            1, std::min(max_chunks, num_threads * chunks_per_thread));
+}
+
+int64_t OpenMPExecutor::GetNumThreads() const {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+bool OpenMPExecutor::InParallel() const {
+#ifdef _OPENMP
+    return omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+void OpenMPExecutor::ParallelFor(
+        int64_t n,
+        int64_t grain_size,
+        const std::function<void(int64_t, int64_t)>& func) {
+    const int64_t num_chunks = NumChunks(n, grain_size, GetNumThreads());
+    if (num_chunks <= 1 || InParallel()) {
+        func(0, n);
+        return;
+    }
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    const int num_omp_threads = static_cast<int>(num_chunks);
+#pragma omp parallel for schedule(static) num_threads(num_omp_threads)
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        const int64_t start = chunk_idx * chunk_size;
+        const int64_t end = std::min(start + chunk_size, n);
+        if (start < end) {
+            func(start, end);
+        }
+    }
+}
+
+namespace {
+
+/// One ParallelFor() of a ThreadPoolExecutor. Threads running the job claim
+/// chunks with an atomic counter until none are left.
+class ThreadPoolJob {
+public:
+    ThreadPoolJob(const std::function<void(int64_t, int64_t)>& func,
+                  int64_t n,
+                  int64_t num_chunks)
+        : func_(func),
+          n_(n),
+          chunk_size_((n + num_chunks - 1) / num_chunks),
+          num_chunks_(num_chunks) {}
+
+    /// Runs chunks until all of them are claimed. The first exception thrown
+    /// by a chunk is kept and rethrown by the caller of ParallelFor().
+    void Run() {
+        int64_t chunk_idx;
+        while ((chunk_idx = next_chunk_.fetch_add(1)) < num_chunks_) {
+            const int64_t start = chunk_idx * chunk_size_;
+            const int64_t end = std::min(start + chunk_size_, n_);
+            try {
+                if (start < end) {
+                    func_(start, end);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex_);
+                if (!exception_) {
+                    exception_ = std::current_exception();
+                }
+            }
+            num_done_.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    bool HasChunks() const {
+        return next_chunk_.load(std::memory_order_relaxed) < num_chunks_;
+    }
+
+    bool IsDone() const {
+        return num_done_.load(std::memory_order_acquire) == num_chunks_;
+    }
+
+    std::exception_ptr GetException() {
+        std::lock_guard<std::mutex> lock(exception_mutex_);
+        return exception_;
+    }
+
+private:
+    const std::function<void(int64_t, int64_t)>& func_;
+    const int64_t n_;
+    const int64_t chunk_size_;
+    const int64_t num_chunks_;
+    std::atomic<int64_t> next_chunk_{0};
+    std::atomic<int64_t> num_done_{0};
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+};
+
+/// Pool the calling thread is a worker of, and the index of its queue.
+thread_local const void* tls_worker_pool = nullptr;
+thread_local int64_t tls_queue_idx = 0;
+/// Pool whose ParallelFor() body the calling thread is running.
+thread_local const void* tls_running_pool = nullptr;
+
+/// Marks the calling thread as running a loop body of \p pool.
+class ScopedRunning {
+public:
+    ScopedRunning(const void* pool) : previous_(tls_running_pool) {
+        tls_running_pool = pool;
+    }
+    ~ScopedRunning() { tls_running_pool = previous_; }
+
+private:
+    const void* previous_;
+};
+
+}  // namespace
+
+class ThreadPoolExecutor::Impl {
+public:
+    Impl(int64_t num_threads) : num_threads_(num_threads) {
+        // Queue 0 is shared by threads outside the pool, queue i > 0 belongs
+        // to worker i.
+        for (int64_t i = 0; i < num_threads_; ++i) {
+            queues_.emplace_back(new Queue());
+        }
+        for (int64_t i = 1; i < num_threads_; ++i) {
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void ParallelFor(int64_t n,
+                     int64_t grain_size,
+                     const std::function<void(int64_t, int64_t)>& func) {
+        const int64_t num_chunks =
+                NumChunks(n, grain_size, num_threads_, kChunksPerThread);
+        ScopedRunning running(this);
+        if (num_chunks <= 1) {
+            func(0, n);
+            return;
+        }
+
+        auto job = std::make_shared<ThreadPoolJob>(func, n, num_chunks);
+        const int64_t queue_idx = tls_worker_pool == this ? tls_queue_idx : 0;
+        {
+            std::lock_guard<std::mutex> lock(queues_[queue_idx]->mutex_);
+            queues_[queue_idx]->jobs_.push_back(job);
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            num_queued_++;
+        }
+        wake_.notify_all();
+
+        job->Run();
+        Remove(queue_idx, job);
+        // Chunks claimed by other threads may still be running.
+        while (!job->IsDone()) {
+            std::this_thread::yield();
+        }
+        if (std::exception_ptr exception = job->GetException()) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    bool InParallel() const { return tls_running_pool == this; }
+
+    int64_t num_threads_;
+
+private:
+    struct Queue {
+        std::mutex mutex_;
+        std::deque<std::shared_ptr<ThreadPoolJob>> jobs_;
+    };
+
+    void WorkerLoop(int64_t queue_idx) {
+        tls_worker_pool = this;
+        tls_queue_idx = queue_idx;
+        while (true) {
+            std::shared_ptr<ThreadPoolJob> job = FindJob(queue_idx);
+            if (job) {
+                ScopedRunning running(this);
+                job->Run();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_.wait(lock, [this]() { return stop_ || num_queued_ > 0; });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    /// Returns a job with unclaimed chunks: the newest one of the own queue,
+    /// otherwise the oldest one of another queue. Drops exhausted jobs on the
+    /// way.
+    std::shared_ptr<ThreadPoolJob> FindJob(int64_t queue_idx) {
+        for (int64_t i = 0; i < num_threads_; ++i) {
+            const int64_t victim = (queue_idx + i) % num_threads_;
+            Queue& queue = *queues_[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex_);
+            int64_t num_dropped = 0;
+            std::shared_ptr<ThreadPoolJob> found;
+            for (auto it = queue.jobs_.begin(); it != queue.jobs_.end();) {
+                if (!(*it)->HasChunks()) {
+                    it = queue.jobs_.erase(it);
+                    num_dropped++;
+                    continue;
+                }
+                if (!found || victim == queue_idx) {
+                    found = *it;
+                }
+                ++it;
+            }
+            if (num_dropped > 0) {
+                std::lock_guard<std::mutex> sleep_lock(sleep_mutex_);
+                num_queued_ -= num_dropped;
+            }
+            if (found) {
+                return found;
+            }
+        }
+        return nullptr;
+    }
+
+    void Remove(int64_t queue_idx, const std::shared_ptr<ThreadPoolJob>& job) {
+        Queue& queue = *queues_[queue_idx];
+        std::lock_guard<std::mutex> lock(queue.mutex_);
+        auto it = std::find(queue.jobs_.begin(), queue.jobs_.end(), job);
+        if (it != queue.jobs_.end()) {
+            queue.jobs_.erase(it);
+            std::lock_guard<std::mutex> sleep_lock(sleep_mutex_);
+            num_queued_--;
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    /// Number of jobs in the queues, guarded by sleep_mutex_.
+    int64_t num_queued_ = 0;
+    bool stop_ = false;
+};
+
+ThreadPoolExecutor::ThreadPoolExecutor(int64_t num_threads) {
+    if (num_threads <= 0) {
+        num_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+    }
+    impl_.reset(new Impl(num_threads));
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {}
+
+int64_t ThreadPoolExecutor::GetNumThreads() const {
+    return impl_->num_threads_;
+}
+
+bool ThreadPoolExecutor::InParallel() const { return impl_->InParallel(); }
+
+void ThreadPoolExecutor::ParallelFor(
+        int64_t n,
+        int64_t grain_size,
+        const std::function<void(int64_t, int64_t)>& func) {
+    impl_->ParallelFor(n, grain_size, func);
+}
+
+int64_t TBBExecutor::GetNumThreads() const {
+    return tbb::this_task_arena::max_concurrency();
+}
+
+bool TBBExecutor::InParallel() const { return tls_running_pool == this; }
+
+void TBBExecutor::ParallelFor(
+        int64_t n,
+        int64_t grain_size,
+        const std::function<void(int64_t, int64_t)>& func) {
+    // Splits into whole chunks rather than letting blocked_range halve the
+    // range below the grain size.
+    const int64_t num_chunks =
+            NumChunks(n, grain_size, GetNumThreads(), kChunksPerThread);
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_chunks, 1),
+            [&](const tbb::blocked_range<int64_t>& range) {
+                ScopedRunning running(this);
+                for (int64_t chunk_idx = range.begin(); chunk_idx < range.end();
+                     ++chunk_idx) {
+                    const int64_t start = chunk_idx * chunk_size;
+                    const int64_t end = std::min(start + chunk_size, n);
+                    if (start < end) {
+                        func(start, end);
+                    }
+                }
+            },
+            tbb::simple_partitioner());
+}
+
+static std::shared_ptr<CPUExecutor> CreateDefaultCPUExecutor() {
+#ifdef _OPENMP
+    return std::make_shared<OpenMPExecutor>();
+#else
+    return std::make_shared<ThreadPoolExecutor>();
+#endif
+}
+
+static std::shared_ptr<CPUExecutor> g_cpu_executor;
+
+std::shared_ptr<CPUExecutor> GetCPUExecutor() {
+    std::shared_ptr<CPUExecutor> executor = std::atomic_load(&g_cpu_executor);
+    if (executor) {
+        return executor;
+    }
+    static std::shared_ptr<CPUExecutor> default_executor =
+            CreateDefaultCPUExecutor();
+    return default_executor;
+}
+
+void SetCPUExecutor(const std::shared_ptr<CPUExecutor>& executor) {
+    std::atomic_store(&g_cpu_executor, executor);
+}
+
+}  // namespace core
+}  // namespace open3d
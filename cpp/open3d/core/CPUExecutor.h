@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace open3d {
+namespace core {
+
+/// Runs the parallel loops of the CPU kernels. Applications that run Open3D
+/// from their own worker threads can inject an executor backed by their
+/// thread pool with SetCPUExecutor(), so that Open3D does not oversubscribe
+/// the CPU with a second set of threads.
+class CPUExecutor {
+public:
+    virtual ~CPUExecutor() {}
+
+    /// Maximum number of threads running a ParallelFor() concurrently. Used to
+    /// size per-thread work, e.g. partial reductions.
+    virtual int64_t GetNumThreads() const = 0;
+
+    /// Returns true if the calling thread is running a ParallelFor() body of
+    /// this executor.
+    virtual bool InParallel() const = 0;
+
+    /// Calls func(start, end) on disjoint ranges covering [0, n) and returns
+    /// once all of them are done. Ranges have at least \p grain_size elements,
+    /// except the last one. May be called from inside \p func.
+    virtual void ParallelFor(
+            int64_t n,
+            int64_t grain_size,
+            const std::function<void(int64_t, int64_t)>& func) = 0;
+
+protected:
+    /// Number of ranges for splitting n elements over num_threads threads with
+    /// \p chunks_per_thread ranges per thread, honoring \p grain_size.
+    static int64_t NumChunks(int64_t n,
+                             int64_t grain_size,
+                             int64_t num_threads,
+                             int64_t chunks_per_thread = 1);
+};
+
+/// Splits loops with OpenMP, one contiguous range per thread as with
+/// schedule(static). Nested loops run serially in the calling thread.
+class OpenMPExecutor : public CPUExecutor {
+public:
+    int64_t GetNumThreads() const override;
+    bool InParallel() const override;
+    void ParallelFor(
+            int64_t n,
+            int64_t grain_size,
+            const std::function<void(int64_t, int64_t)>& func) override;
+};
+
+/// Work-stealing thread pool. Each ParallelFor() is split into a few ranges
+/// per thread, queued on the deque of the calling worker (or a shared queue
+/// for outside threads) and run by the caller and idle workers, which steal
+/// from each other. Nested loops are queued the same way and use idle
+/// workers instead of spawning threads. Outside threads may call
+/// ParallelFor() concurrently.
+class ThreadPoolExecutor : public CPUExecutor {
+public:
+    /// \param num_threads Number of threads, including the calling thread. If
+    /// not positive, the number of hardware threads is used.
+    explicit ThreadPoolExecutor(int64_t num_threads = 0);
+    ~ThreadPoolExecutor() override;
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    int64_t GetNumThreads() const override;
+    bool InParallel() const override;
+    void ParallelFor(
+            int64_t n,
+            int64_t grain_size,
+            const std::function<void(int64_t, int64_t)>& func) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// Runs loops with tbb::parallel_for in the current task arena, for
+/// applications that already schedule their work with TBB.
+class TBBExecutor : public CPUExecutor {
+public:
+    int64_t GetNumThreads() const override;
+    bool InParallel() const override;
+    void ParallelFor(
+            int64_t n,
+            int64_t grain_size,
+            const std::function<void(int64_t, int64_t)>& func) override;
+};
+
+/// Returns the executor of the CPU kernels. The default is an OpenMPExecutor
+/// if Open3D is built with OpenMP, a ThreadPoolExecutor otherwise.
+std::shared_ptr<CPUExecutor> GetCPUExecutor();
+
+/// Sets the executor of the CPU kernels. Passing nullptr restores the
+/// default. Loops already running finish on the previous executor.
+void SetCPUExecutor(const std::shared_ptr<CPUExecutor>& executor);
+
+/// Calls func(start, end) over [0, n) with the current CPU executor. Loops
+/// with at most \p grain_size elements run inline in the calling thread.
+template <typename func_t>
+void ParallelFor(int64_t n, int64_t grain_size, const func_t& func) {
+    if (n <= 0) {
+        return;
+    }
+    if (n <= grain_size) {
+        func(int64_t(0), n);
+        return;
+    }
+    GetCPUExecutor()->ParallelFor(n, grain_size, func);
+}
+
+}  // namespace core
+}  // namespace open3d
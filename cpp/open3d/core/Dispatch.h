@@ -46,29 +46,35 @@
 ///
 /// Inspired by:
 ///     https://github.com/pytorch/pytorch/blob/master/aten/src/ATen/Dispatch.h
-#define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)              \
-    [&] {                                                   \
-        if (DTYPE == open3d::core::Dtype::Float32) {        \
-            using scalar_t = float;                         \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::Float64) { \
-            using scalar_t = double;                        \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::Int32) {   \
-            using scalar_t = int32_t;                       \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::Int64) {   \
-            using scalar_t = int64_t;                       \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::UInt8) {   \
-            using scalar_t = uint8_t;                       \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::UInt16) {  \
-            using scalar_t = uint16_t;                      \
-            return __VA_ARGS__();                           \
-        } else {                                            \
-            utility::LogError("Unsupported data type.");    \
-        }                                                   \
+#define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)               \
+    [&] {                                                    \
+        if (DTYPE == open3d::core::Dtype::Float32) {         \
+            using scalar_t = float;                          \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::Float64) {  \
+            using scalar_t = double;                         \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::Float16) {  \
+            using scalar_t = open3d::core::Float16;          \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::BFloat16) { \
+            using scalar_t = open3d::core::BFloat16;         \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::Int32) {    \
+            using scalar_t = int32_t;                        \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::Int64) {    \
+            using scalar_t = int64_t;                        \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::UInt8) {    \
+            using scalar_t = uint8_t;                        \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::UInt16) {   \
+            using scalar_t = uint16_t;                       \
+            return __VA_ARGS__();                            \
+        } else {                                             \
+            utility::LogError("Unsupported data type.");     \
+        }                                                    \
     }()
 
 #define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(DTYPE, ...)    \
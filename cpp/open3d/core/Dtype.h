@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Float16.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -41,6 +42,8 @@ public:
     static const Dtype Undefined;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Int32;
     static const Dtype Int64;
     static const Dtype UInt8;
@@ -97,6 +100,16 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<Float16>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<BFloat16>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int32_t>() {
     return Dtype::Int32;
@@ -0,0 +1,288 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file Float16.h
+/// \brief 16-bit floating point types for storage.
+///
+/// Float16 is the IEEE 754 binary16 format and BFloat16 is the upper half of
+/// a float32. Both are storage types: values are converted to float for
+/// arithmetic, and converted back with round-to-nearest-even on assignment.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+namespace half_util {
+
+OPEN3D_HOST_DEVICE inline uint32_t FloatToBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+OPEN3D_HOST_DEVICE inline float BitsToFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// float32 -> binary16 with round-to-nearest-even. Overflows to infinity and
+/// keeps NaN as a quiet NaN.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToHalfBits(float value) {
+    const uint32_t f32_infinity = 255u << 23;
+    const uint32_t f16_max = (127u + 16u) << 23;
+    const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    uint32_t bits = FloatToBits(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+    uint16_t result;
+    if (bits >= f16_max) {
+        // Infinity or NaN.
+        result = bits > f32_infinity ? 0x7e00 : 0x7c00;
+    } else if (bits < (113u << 23)) {
+        // Subnormal or zero: let the FPU round the mantissa.
+        float rounded = BitsToFloat(bits) + BitsToFloat(denorm_magic);
+        result = static_cast<uint16_t>(FloatToBits(rounded) - denorm_magic);
+    } else {
+        const uint32_t mantissa_odd = (bits >> 13) & 1u;
+        // Rebias the exponent and round.
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu;
+        bits += mantissa_odd;
+        result = static_cast<uint16_t>(bits >> 13);
+    }
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+/// binary16 -> float32, exact.
+OPEN3D_HOST_DEVICE inline float HalfBitsToFloat(uint16_t half_bits) {
+    const uint32_t magic = 113u << 23;
+    const uint32_t shifted_exponent = 0x7c00u << 13;
+    uint32_t bits = (half_bits & 0x7fffu) << 13;
+    const uint32_t exponent = shifted_exponent & bits;
+    bits += (127u - 15u) << 23;
+    if (exponent == shifted_exponent) {
+        // Infinity or NaN.
+        bits += (128u - 16u) << 23;
+    } else if (exponent == 0) {
+        // Zero or subnormal: renormalize.
+        bits += 1u << 23;
+        bits = FloatToBits(BitsToFloat(bits) - BitsToFloat(magic));
+    }
+    bits |= static_cast<uint32_t>(half_bits & 0x8000u) << 16;
+    return BitsToFloat(bits);
+}
+
+/// float32 -> bfloat16 with round-to-nearest-even. Keeps NaN as a quiet NaN.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToBFloat16Bits(float value) {
+    const uint32_t bits = FloatToBits(value);
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+    }
+    const uint32_t rounding_bias = 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+}
+
+/// bfloat16 -> float32, exact.
+OPEN3D_HOST_DEVICE inline float BFloat16BitsToFloat(uint16_t bf16_bits) {
+    return BitsToFloat(static_cast<uint32_t>(bf16_bits) << 16);
+}
+
+}  // namespace half_util
+
+/// IEEE 754 half precision float. Implicitly converts to and from float, so
+/// that arithmetic is done in float.
+struct Float16 {
+    uint16_t bits_;
+
+    Float16() = default;
+
+    OPEN3D_HOST_DEVICE Float16(float value)
+        : bits_(half_util::FloatToHalfBits(value)) {}
+
+    /// Conversion from other arithmetic types, e.g. static_cast<Float16>(1.0).
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value &&
+                                              !std::is_same<T, float>::value,
+                                      int>::type = 0>
+    OPEN3D_HOST_DEVICE explicit Float16(T value)
+        : Float16(static_cast<float>(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return half_util::HalfBitsToFloat(bits_);
+    }
+
+    /// Constructs a Float16 from its bit representation.
+    static constexpr OPEN3D_HOST_DEVICE Float16 FromBits(uint16_t bits) {
+        return Float16(bits, FromBitsTag());
+    }
+
+private:
+    struct FromBitsTag {};
+    constexpr OPEN3D_HOST_DEVICE Float16(uint16_t bits, FromBitsTag)
+        : bits_(bits) {}
+};
+
+/// Brain floating point: float32 with the lower 16 mantissa bits dropped.
+/// Implicitly converts to and from float, so that arithmetic is done in float.
+struct BFloat16 {
+    uint16_t bits_;
+
+    BFloat16() = default;
+
+    OPEN3D_HOST_DEVICE BFloat16(float value)
+        : bits_(half_util::FloatToBFloat16Bits(value)) {}
+
+    /// Conversion from other arithmetic types, e.g. static_cast<BFloat16>(1.0).
+    template <typename T,
+              typename std::enable_if<std::is_arithmetic<T>::value &&
+                                              !std::is_same<T, float>::value,
+                                      int>::type = 0>
+    OPEN3D_HOST_DEVICE explicit BFloat16(T value)
+        : BFloat16(static_cast<float>(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return half_util::BFloat16BitsToFloat(bits_);
+    }
+
+    /// Constructs a BFloat16 from its bit representation.
+    static constexpr OPEN3D_HOST_DEVICE BFloat16 FromBits(uint16_t bits) {
+        return BFloat16(bits, FromBitsTag());
+    }
+
+private:
+    struct FromBitsTag {};
+    constexpr OPEN3D_HOST_DEVICE BFloat16(uint16_t bits, FromBitsTag)
+        : bits_(bits) {}
+};
+
+static_assert(sizeof(Float16) == 2, "Float16 must be 2 bytes.");
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes.");
+
+/// Accumulation type for reductions: float for the 16-bit floating point
+/// types, scalar_t otherwise.
+template <typename scalar_t>
+struct AccumulationType {
+    using type = scalar_t;
+};
+template <>
+struct AccumulationType<Float16> {
+    using type = float;
+};
+template <>
+struct AccumulationType<BFloat16> {
+    using type = float;
+};
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::Float16> {
+    using Float16 = open3d::core::Float16;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int max_exponent = 16;
+
+    static constexpr Float16 min() { return Float16::FromBits(0x0400); }
+    static constexpr Float16 max() { return Float16::FromBits(0x7bff); }
+    static constexpr Float16 lowest() { return Float16::FromBits(0xfbff); }
+    static constexpr Float16 epsilon() { return Float16::FromBits(0x1400); }
+    static constexpr Float16 infinity() { return Float16::FromBits(0x7c00); }
+    static constexpr Float16 quiet_NaN() { return Float16::FromBits(0x7e00); }
+};
+
+template <>
+class numeric_limits<open3d::core::BFloat16> {
+    using BFloat16 = open3d::core::BFloat16;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -125;
+    static constexpr int max_exponent = 128;
+
+    static constexpr BFloat16 min() { return BFloat16::FromBits(0x0080); }
+    static constexpr BFloat16 max() { return BFloat16::FromBits(0x7f7f); }
+    static constexpr BFloat16 lowest() { return BFloat16::FromBits(0xff7f); }
+    static constexpr BFloat16 epsilon() { return BFloat16::FromBits(0x3c00); }
+    static constexpr BFloat16 infinity() { return BFloat16::FromBits(0x7f80); }
+    static constexpr BFloat16 quiet_NaN() {
+        return BFloat16::FromBits(0x7fc0);
+    }
+};
+
+}  // namespace std
+
+namespace fmt {
+
+template <>
+struct formatter<open3d::core::Float16> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::core::Float16& value, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
+template <>
+struct formatter<open3d::core::BFloat16> : formatter<float> {
+    template <typename FormatContext>
+    auto format(const open3d::core::BFloat16& value, FormatContext& ctx)
+            -> decltype(ctx.out()) {
+        return formatter<float>::format(static_cast<float>(value), ctx);
+    }
+};
+
+}  // namespace fmt
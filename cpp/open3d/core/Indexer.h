@@ -394,6 +394,24 @@ public:
         return outputs_[0].byte_strides_[dim] == 0 && master_shape_[dim] > 1;
     }
 
+    /// Returns true if the \p input_idx -th input is visited contiguously,
+    /// i.e. the workload_idx-th element is at
+    /// GetInputPtr(input_idx, 0) + workload_idx * dtype_byte_size.
+    bool IsInputContiguous(int64_t input_idx) const {
+        return IsContiguous(GetInput(input_idx));
+    }
+
+    /// Returns true if all workloads of the \p input_idx -th input refer to
+    /// the same element, e.g. a broadcasted scalar.
+    bool IsInputScalar(int64_t input_idx) const {
+        return IsScalar(GetInput(input_idx));
+    }
+
+    /// Returns true if the \p output_idx -th output is visited contiguously.
+    bool IsOutputContiguous(int64_t output_idx = 0) const {
+        return IsContiguous(GetOutput(output_idx));
+    }
+
     /// Get input Tensor data pointer based on \p workload_idx.
     ///
     /// \param input_idx Input tensor index.
@@ -432,6 +450,12 @@ protected:
     /// Update master_strides_ based on master_shape_.
     void UpdateMasterStrides();
 
+    /// Returns true if \p tr's strides are the master strides in bytes.
+    bool IsContiguous(const TensorRef& tr) const;
+
+    /// Returns true if \p tr's strides are 0 in all non-trivial dimensions.
+    bool IsScalar(const TensorRef& tr) const;
+
     /// Broadcast src to dst by setting shape 1 to omitted dimensions and
     /// setting stride 0 to brocasted dimensions.
     ///
@@ -26,6 +26,7 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <atomic>
 #include <numeric>
 #include <unordered_map>
 
@@ -93,8 +94,23 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+static std::atomic<bool> cpu_cache_enabled{false};
+
+void MemoryManager::SetCPUCacheEnabled(bool enabled) {
+    cpu_cache_enabled.store(enabled);
+}
+
+bool MemoryManager::IsCPUCacheEnabled() { return cpu_cache_enabled.load(); }
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
+    static std::shared_ptr<DeviceMemoryManager> cpu_cached_memory_manager =
+            std::make_shared<CPUCachedMemoryManager>();
+    if (device.GetType() == Device::DeviceType::CPU &&
+        cpu_cache_enabled.load(std::memory_order_relaxed)) {
+        return cpu_cached_memory_manager;
+    }
+
     static std::unordered_map<Device::DeviceType,
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
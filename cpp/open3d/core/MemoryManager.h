@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
@@ -59,6 +60,13 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Selects the memory manager for subsequent CPU allocations. If enabled,
+    /// CPUCachedMemoryManager is used, otherwise CPUMemoryManager is used.
+    /// Memory allocated before the switch is still freed correctly.
+    static void SetCPUCacheEnabled(bool enabled);
+    /// Returns true if CPU allocations go through CPUCachedMemoryManager.
+    static bool IsCPUCacheEnabled();
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
@@ -88,6 +96,58 @@ public:
                 size_t num_bytes) override;
 };
 
+/// Statistics of CPUCachedMemoryManager. Byte counts are rounded up to the
+/// size of the cached blocks.
+struct CPUCacheStatistics {
+    /// Number of Malloc calls.
+    int64_t num_mallocs_ = 0;
+    /// Number of Malloc calls served from the cache.
+    int64_t num_cache_hits_ = 0;
+    /// Number of blocks allocated from the system allocator.
+    int64_t num_system_allocs_ = 0;
+    /// Number of blocks returned to the system allocator.
+    int64_t num_system_frees_ = 0;
+    /// Bytes handed out to callers and not yet freed.
+    int64_t bytes_in_use_ = 0;
+    /// Peak value of bytes_in_use_.
+    int64_t peak_bytes_in_use_ = 0;
+    /// Bytes held in the free lists, ready for reuse.
+    int64_t bytes_cached_ = 0;
+};
+
+/// Caching CPU memory manager.
+///
+/// Freed blocks are kept in size-class free lists and reused by following
+/// Malloc calls instead of going back to the system allocator. Small blocks
+/// (up to 1 MiB) are rounded up to powers of two and are first cached in
+/// thread-local free lists. Large blocks are rounded up to and aligned at 2 MiB
+/// so that the OS can back them with huge pages; they are cached in a shared
+/// pool. Pointers not allocated by this manager are released with std::free,
+/// so it is safe to switch managers with MemoryManager::SetCPUCacheEnabled().
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Returns the cached blocks of the shared pool and of the calling
+    /// thread's free lists to the system. Blocks cached by other threads are
+    /// returned when those threads exit.
+    static void ReleaseCache();
+
+    static CPUCacheStatistics GetStatistics();
+
+    /// Frees \p ptr if it was allocated by CPUCachedMemoryManager. Returns
+    /// false if \p ptr is unknown to the cache.
+    static bool FreeIfCached(void* ptr);
+};
+
 #ifdef BUILD_CUDA_MODULE
 class CUDASimpleMemoryManager : public DeviceMemoryManager {
 public:
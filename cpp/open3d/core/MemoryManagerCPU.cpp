@@ -43,7 +43,8 @@ void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
 }
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
-    if (ptr) {
+    // Blocks allocated while the CPU cache was enabled go back to the cache.
+    if (ptr && !CPUCachedMemoryManager::FreeIfCached(ptr)) {
         std::free(ptr);
     }
 }
@@ -0,0 +1,369 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+// Small blocks are rounded up to powers of two: 64 B, 128 B, ..., 1 MiB.
+static constexpr size_t kMinBlockSize = 64;
+static constexpr size_t kSmallSize = 1048576;
+static constexpr int kNumSizeClasses = 15;
+// Large blocks are rounded up to multiples of (and aligned at) 2 MiB.
+static constexpr size_t kHugePageSize = 2097152;
+// Max number of blocks per size class kept in a thread-local free list. The
+// rest goes to the shared pool.
+static constexpr size_t kMaxThreadCachedBlocks = 32;
+// Number of independently locked shards of the pointer -> block size table.
+static constexpr size_t kNumShards = 64;
+
+static int GetSizeClass(size_t byte_size) {
+    int size_class = 0;
+    size_t block_size = kMinBlockSize;
+    while (block_size < byte_size) {
+        block_size <<= 1;
+        ++size_class;
+    }
+    return size_class;
+}
+
+static size_t GetSizeClassBytes(int size_class) {
+    return kMinBlockSize << size_class;
+}
+
+static void* SystemMalloc(size_t byte_size, size_t alignment) {
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(byte_size, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, byte_size) != 0) {
+        ptr = nullptr;
+    }
+#endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Transparent huge pages are only a hint, failure is harmless.
+    if (ptr && byte_size >= kHugePageSize) {
+        madvise(ptr, byte_size, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+static void SystemFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+// Per-thread free lists of small blocks. Blocks are moved to the shared pool
+// of the CPUCacher when the thread exits.
+struct ThreadCache {
+    ~ThreadCache();
+    std::vector<void*> free_blocks_[kNumSizeClasses];
+};
+
+// Set when the thread-local cache has been destroyed during thread exit. Free
+// calls after that (e.g. from other thread_local destructors) go to the shared
+// pool. Trivially destructible, hence always accessible.
+static thread_local bool thread_cache_destroyed = false;
+
+static ThreadCache* GetThreadCache() {
+    if (thread_cache_destroyed) {
+        return nullptr;
+    }
+    static thread_local ThreadCache thread_cache;
+    return &thread_cache;
+}
+
+// Singleton cacher.
+// Similar to the CUDACacher, memory is not released when Free is called.
+// Freed blocks are kept in free lists, indexed by size class, and reused in
+// following Malloc calls. Since Free is called without the block size, the
+// size of every block handed out is recorded in a sharded hash table. To clear
+// the cache, use CPUCachedMemoryManager::ReleaseCache().
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        // Never destroyed: thread-local caches may return blocks at thread
+        // exit, after static objects have been destroyed.
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+public:
+    void* Malloc(size_t byte_size) {
+        num_mallocs_.fetch_add(1, std::memory_order_relaxed);
+
+        void* ptr = nullptr;
+        size_t block_size = 0;
+        if (byte_size <= kSmallSize) {
+            int size_class = GetSizeClass(byte_size);
+            block_size = GetSizeClassBytes(size_class);
+            ThreadCache* thread_cache = GetThreadCache();
+            if (thread_cache &&
+                !thread_cache->free_blocks_[size_class].empty()) {
+                ptr = thread_cache->free_blocks_[size_class].back();
+                thread_cache->free_blocks_[size_class].pop_back();
+            } else {
+                std::lock_guard<std::mutex> lock(pool_mutex_);
+                std::vector<void*>& pool = small_pools_[size_class];
+                if (!pool.empty()) {
+                    ptr = pool.back();
+                    pool.pop_back();
+                }
+            }
+        } else {
+            block_size = (byte_size + kHugePageSize - 1) / kHugePageSize *
+                         kHugePageSize;
+            std::lock_guard<std::mutex> lock(pool_mutex_);
+            auto it = large_pool_.lower_bound(block_size);
+            // Reuse blocks at most twice as large to bound the waste.
+            if (it != large_pool_.end() && it->first <= 2 * block_size) {
+                block_size = it->first;
+                ptr = it->second;
+                large_pool_.erase(it);
+            }
+        }
+
+        if (ptr) {
+            num_cache_hits_.fetch_add(1, std::memory_order_relaxed);
+            bytes_cached_.fetch_sub(block_size, std::memory_order_relaxed);
+        } else {
+            size_t alignment =
+                    byte_size <= kSmallSize ? kMinBlockSize : kHugePageSize;
+            ptr = SystemMalloc(block_size, alignment);
+            if (!ptr) {
+                // Give the cached memory back and retry once.
+                ReleaseCache();
+                ptr = SystemMalloc(block_size, alignment);
+            }
+            if (!ptr) {
+                utility::LogError("[CPUCacher] CPU malloc of {} bytes failed.",
+                                  block_size);
+            }
+            num_system_allocs_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Shard& shard = GetShard(ptr);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+            shard.allocated_blocks_[ptr] = block_size;
+        }
+        num_allocated_blocks_.fetch_add(1, std::memory_order_relaxed);
+
+        int64_t bytes_in_use =
+                bytes_in_use_.fetch_add(block_size, std::memory_order_relaxed) +
+                block_size;
+        int64_t peak = peak_bytes_in_use_.load(std::memory_order_relaxed);
+        while (bytes_in_use > peak &&
+               !peak_bytes_in_use_.compare_exchange_weak(
+                       peak, bytes_in_use, std::memory_order_relaxed)) {
+        }
+        return ptr;
+    }
+
+    /// Returns false if ptr was not allocated by the cacher.
+    bool Free(void* ptr) {
+        // Fast path: nothing has been allocated through the cache.
+        if (num_allocated_blocks_.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+
+        size_t block_size = 0;
+        Shard& shard = GetShard(ptr);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+            auto it = shard.allocated_blocks_.find(ptr);
+            if (it == shard.allocated_blocks_.end()) {
+                return false;
+            }
+            block_size = it->second;
+            shard.allocated_blocks_.erase(it);
+        }
+        num_allocated_blocks_.fetch_sub(1, std::memory_order_relaxed);
+        bytes_in_use_.fetch_sub(block_size, std::memory_order_relaxed);
+        bytes_cached_.fetch_add(block_size, std::memory_order_relaxed);
+
+        if (block_size <= kSmallSize) {
+            int size_class = GetSizeClass(block_size);
+            ThreadCache* thread_cache = GetThreadCache();
+            if (thread_cache && thread_cache->free_blocks_[size_class].size() <
+                                        kMaxThreadCachedBlocks) {
+                thread_cache->free_blocks_[size_class].push_back(ptr);
+            } else {
+                std::lock_guard<std::mutex> lock(pool_mutex_);
+                small_pools_[size_class].push_back(ptr);
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(pool_mutex_);
+            large_pool_.emplace(block_size, ptr);
+        }
+        return true;
+    }
+
+    void ReturnThreadCache(ThreadCache& thread_cache) {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        for (int i = 0; i < kNumSizeClasses; ++i) {
+            std::vector<void*>& blocks = thread_cache.free_blocks_[i];
+            small_pools_[i].insert(small_pools_[i].end(), blocks.begin(),
+                                   blocks.end());
+            blocks.clear();
+        }
+    }
+
+    void ReleaseCache() {
+        size_t total_bytes = 0;
+        auto release_blocks = [&](std::vector<void*>& blocks,
+                                  size_t block_size) {
+            for (void* ptr : blocks) {
+                SystemFree(ptr);
+            }
+            total_bytes += blocks.size() * block_size;
+            num_system_frees_.fetch_add(blocks.size(),
+                                        std::memory_order_relaxed);
+            blocks.clear();
+        };
+
+        ThreadCache* thread_cache = GetThreadCache();
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        for (int i = 0; i < kNumSizeClasses; ++i) {
+            if (thread_cache) {
+                release_blocks(thread_cache->free_blocks_[i],
+                               GetSizeClassBytes(i));
+            }
+            release_blocks(small_pools_[i], GetSizeClassBytes(i));
+        }
+        for (auto& kv : large_pool_) {
+            SystemFree(kv.second);
+            total_bytes += kv.first;
+            num_system_frees_.fetch_add(1, std::memory_order_relaxed);
+        }
+        large_pool_.clear();
+        bytes_cached_.fetch_sub(total_bytes, std::memory_order_relaxed);
+
+        utility::LogDebug("[CPUCacher] {} bytes released.", total_bytes);
+    }
+
+    CPUCacheStatistics GetStatistics() const {
+        CPUCacheStatistics stats;
+        stats.num_mallocs_ = num_mallocs_.load();
+        stats.num_cache_hits_ = num_cache_hits_.load();
+        stats.num_system_allocs_ = num_system_allocs_.load();
+        stats.num_system_frees_ = num_system_frees_.load();
+        stats.bytes_in_use_ = bytes_in_use_.load();
+        stats.peak_bytes_in_use_ = peak_bytes_in_use_.load();
+        stats.bytes_cached_ = bytes_cached_.load();
+        return stats;
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex_;
+        std::unordered_map<void*, size_t> allocated_blocks_;
+    };
+
+    Shard& GetShard(void* ptr) {
+        // Blocks are at least 64-byte aligned, drop the low bits.
+        return shards_[(reinterpret_cast<size_t>(ptr) >> 6) % kNumShards];
+    }
+
+    Shard shards_[kNumShards];
+    std::atomic<int64_t> num_allocated_blocks_{0};
+
+    std::mutex pool_mutex_;
+    std::vector<void*> small_pools_[kNumSizeClasses];
+    std::multimap<size_t, void*> large_pool_;
+
+    std::atomic<int64_t> num_mallocs_{0};
+    std::atomic<int64_t> num_cache_hits_{0};
+    std::atomic<int64_t> num_system_allocs_{0};
+    std::atomic<int64_t> num_system_frees_{0};
+    std::atomic<int64_t> bytes_in_use_{0};
+    std::atomic<int64_t> peak_bytes_in_use_{0};
+    std::atomic<int64_t> bytes_cached_{0};
+};
+
+ThreadCache::~ThreadCache() {
+    CPUCacher::GetInstance().ReturnThreadCache(*this);
+    thread_cache_destroyed = true;
+}
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+    return CPUCacher::GetInstance().Malloc(byte_size);
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) return;
+    // Blocks allocated before the cache was enabled come from std::malloc.
+    if (!CPUCacher::GetInstance().Free(ptr)) {
+        std::free(ptr);
+    }
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance().ReleaseCache();
+}
+
+CPUCacheStatistics CPUCachedMemoryManager::GetStatistics() {
+    return CPUCacher::GetInstance().GetStatistics();
+}
+
+bool CPUCachedMemoryManager::FreeIfCached(void* ptr) {
+    return CPUCacher::GetInstance().Free(ptr);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -50,6 +50,11 @@
 
 #include "open3d/core/NumpyIO.h"
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -59,6 +64,7 @@
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/MemoryMappedFile.h"
 
 namespace open3d {
 namespace core {
@@ -80,6 +86,7 @@ static char DtypeToChar(const Dtype& dtype) {
     // '?': object
     if (dtype == Dtype::Float32) return 'f';
     if (dtype == Dtype::Float64) return 'f';
+    if (dtype == Dtype::Float16) return 'f';
     if (dtype == Dtype::Int32) return 'i';
     if (dtype == Dtype::Int64) return 'i';
     if (dtype == Dtype::UInt8) return 'u';
@@ -150,19 +157,37 @@ static std::vector<char> CreateNumpyHeader(const SizeVector& shape,
     return std::vector<char>(s.begin(), s.end());
 }
 
-static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
+// Parses the magic string, the format version and the header size. The
+// buffer must hold at least 12 bytes. Returns the byte offset and the size of
+// the header dict.
+static std::pair<int64_t, int64_t> ParseNumpyPreamble(const char* buffer) {
+    if (static_cast<unsigned char>(buffer[0]) != 0x93 ||
+        std::string(buffer + 1, 5) != "NUMPY") {
+        utility::LogError("ParseNumpyPreamble: invalid magic string.");
+    }
+    uint8_t major_version = static_cast<uint8_t>(buffer[6]);
+    if (major_version == 1) {
+        uint16_t header_size;
+        std::memcpy(&header_size, buffer + 8, sizeof(header_size));
+        return std::make_pair(10, static_cast<int64_t>(header_size));
+    } else if (major_version == 2 || major_version == 3) {
+        uint32_t header_size;
+        std::memcpy(&header_size, buffer + 8, sizeof(header_size));
+        return std::make_pair(12, static_cast<int64_t>(header_size));
+    } else {
+        utility::LogError("ParseNumpyPreamble: unsupported version {}.",
+                          major_version);
+    }
+}
+
+static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(
+        const std::string& header) {
     char type;
     int64_t word_size;
     SizeVector shape;
     bool fortran_order;
 
-    char buffer[256];
-    size_t res = fread(buffer, sizeof(char), 11, fp);
-    if (res != 11) {
-        utility::LogError("ParseNumpyHeader: failed fread");
-    }
-    std::string header = fgets(buffer, 256, fp);
-    if (header[header.size() - 1] != '\n') {
+    if (header.empty() || header[header.size() - 1] != '\n') {
         utility::LogError("ParseNumpyHeader: the last char must be '\n'");
     }
 
@@ -194,7 +219,7 @@ static std::tuple<char, int64_t, SizeVector, bool> ParseNumpyHeader(FILE* fp) {
 
     std::string str_shape = header.substr(loc1 + 1, loc2 - loc1 - 1);
     while (std::regex_search(str_shape, sm, num_regex)) {
-        shape.push_back(std::stoi(sm[0].str()));
+        shape.push_back(std::stoll(sm[0].str()));
         str_shape = sm.suffix().str();
     }
 
@@ -238,13 +263,30 @@ NumpyArray::NumpyArray(const SizeVector& shape,
     blob_ = std::make_shared<Blob>(num_elements_ * word_size_, Device("CPU:0"));
 }
 
+NumpyArray::NumpyArray(const SizeVector& shape,
+                       char type,
+                       int64_t word_size,
+                       bool fortran_order,
+                       const std::shared_ptr<Blob>& blob)
+    : blob_(blob),
+      shape_(shape),
+      type_(type),
+      word_size_(word_size),
+      fortran_order_(fortran_order),
+      num_elements_(shape.NumElements()) {}
+
 NumpyArray::NumpyArray(const Tensor& t)
     : shape_(t.GetShape()),
       type_(DtypeToChar(t.GetDtype())),
       word_size_(t.GetDtype().ByteSize()),
       fortran_order_(false),
       num_elements_(t.GetShape().NumElements()) {
-    blob_ = t.Contiguous().To(Device("CPU:0")).GetBlob();
+    Tensor host_t = t.Contiguous().To(Device("CPU:0"));
+    // A contiguous view, e.g. a slice, may start after the blob's data.
+    if (host_t.GetDataPtr() != host_t.GetBlob()->GetDataPtr()) {
+        host_t = host_t.Clone();
+    }
+    blob_ = host_t.GetBlob();
 }
 
 Dtype NumpyArray::GetDtype() const {
@@ -253,6 +295,8 @@ Dtype NumpyArray::GetDtype() const {
         dtype = Dtype::Float32;
     } else if (type_ == 'f' && word_size_ == 8) {
         dtype = Dtype::Float64;
+    } else if (type_ == 'f' && word_size_ == 2) {
+        dtype = Dtype::Float16;
     } else if (type_ == 'i' && word_size_ == 4) {
         dtype = Dtype::Int32;
     } else if (type_ == 'i' && word_size_ == 8) {
@@ -288,21 +332,89 @@ NumpyArray NumpyArray::Load(const std::string& file_name) {
     if (!fp) {
         utility::LogError("NumpyLoad: Unable to open file {}.", file_name);
     }
+    char preamble[12];
+    if (fread(preamble, 1, sizeof(preamble), fp) != sizeof(preamble)) {
+        fclose(fp);
+        utility::LogError("NumpyLoad: failed to read the header of {}.",
+                          file_name);
+    }
+    int64_t header_offset, header_size;
+    std::tie(header_offset, header_size) = ParseNumpyPreamble(preamble);
+    std::string header(static_cast<size_t>(header_size), '\0');
+    if (fseek(fp, static_cast<long>(header_offset), SEEK_SET) != 0 ||
+        fread(&header[0], 1, header.size(), fp) != header.size()) {
+        fclose(fp);
+        utility::LogError("NumpyLoad: failed to read the header of {}.",
+                          file_name);
+    }
     SizeVector shape;
     int64_t word_size;
     bool fortran_order;
     char type;
-    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(fp);
+    std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(header);
     NumpyArray arr(shape, type, word_size, fortran_order);
     size_t nread = fread(arr.GetDataPtr<char>(), 1,
                          static_cast<size_t>(arr.NumBytes()), fp);
+    fclose(fp);
     if (nread != static_cast<size_t>(arr.NumBytes())) {
         utility::LogError("LoadTheNumpyFile: failed fread");
     }
-    fclose(fp);
     return arr;
 }
 
+// Parses a .npy file held in memory. If owner is not nullptr, the returned
+// array refers to the buffer directly and keeps owner alive. Otherwise, or if
+// the data is not aligned to the element size, the data is copied.
+static NumpyArray ParseNumpyBuffer(const char* buffer,
+                                   int64_t buffer_size,
+                                   const std::shared_ptr<void>& owner,
+                                   const std::string& name) {
+    if (buffer_size < 12) {
+        utility::LogError("{} is too small to be a Numpy array.", name);
+    }
+    int64_t header_offset, header_size;
+    std::tie(header_offset, header_size) = ParseNumpyPreamble(buffer);
+    int64_t data_offset = header_offset + header_size;
+    if (data_offset > buffer_size) {
+        utility::LogError("{}: truncated Numpy header.", name);
+    }
+    SizeVector shape;
+    int64_t word_size;
+    bool fortran_order;
+    char type;
+    std::tie(type, word_size, shape, fortran_order) =
+            ParseNumpyHeader(std::string(buffer + header_offset,
+                                         static_cast<size_t>(header_size)));
+    int64_t num_bytes = shape.NumElements() * word_size;
+    if (data_offset + num_bytes > buffer_size) {
+        utility::LogError("{}: expected {} bytes of data, but got {}.", name,
+                          num_bytes, buffer_size - data_offset);
+    }
+
+    const char* data_ptr = buffer + data_offset;
+    if (owner != nullptr &&
+        reinterpret_cast<uintptr_t>(data_ptr) % word_size == 0) {
+        auto blob = std::make_shared<Blob>(Device("CPU:0"),
+                                           const_cast<char*>(data_ptr),
+                                           [owner](void*) {});
+        return NumpyArray(shape, type, word_size, fortran_order, blob);
+    }
+    if (owner != nullptr) {
+        utility::LogDebug("{}: data is not aligned, copying it into memory.",
+                          name);
+    }
+    NumpyArray arr(shape, type, word_size, fortran_order);
+    std::memcpy(arr.GetDataPtr<char>(), data_ptr,
+                static_cast<size_t>(num_bytes));
+    return arr;
+}
+
+NumpyArray NumpyArray::LoadMemoryMapped(const std::string& file_name) {
+    auto file = std::make_shared<utility::MemoryMappedFile>(file_name);
+    return ParseNumpyBuffer(file->GetDataPtr(), file->GetSize(), file,
+                            file_name);
+}
+
 void NumpyArray::Save(std::string file_name) const {
     FILE* fp = fopen(file_name.c_str(), "wb");
     std::vector<char> header = CreateNumpyHeader(shape_, GetDtype());
@@ -314,5 +426,349 @@ void NumpyArray::Save(std::string file_name) const {
     fclose(fp);
 }
 
+// Zip archive records used by .npz files. All values are little endian.
+static constexpr uint32_t kZipLocalHeaderSignature = 0x04034b50;
+static constexpr uint32_t kZipCentralHeaderSignature = 0x02014b50;
+static constexpr uint32_t kZipEndOfCentralDirSignature = 0x06054b50;
+static constexpr uint32_t kZip64EndOfCentralDirSignature = 0x06064b50;
+static constexpr uint32_t kZip64EndOfCentralDirLocatorSignature = 0x07064b50;
+static constexpr uint16_t kZip64ExtraFieldId = 0x0001;
+// Unregistered extra field id used to pad local headers, ignored by readers.
+static constexpr uint16_t kZipPaddingExtraFieldId = 0x4f33;
+// Array data is aligned to this many bytes for zero-copy memory mapping.
+static constexpr int64_t kNpzDataAlignment = 64;
+static constexpr int64_t kZipLocalHeaderSize = 30;
+static constexpr int64_t kZipCentralHeaderSize = 46;
+static constexpr int64_t kZipEndOfCentralDirSize = 22;
+static constexpr int64_t kZip64EndOfCentralDirSize = 56;
+static constexpr int64_t kZip64EndOfCentralDirLocatorSize = 20;
+static constexpr uint32_t kZip64Marker = 0xffffffff;
+
+template <typename T>
+static T ReadLittleEndian(const char* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void WriteLittleEndian(std::vector<char>& buffer, T value) {
+    const char* ptr = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+// zlib takes 32-bit lengths.
+static uint32_t ComputeCRC32(uint32_t crc, const char* data, int64_t size) {
+    while (size > 0) {
+        uInt chunk_size = static_cast<uInt>(
+                std::min<int64_t>(size, std::numeric_limits<uInt>::max()));
+        crc = static_cast<uint32_t>(
+                crc32(crc, reinterpret_cast<const Bytef*>(data), chunk_size));
+        data += chunk_size;
+        size -= chunk_size;
+    }
+    return crc;
+}
+
+// Inflates a raw deflate stream (zip compression method 8).
+static std::shared_ptr<Blob> Inflate(const char* src,
+                                     int64_t src_size,
+                                     int64_t dst_size,
+                                     const std::string& name) {
+    auto blob = std::make_shared<Blob>(dst_size, Device("CPU:0"));
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        utility::LogError("{}: failed to initialize zlib.", name);
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(src));
+    stream.next_out = reinterpret_cast<Bytef*>(blob->GetDataPtr());
+    int64_t src_remaining = src_size;
+    int64_t dst_remaining = dst_size;
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        uInt max_chunk_size = std::numeric_limits<uInt>::max();
+        if (stream.avail_in == 0) {
+            stream.avail_in = static_cast<uInt>(
+                    std::min<int64_t>(src_remaining, max_chunk_size));
+            src_remaining -= stream.avail_in;
+        }
+        if (stream.avail_out == 0) {
+            stream.avail_out = static_cast<uInt>(
+                    std::min<int64_t>(dst_remaining, max_chunk_size));
+            dst_remaining -= stream.avail_out;
+        }
+        ret = inflate(&stream, Z_NO_FLUSH);
+    }
+    int64_t total_out = static_cast<int64_t>(stream.total_out);
+    inflateEnd(&stream);
+    if (ret != Z_STREAM_END || total_out != dst_size) {
+        utility::LogError("{}: failed to inflate compressed data.", name);
+    }
+    return blob;
+}
+
+std::unordered_map<std::string, NumpyArray> NumpyArray::LoadNpz(
+        const std::string& file_name, bool memory_mapped) {
+    auto file = std::make_shared<utility::MemoryMappedFile>(file_name);
+    const char* data = file->GetDataPtr();
+    const int64_t size = file->GetSize();
+
+    // The end of central directory record is followed by a comment of at most
+    // 65535 bytes.
+    int64_t eocd_offset = -1;
+    for (int64_t offset = size - kZipEndOfCentralDirSize;
+         offset >= 0 && offset >= size - kZipEndOfCentralDirSize - 65535;
+         --offset) {
+        if (ReadLittleEndian<uint32_t>(data + offset) ==
+            kZipEndOfCentralDirSignature) {
+            eocd_offset = offset;
+            break;
+        }
+    }
+    if (eocd_offset < 0) {
+        utility::LogError("LoadNpz: {} is not a zip archive.", file_name);
+    }
+    int64_t num_entries = ReadLittleEndian<uint16_t>(data + eocd_offset + 10);
+    int64_t cd_offset = ReadLittleEndian<uint32_t>(data + eocd_offset + 16);
+    int64_t locator_offset = eocd_offset - kZip64EndOfCentralDirLocatorSize;
+    if (locator_offset >= 0 &&
+        ReadLittleEndian<uint32_t>(data + locator_offset) ==
+                kZip64EndOfCentralDirLocatorSignature) {
+        int64_t zip64_eocd_offset =
+                ReadLittleEndian<uint64_t>(data + locator_offset + 8);
+        if (zip64_eocd_offset < 0 ||
+            zip64_eocd_offset + kZip64EndOfCentralDirSize > size ||
+            ReadLittleEndian<uint32_t>(data + zip64_eocd_offset) !=
+                    kZip64EndOfCentralDirSignature) {
+            utility::LogError("LoadNpz: {} has a corrupted zip64 record.",
+                              file_name);
+        }
+        num_entries = ReadLittleEndian<uint64_t>(data + zip64_eocd_offset + 32);
+        cd_offset = ReadLittleEndian<uint64_t>(data + zip64_eocd_offset + 48);
+    }
+
+    std::unordered_map<std::string, NumpyArray> arrays;
+    int64_t entry_offset = cd_offset;
+    for (int64_t i = 0; i < num_entries; ++i) {
+        const char* entry = data + entry_offset;
+        if (entry_offset + kZipCentralHeaderSize > size ||
+            ReadLittleEndian<uint32_t>(entry) != kZipCentralHeaderSignature) {
+            utility::LogError("LoadNpz: {} has a corrupted central directory.",
+                              file_name);
+        }
+        uint16_t method = ReadLittleEndian<uint16_t>(entry + 10);
+        int64_t compressed_size = ReadLittleEndian<uint32_t>(entry + 20);
+        int64_t uncompressed_size = ReadLittleEndian<uint32_t>(entry + 24);
+        int64_t name_size = ReadLittleEndian<uint16_t>(entry + 28);
+        int64_t extra_size = ReadLittleEndian<uint16_t>(entry + 30);
+        int64_t comment_size = ReadLittleEndian<uint16_t>(entry + 32);
+        int64_t local_offset = ReadLittleEndian<uint32_t>(entry + 42);
+        std::string name(entry + kZipCentralHeaderSize,
+                         static_cast<size_t>(name_size));
+
+        // Sizes and offsets that do not fit into 32 bits are stored in the
+        // zip64 extra field, in this order.
+        const char* extra = entry + kZipCentralHeaderSize + name_size;
+        const char* extra_end = extra + extra_size;
+        while (extra + 4 <= extra_end) {
+            uint16_t field_id = ReadLittleEndian<uint16_t>(extra);
+            uint16_t field_size = ReadLittleEndian<uint16_t>(extra + 2);
+            if (field_id == kZip64ExtraFieldId) {
+                const char* field = extra + 4;
+                for (int64_t* value :
+                     {&uncompressed_size, &compressed_size, &local_offset}) {
+                    if (*value == kZip64Marker) {
+                        *value = ReadLittleEndian<uint64_t>(field);
+                        field += 8;
+                    }
+                }
+            }
+            extra += 4 + field_size;
+        }
+        entry_offset += kZipCentralHeaderSize + name_size + extra_size +
+                        comment_size;
+
+        const char* local = data + local_offset;
+        if (local_offset + kZipLocalHeaderSize > size ||
+            ReadLittleEndian<uint32_t>(local) != kZipLocalHeaderSignature) {
+            utility::LogError("LoadNpz: {} has a corrupted entry {}.",
+                              file_name, name);
+        }
+        int64_t data_offset = local_offset + kZipLocalHeaderSize +
+                              ReadLittleEndian<uint16_t>(local + 26) +
+                              ReadLittleEndian<uint16_t>(local + 28);
+        if (data_offset + compressed_size > size) {
+            utility::LogError("LoadNpz: {} has a truncated entry {}.",
+                              file_name, name);
+        }
+
+        std::string key = name;
+        if (key.size() > 4 && key.substr(key.size() - 4) == ".npy") {
+            key = key.substr(0, key.size() - 4);
+        }
+        std::string entry_name = file_name + ":" + name;
+        if (method == 0) {
+            arrays.emplace(key, ParseNumpyBuffer(
+                                        data + data_offset, compressed_size,
+                                        memory_mapped ? file : nullptr,
+                                        entry_name));
+        } else if (method == Z_DEFLATED) {
+            std::shared_ptr<Blob> inflated =
+                    Inflate(data + data_offset, compressed_size,
+                            uncompressed_size, entry_name);
+            arrays.emplace(key,
+                           ParseNumpyBuffer(
+                                   static_cast<char*>(inflated->GetDataPtr()),
+                                   uncompressed_size, inflated, entry_name));
+        } else {
+            utility::LogError("LoadNpz: {} uses unsupported compression {}.",
+                              entry_name, method);
+        }
+    }
+    return arrays;
+}
+
+void NumpyArray::SaveNpz(
+        const std::string& file_name,
+        const std::unordered_map<std::string, NumpyArray>& arrays) {
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("SaveNpz: Unable to open file {}.", file_name);
+    }
+    // 1980-01-01 00:00:00 in MS-DOS format.
+    const uint16_t dos_time = 0;
+    const uint16_t dos_date = (1 << 5) | 1;
+
+    std::vector<char> central_dir;
+    int64_t offset = 0;
+    for (const auto& kv : arrays) {
+        const std::string name = kv.first + ".npy";
+        const NumpyArray& arr = kv.second;
+        std::vector<char> header =
+                CreateNumpyHeader(arr.shape_, arr.GetDtype());
+        const char* arr_data = arr.GetDataPtr<char>();
+        int64_t entry_size = static_cast<int64_t>(header.size()) +
+                             arr.NumBytes();
+        uint32_t crc = ComputeCRC32(0, header.data(), header.size());
+        crc = ComputeCRC32(crc, arr_data, arr.NumBytes());
+        bool zip64 = entry_size >= kZip64Marker || offset >= kZip64Marker;
+        uint16_t version = zip64 ? 45 : 20;
+        uint32_t entry_size_32 =
+                zip64 ? kZip64Marker : static_cast<uint32_t>(entry_size);
+        // Pad the local header so that the array data is aligned in the file.
+        int64_t unpadded_data_offset =
+                offset + kZipLocalHeaderSize +
+                static_cast<int64_t>(name.size()) + (zip64 ? 20 : 0) + 4 +
+                static_cast<int64_t>(header.size());
+        uint16_t padding = static_cast<uint16_t>(
+                (kNpzDataAlignment - unpadded_data_offset % kNpzDataAlignment) %
+                kNpzDataAlignment);
+
+        std::vector<char> local;
+        WriteLittleEndian<uint32_t>(local, kZipLocalHeaderSignature);
+        WriteLittleEndian<uint16_t>(local, version);
+        WriteLittleEndian<uint16_t>(local, 0);  // Flags.
+        WriteLittleEndian<uint16_t>(local, 0);  // Stored.
+        WriteLittleEndian<uint16_t>(local, dos_time);
+        WriteLittleEndian<uint16_t>(local, dos_date);
+        WriteLittleEndian<uint32_t>(local, crc);
+        WriteLittleEndian<uint32_t>(local, entry_size_32);
+        WriteLittleEndian<uint32_t>(local, entry_size_32);
+        WriteLittleEndian<uint16_t>(local, static_cast<uint16_t>(name.size()));
+        WriteLittleEndian<uint16_t>(local, (zip64 ? 20 : 0) + 4 + padding);
+        local.insert(local.end(), name.begin(), name.end());
+        if (zip64) {
+            WriteLittleEndian<uint16_t>(local, kZip64ExtraFieldId);
+            WriteLittleEndian<uint16_t>(local, 16);
+            WriteLittleEndian<uint64_t>(local, entry_size);
+            WriteLittleEndian<uint64_t>(local, entry_size);
+        }
+        WriteLittleEndian<uint16_t>(local, kZipPaddingExtraFieldId);
+        WriteLittleEndian<uint16_t>(local, padding);
+        local.insert(local.end(), padding, 0);
+
+        WriteLittleEndian<uint32_t>(central_dir, kZipCentralHeaderSignature);
+        WriteLittleEndian<uint16_t>(central_dir, version);
+        WriteLittleEndian<uint16_t>(central_dir, version);
+        WriteLittleEndian<uint16_t>(central_dir, 0);  // Flags.
+        WriteLittleEndian<uint16_t>(central_dir, 0);  // Stored.
+        WriteLittleEndian<uint16_t>(central_dir, dos_time);
+        WriteLittleEndian<uint16_t>(central_dir, dos_date);
+        WriteLittleEndian<uint32_t>(central_dir, crc);
+        WriteLittleEndian<uint32_t>(central_dir, entry_size_32);
+        WriteLittleEndian<uint32_t>(central_dir, entry_size_32);
+        WriteLittleEndian<uint16_t>(central_dir,
+                                    static_cast<uint16_t>(name.size()));
+        WriteLittleEndian<uint16_t>(central_dir, zip64 ? 28 : 0);
+        WriteLittleEndian<uint16_t>(central_dir, 0);  // Comment size.
+        WriteLittleEndian<uint16_t>(central_dir, 0);  // Disk number.
+        WriteLittleEndian<uint16_t>(central_dir, 0);  // Internal attributes.
+        WriteLittleEndian<uint32_t>(central_dir, 0);  // External attributes.
+        WriteLittleEndian<uint32_t>(
+                central_dir,
+                zip64 ? kZip64Marker : static_cast<uint32_t>(offset));
+        central_dir.insert(central_dir.end(), name.begin(), name.end());
+        if (zip64) {
+            WriteLittleEndian<uint16_t>(central_dir, kZip64ExtraFieldId);
+            WriteLittleEndian<uint16_t>(central_dir, 24);
+            WriteLittleEndian<uint64_t>(central_dir, entry_size);
+            WriteLittleEndian<uint64_t>(central_dir, entry_size);
+            WriteLittleEndian<uint64_t>(central_dir, offset);
+        }
+
+        fwrite(local.data(), 1, local.size(), fp);
+        fwrite(header.data(), 1, header.size(), fp);
+        fwrite(arr_data, 1, static_cast<size_t>(arr.NumBytes()), fp);
+        offset += static_cast<int64_t>(local.size()) + entry_size;
+    }
+
+    const int64_t cd_offset = offset;
+    const int64_t cd_size = static_cast<int64_t>(central_dir.size());
+    const int64_t num_entries = static_cast<int64_t>(arrays.size());
+    std::vector<char> end_records;
+    bool zip64 = num_entries >= 0xffff || cd_offset >= kZip64Marker ||
+                 cd_size >= kZip64Marker;
+    if (zip64) {
+        WriteLittleEndian<uint32_t>(end_records,
+                                    kZip64EndOfCentralDirSignature);
+        WriteLittleEndian<uint64_t>(end_records,
+                                    kZip64EndOfCentralDirSize - 12);
+        WriteLittleEndian<uint16_t>(end_records, 45);  // Version made by.
+        WriteLittleEndian<uint16_t>(end_records, 45);  // Version needed.
+        WriteLittleEndian<uint32_t>(end_records, 0);   // Disk number.
+        WriteLittleEndian<uint32_t>(end_records, 0);   // Disk with the CD.
+        WriteLittleEndian<uint64_t>(end_records, num_entries);
+        WriteLittleEndian<uint64_t>(end_records, num_entries);
+        WriteLittleEndian<uint64_t>(end_records, cd_size);
+        WriteLittleEndian<uint64_t>(end_records, cd_offset);
+
+        WriteLittleEndian<uint32_t>(end_records,
+                                    kZip64EndOfCentralDirLocatorSignature);
+        WriteLittleEndian<uint32_t>(end_records, 0);
+        WriteLittleEndian<uint64_t>(end_records, cd_offset + cd_size);
+        WriteLittleEndian<uint32_t>(end_records, 1);  // Number of disks.
+    }
+    WriteLittleEndian<uint32_t>(end_records, kZipEndOfCentralDirSignature);
+    WriteLittleEndian<uint16_t>(end_records, 0);
+    WriteLittleEndian<uint16_t>(end_records, 0);
+    WriteLittleEndian<uint16_t>(
+            end_records,
+            zip64 ? 0xffff : static_cast<uint16_t>(num_entries));
+    WriteLittleEndian<uint16_t>(
+            end_records,
+            zip64 ? 0xffff : static_cast<uint16_t>(num_entries));
+    WriteLittleEndian<uint32_t>(
+            end_records, zip64 ? kZip64Marker : static_cast<uint32_t>(cd_size));
+    WriteLittleEndian<uint32_t>(
+            end_records,
+            zip64 ? kZip64Marker : static_cast<uint32_t>(cd_offset));
+    WriteLittleEndian<uint16_t>(end_records, 0);  // Comment size.
+
+    fwrite(central_dir.data(), 1, central_dir.size(), fp);
+    fwrite(end_records.data(), 1, end_records.size(), fp);
+    fclose(fp);
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include "open3d/core/Blob.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -45,6 +49,13 @@ public:
                int64_t word_size,
                bool fortran_order);
 
+    /// Wraps existing memory. blob->GetDataPtr() points to the first element.
+    NumpyArray(const SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<Blob>& blob);
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -67,8 +78,25 @@ public:
 
     static NumpyArray Load(const std::string& file_name);
 
+    /// Maps a .npy file into memory instead of reading it. The data is paged
+    /// in lazily on first access. Writes to the array are private to the
+    /// process and are not written back to the file.
+    static NumpyArray LoadMemoryMapped(const std::string& file_name);
+
     void Save(std::string file_name) const;
 
+    /// Loads all arrays in a .npz archive, keyed by the array name without
+    /// the ".npy" suffix. If \p memory_mapped is true, uncompressed entries
+    /// (np.savez) refer to the mapped archive directly. Compressed entries
+    /// (np.savez_compressed) are always inflated into memory.
+    static std::unordered_map<std::string, NumpyArray> LoadNpz(
+            const std::string& file_name, bool memory_mapped = false);
+
+    /// Saves arrays as an uncompressed .npz archive, same as np.savez.
+    static void SaveNpz(
+            const std::string& file_name,
+            const std::unordered_map<std::string, NumpyArray>& arrays);
+
 private:
     std::shared_ptr<Blob> blob_ = nullptr;
     SizeVector shape_;
@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace core {
+
+std::atomic<bool> Profiler::enabled_(false);
+
+namespace {
+
+/// Recorded events and the clock of the profiler.
+struct ProfilerState {
+    std::mutex mutex;
+    std::vector<ProfilerEvent> events;
+    std::unordered_map<std::thread::id, int64_t> thread_ids;
+    /// Ticks of the steady clock at the last Reset(). Atomic, so that Now()
+    /// needs no lock.
+    std::atomic<std::chrono::steady_clock::rep> origin{
+            std::chrono::steady_clock::now().time_since_epoch().count()};
+};
+
+ProfilerState& GetState() {
+    static ProfilerState state;
+    return state;
+}
+
+/// Escapes a string for a JSON string literal.
+std::string JsonEscape(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+/// Formats a byte count with a binary unit, e.g. "1.5 MiB".
+std::string FormatBytes(double bytes) {
+    const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    int unit = 0;
+    while (bytes >= 1024 && unit < 4) {
+        bytes /= 1024;
+        ++unit;
+    }
+    return fmt::format("{:.1f} {}", bytes, units[unit]);
+}
+
+}  // namespace
+
+void Profiler::Enable() { enabled_.store(true); }
+
+void Profiler::Disable() { enabled_.store(false); }
+
+void Profiler::Reset() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.events.clear();
+    state.thread_ids.clear();
+    state.origin.store(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+std::vector<ProfilerEvent> Profiler::GetEvents() {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.events;
+}
+
+void Profiler::Record(ProfilerEvent&& event) {
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto it = state.thread_ids
+                      .emplace(std::this_thread::get_id(),
+                               static_cast<int64_t>(state.thread_ids.size()))
+                      .first;
+    event.thread_id = it->second;
+    state.events.push_back(std::move(event));
+}
+
+double Profiler::Now() {
+    ProfilerState& state = GetState();
+    std::chrono::steady_clock::duration origin(state.origin.load());
+    return std::chrono::duration<double, std::micro>(
+                   std::chrono::steady_clock::now().time_since_epoch() - origin)
+            .count();
+}
+
+std::string Profiler::ToChromeTrace() {
+    std::vector<ProfilerEvent> events = GetEvents();
+    std::string json = "{\"traceEvents\": [\n";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfilerEvent& event = events[i];
+        json += fmt::format(
+                "{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", "
+                "\"ts\": {:.3f}, \"dur\": {:.3f}, \"pid\": 0, \"tid\": {}, "
+                "\"args\": {{\"shape\": \"{}\", \"dtype\": \"{}\", "
+                "\"device\": \"{}\", \"bytes\": {}}}}}{}\n",
+                JsonEscape(event.category + "::" + event.name),
+                JsonEscape(event.category), event.start_us,
+                event.duration_us, event.thread_id,
+                JsonEscape(event.shape.ToString()), event.dtype.ToString(),
+                event.device.ToString(), event.bytes,
+                i + 1 < events.size() ? "," : "");
+    }
+    json += "], \"displayTimeUnit\": \"ms\"}\n";
+    return json;
+}
+
+void Profiler::SaveChromeTrace(const std::string& file_name) {
+    std::string json = ToChromeTrace();
+    FILE* file = utility::filesystem::FOpen(file_name, "w");
+    if (file == nullptr) {
+        utility::LogError("Cannot open file {} for writing.", file_name);
+    }
+    size_t written = fwrite(json.data(), 1, json.size(), file);
+    fclose(file);
+    if (written != json.size()) {
+        utility::LogError("Failed to write the trace to {}.", file_name);
+    }
+}
+
+std::string Profiler::GetSummary() {
+    std::vector<ProfilerEvent> events = GetEvents();
+
+    // Ops may call other ops, e.g. a reduction copies its output. The self
+    // time of an op excludes the ops nested in it, so that the self times of
+    // all ops add up to the profiled time.
+    std::vector<size_t> order(events.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const ProfilerEvent& event_a = events[a];
+        const ProfilerEvent& event_b = events[b];
+        if (event_a.thread_id != event_b.thread_id) {
+            return event_a.thread_id < event_b.thread_id;
+        }
+        if (event_a.start_us != event_b.start_us) {
+            return event_a.start_us < event_b.start_us;
+        }
+        return event_a.duration_us > event_b.duration_us;
+    });
+    std::vector<double> self_us(events.size());
+    std::vector<size_t> parents;
+    for (size_t i : order) {
+        const ProfilerEvent& event = events[i];
+        while (!parents.empty()) {
+            const ProfilerEvent& parent = events[parents.back()];
+            if (parent.thread_id == event.thread_id &&
+                event.start_us < parent.start_us + parent.duration_us) {
+                break;
+            }
+            parents.pop_back();
+        }
+        self_us[i] = event.duration_us;
+        if (!parents.empty()) {
+            self_us[parents.back()] -= event.duration_us;
+        }
+        parents.push_back(i);
+    }
+
+    struct OpStats {
+        int64_t calls = 0;
+        double total_us = 0;
+        double self_us = 0;
+        double bytes = 0;
+    };
+    std::map<std::string, OpStats> stats;
+    double profiled_us = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfilerEvent& event = events[i];
+        OpStats& op_stats = stats[event.category + "::" + event.name];
+        op_stats.calls++;
+        op_stats.total_us += event.duration_us;
+        op_stats.self_us += self_us[i];
+        op_stats.bytes += event.bytes;
+        profiled_us += self_us[i];
+    }
+    std::vector<std::pair<std::string, OpStats>> sorted(stats.begin(),
+                                                        stats.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const std::pair<std::string, OpStats>& a,
+                        const std::pair<std::string, OpStats>& b) {
+                         return a.second.self_us > b.second.self_us;
+                     });
+
+    std::string summary = fmt::format(
+            "{:<32} {:>8} {:>12} {:>12} {:>7} {:>12} {:>12} {:>10}\n", "Op",
+            "Calls", "Total (ms)", "Self (ms)", "Self %", "Mean (us)", "Bytes",
+            "GB/s");
+    for (const auto& op : sorted) {
+        const OpStats& op_stats = op.second;
+        summary += fmt::format(
+                "{:<32} {:>8} {:>12.3f} {:>12.3f} {:>7.1f} {:>12.2f} {:>12} "
+                "{:>10.2f}\n",
+                op.first, op_stats.calls, op_stats.total_us / 1000,
+                op_stats.self_us / 1000,
+                profiled_us > 0 ? 100 * op_stats.self_us / profiled_us : 0,
+                op_stats.total_us / op_stats.calls,
+                FormatBytes(op_stats.bytes),
+                op_stats.total_us > 0
+                        ? op_stats.bytes / op_stats.total_us / 1000
+                        : 0);
+    }
+    return summary;
+}
+
+void ProfilerScope::Start(const char* category,
+                          const char* name,
+                          std::initializer_list<const Tensor*> operands) {
+    event_.reset(new ProfilerEvent());
+    event_->category = category;
+    event_->name = name;
+    for (const Tensor* tensor : operands) {
+        event_->bytes += tensor->NumElements() * tensor->GetDtype().ByteSize();
+    }
+    if (operands.size() > 0) {
+        const Tensor* tensor = *operands.begin();
+        event_->shape = tensor->GetShape();
+        event_->dtype = tensor->GetDtype();
+        event_->device = tensor->GetDevice();
+    }
+    event_->start_us = Profiler::Now();
+}
+
+void ProfilerScope::Stop() {
+#ifdef BUILD_CUDA_MODULE
+    if (event_->device.GetType() == Device::DeviceType::CUDA) {
+        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    }
+#endif
+    event_->duration_us = Profiler::Now() - event_->start_us;
+    Profiler::Record(std::move(*event_));
+}
+
+}  // namespace core
+}  // namespace open3d
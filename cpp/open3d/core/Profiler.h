@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+
+namespace open3d {
+namespace core {
+
+class Tensor;
+
+/// A kernel op call recorded by the Profiler.
+struct ProfilerEvent {
+    /// Op family, e.g. "BinaryEW".
+    std::string category;
+    /// Op name within the family, e.g. "Add".
+    std::string name;
+    /// Shape, dtype and device of the main operand, usually the output.
+    SizeVector shape;
+    Dtype dtype;
+    Device device;
+    /// Bytes read and written by the op.
+    int64_t bytes = 0;
+    /// Start time in microseconds since the profiler was reset.
+    double start_us = 0;
+    /// Wall time of the op in microseconds. For CUDA ops, the device is
+    /// synchronized before the op ends.
+    double duration_us = 0;
+    /// Index of the calling thread, in order of the first recorded op.
+    int64_t thread_id = 0;
+};
+
+/// Records the kernel ops called by tensor operations, e.g. to find the ops
+/// that dominate a pipeline. The profiler is disabled by default, then an
+/// instrumented op only pays for one relaxed atomic load.
+///
+/// Example:
+///     core::Profiler::Enable();
+///     ... run the pipeline ...
+///     core::Profiler::Disable();
+///     utility::LogInfo("{}", core::Profiler::GetSummary());
+///     // Open in chrome://tracing or https://ui.perfetto.dev.
+///     core::Profiler::SaveChromeTrace("trace.json");
+class Profiler {
+public:
+    /// Starts recording ops. Events recorded before are kept, see Reset().
+    static void Enable();
+
+    /// Stops recording ops.
+    static void Disable();
+
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Discards the recorded events and restarts the clock.
+    static void Reset();
+
+    /// Returns the recorded events in the order they ended.
+    static std::vector<ProfilerEvent> GetEvents();
+
+    /// Returns the recorded events in the Chrome trace event JSON format.
+    static std::string ToChromeTrace();
+
+    /// Writes ToChromeTrace() to \p file_name.
+    static void SaveChromeTrace(const std::string& file_name);
+
+    /// Returns a table of the recorded ops aggregated by category and name,
+    /// with call count, total, self and mean time and bandwidth, sorted by
+    /// self time. The self time of an op excludes the ops it calls.
+    static std::string GetSummary();
+
+    /// Adds an event, used by ProfilerScope.
+    static void Record(ProfilerEvent&& event);
+
+    /// Returns the time in microseconds since the profiler was reset.
+    static double Now();
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+/// Records the op running during the lifetime of the scope if the Profiler is
+/// enabled. Placed in the kernel dispatchers:
+///
+///     ProfilerScope scope("BinaryEW", "Add", {&dst, &lhs, &rhs});
+class ProfilerScope {
+public:
+    /// \param category Op family, e.g. "BinaryEW".
+    /// \param name Op name within the family, e.g. "Add".
+    /// \param operands The tensors read or written by the op, the first one
+    /// is the main operand. The op moves the bytes of all operands.
+    ProfilerScope(const char* category,
+                  const char* name,
+                  std::initializer_list<const Tensor*> operands) {
+        if (Profiler::IsEnabled()) {
+            Start(category, name, operands);
+        }
+    }
+
+    /// \param category Op family, e.g. "IndexGetSet".
+    /// \param name Op name within the family, e.g. "IndexGet".
+    /// \param tensor The main operand.
+    /// \param bytes Bytes read and written by the op, for ops that only touch
+    /// part of their operands.
+    ProfilerScope(const char* category,
+                  const char* name,
+                  const Tensor& tensor,
+                  int64_t bytes) {
+        if (Profiler::IsEnabled()) {
+            Start(category, name, {&tensor});
+            event_->bytes = bytes;
+        }
+    }
+
+    ~ProfilerScope() {
+        if (event_) {
+            Stop();
+        }
+    }
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+    void Start(const char* category,
+               const char* name,
+               std::initializer_list<const Tensor*> operands);
+    void Stop();
+
+    std::unique_ptr<ProfilerEvent> event_;
+};
+
+}  // namespace core
+}  // namespace open3d
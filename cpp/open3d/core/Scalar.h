@@ -50,6 +50,14 @@ public:
         scalar_type_ = ScalarType::Double;
         value_.d = static_cast<double>(v);
     }
+    Scalar(Float16 v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
+    Scalar(BFloat16 v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
     Scalar(int v) {
         scalar_type_ = ScalarType::Int64;
         value_.i = static_cast<int64_t>(v);
@@ -26,6 +26,7 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -83,6 +84,10 @@ private:
             dl_data_type.code = DLDataTypeCode::kDLFloat;
         } else if (dtype == Dtype::Float64) {
             dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::Float16) {
+            dl_data_type.code = DLDataTypeCode::kDLFloat;
+        } else if (dtype == Dtype::BFloat16) {
+            dl_data_type.code = DLDataTypeCode::kDLBfloat;
         } else if (dtype == Dtype::Int32) {
             dl_data_type.code = DLDataTypeCode::kDLInt;
         } else if (dtype == Dtype::Int64) {
@@ -638,6 +643,30 @@ Tensor Tensor::Slice(int64_t dim,
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // Fast path for a boolean mask over the leading dimensions, e.g.
+    // points[mask].
+    if (index_tensors.size() == 1 &&
+        GetDevice().GetType() == Device::DeviceType::CPU) {
+        const Tensor& index = index_tensors[0];
+        const SizeVector index_shape = index.GetShape();
+        const bool same_device = index.GetDevice() == GetDevice();
+        if (index.GetDtype() == Dtype::Bool && same_device &&
+            index.NumDims() > 0 && index.NumDims() <= NumDims() &&
+            std::equal(index_shape.begin(), index_shape.end(),
+                       shape_.begin())) {
+            return kernel::MaskedSelect(*this, index);
+        }
+        // Fast path for gathering rows, e.g. points[indices].
+        if (index.GetDtype() == Dtype::Int64 && same_device &&
+            index.NumDims() == 1 && NumDims() > 0 && IsContiguous()) {
+            SizeVector dst_shape = shape_;
+            dst_shape[0] = index_shape[0];
+            Tensor dst(dst_shape, dtype_, GetDevice());
+            kernel::IndexGetRows(*this, dst, index.Contiguous());
+            return dst;
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -646,14 +675,85 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
     return dst;
 }
 
+Tensor Tensor::MaskedSelect(const Tensor& mask) const {
+    return kernel::MaskedSelect(*this, mask);
+}
+
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
+    // Fast path for scattering rows, e.g. points[indices] = values.
+    if (index_tensors.size() == 1 &&
+        GetDevice().GetType() == Device::DeviceType::CPU) {
+        const Tensor& index = index_tensors[0];
+        SizeVector src_shape = shape_;
+        if (NumDims() > 0) {
+            src_shape[0] = index.NumElements();
+        }
+        if (index.GetDtype() == Dtype::Int64 &&
+            index.GetDevice() == GetDevice() && index.NumDims() == 1 &&
+            NumDims() > 0 && IsContiguous() &&
+            src_tensor.GetDtype() == dtype_ &&
+            src_tensor.GetShape() == src_shape) {
+            kernel::IndexSetRows(src_tensor.To(GetDevice()).Contiguous(), *this,
+                                 index.Contiguous());
+            return;
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
     kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+/// Scatter reduction of IndexAdd_ and IndexMax_.
+static void IndexReduce(Tensor& dst,
+                        int64_t dim,
+                        const Tensor& index,
+                        const Tensor& src,
+                        kernel::ReductionOpCode op_code) {
+    index.AssertDtype(Dtype::Int64);
+    index.AssertDevice(dst.GetDevice());
+    src.AssertDtype(dst.GetDtype());
+    src.AssertDevice(dst.GetDevice());
+    if (dst.NumDims() == 0) {
+        utility::LogError("Cannot scatter into a 0-D tensor.");
+    }
+    dim = shape_util::WrapDim(dim, dst.NumDims());
+    SizeVector src_shape = dst.GetShape();
+    if (index.NumDims() != 1) {
+        utility::LogError("Index must be 1-D, but got shape {}.",
+                          index.GetShape().ToString());
+    }
+    src_shape[dim] = index.GetShape()[0];
+    if (src.GetShape() != src_shape) {
+        utility::LogError("Source shape {} does not match expected shape {}.",
+                          src.GetShape().ToString(), src_shape.ToString());
+    }
+
+    // The kernel reduces rows of contiguous tensors, other dimensions are
+    // moved to the front.
+    if (dim == 0 && dst.IsContiguous()) {
+        kernel::IndexReduce(src.Contiguous(), dst, index.Contiguous(),
+                            op_code);
+    } else {
+        Tensor dst_rows = dst.Transpose(0, dim).Contiguous();
+        kernel::IndexReduce(src.Transpose(0, dim).Contiguous(), dst_rows,
+                            index.Contiguous(), op_code);
+        dst.Transpose(0, dim).AsRvalue() = dst_rows;
+    }
+}
+
+Tensor Tensor::IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src) {
+    IndexReduce(*this, dim, index, src, kernel::ReductionOpCode::Sum);
+    return *this;
+}
+
+Tensor Tensor::IndexMax_(int64_t dim, const Tensor& index, const Tensor& src) {
+    IndexReduce(*this, dim, index, src, kernel::ReductionOpCode::Max);
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -729,6 +829,16 @@ double Tensor::Det() const {
     return static_cast<double>(D_[0][0].Item<float>());
 }
 
+/// Returns true if \p out can be written to in place by an op whose result
+/// has the given shape, dtype and device.
+static bool IsOutCompatible(const Tensor& out,
+                            const SizeVector& shape,
+                            Dtype dtype,
+                            const Device& device) {
+    return out.GetBlob() != nullptr && out.GetShape() == shape &&
+           out.GetDtype() == dtype && out.GetDevice() == device;
+}
+
 Tensor Tensor::Add(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -736,11 +846,39 @@ Tensor Tensor::Add(const Tensor& value) const {
     return dst_tensor;
 }
 
+Tensor Tensor::Add(Scalar scalar_value) const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Add(*this, scalar_value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Add(const Tensor& value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_util::BroadcastedShape(shape_, value.shape_),
+                        dtype_, GetDevice())) {
+        kernel::Add(*this, value, out);
+    } else {
+        out = Add(value);
+    }
+}
+
+void Tensor::Add(Scalar scalar_value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::Add(*this, scalar_value, out);
+    } else {
+        out = Add(scalar_value);
+    }
+}
+
 Tensor Tensor::Add_(const Tensor& value) {
     kernel::Add(*this, value, *this);
     return *this;
 }
 
+Tensor Tensor::Add_(Scalar scalar_value) {
+    kernel::Add(*this, scalar_value, *this);
+    return *this;
+}
+
 Tensor Tensor::Sub(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -748,11 +886,39 @@ Tensor Tensor::Sub(const Tensor& value) const {
     return dst_tensor;
 }
 
+Tensor Tensor::Sub(Scalar scalar_value) const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Sub(*this, scalar_value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Sub(const Tensor& value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_util::BroadcastedShape(shape_, value.shape_),
+                        dtype_, GetDevice())) {
+        kernel::Sub(*this, value, out);
+    } else {
+        out = Sub(value);
+    }
+}
+
+void Tensor::Sub(Scalar scalar_value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::Sub(*this, scalar_value, out);
+    } else {
+        out = Sub(scalar_value);
+    }
+}
+
 Tensor Tensor::Sub_(const Tensor& value) {
     kernel::Sub(*this, value, *this);
     return *this;
 }
 
+Tensor Tensor::Sub_(Scalar scalar_value) {
+    kernel::Sub(*this, scalar_value, *this);
+    return *this;
+}
+
 Tensor Tensor::Mul(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -760,11 +926,39 @@ Tensor Tensor::Mul(const Tensor& value) const {
     return dst_tensor;
 }
 
+Tensor Tensor::Mul(Scalar scalar_value) const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Mul(*this, scalar_value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Mul(const Tensor& value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_util::BroadcastedShape(shape_, value.shape_),
+                        dtype_, GetDevice())) {
+        kernel::Mul(*this, value, out);
+    } else {
+        out = Mul(value);
+    }
+}
+
+void Tensor::Mul(Scalar scalar_value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::Mul(*this, scalar_value, out);
+    } else {
+        out = Mul(scalar_value);
+    }
+}
+
 Tensor Tensor::Mul_(const Tensor& value) {
     kernel::Mul(*this, value, *this);
     return *this;
 }
 
+Tensor Tensor::Mul_(Scalar scalar_value) {
+    kernel::Mul(*this, scalar_value, *this);
+    return *this;
+}
+
 Tensor Tensor::Div(const Tensor& value) const {
     Tensor dst_tensor(shape_util::BroadcastedShape(shape_, value.shape_),
                       dtype_, GetDevice());
@@ -772,11 +966,39 @@ Tensor Tensor::Div(const Tensor& value) const {
     return dst_tensor;
 }
 
+Tensor Tensor::Div(Scalar scalar_value) const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Div(*this, scalar_value, dst_tensor);
+    return dst_tensor;
+}
+
+void Tensor::Div(const Tensor& value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_util::BroadcastedShape(shape_, value.shape_),
+                        dtype_, GetDevice())) {
+        kernel::Div(*this, value, out);
+    } else {
+        out = Div(value);
+    }
+}
+
+void Tensor::Div(Scalar scalar_value, Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::Div(*this, scalar_value, out);
+    } else {
+        out = Div(scalar_value);
+    }
+}
+
 Tensor Tensor::Div_(const Tensor& value) {
     kernel::Div(*this, value, *this);
     return *this;
 }
 
+Tensor Tensor::Div_(Scalar scalar_value) {
+    kernel::Div(*this, scalar_value, *this);
+    return *this;
+}
+
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -837,6 +1059,57 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::Sort() const { return kernel::Sort(*this); }
+
+Tensor Tensor::ArgSort() const { return kernel::ArgSort(*this); }
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    return kernel::Unique(*this);
+}
+
+static Tensor SegmentReduction(const Tensor& src,
+                               const Tensor& row_splits,
+                               kernel::ReductionOpCode op_code) {
+    if (src.NumDims() == 0 || row_splits.NumDims() != 1 ||
+        row_splits.GetShape()[0] == 0) {
+        utility::LogError(
+                "Expected a tensor with at least 1 dimension and 1-D "
+                "row_splits, but got shapes {} and {}.",
+                src.GetShape().ToString(), row_splits.GetShape().ToString());
+    }
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = row_splits.GetShape()[0] - 1;
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    kernel::SegmentReduction(src, dst, row_splits, op_code);
+    return dst;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& row_splits) const {
+    return SegmentReduction(*this, row_splits, kernel::ReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& row_splits) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError(
+                "Can only compute mean for Float32 or Float64, got {} instead.",
+                dtype_.ToString());
+    }
+    Tensor sum = SegmentSum(row_splits);
+    const int64_t num_segments = sum.GetShape()[0];
+    SizeVector counts_shape(NumDims(), 1);
+    counts_shape[0] = num_segments;
+    Tensor splits = row_splits.To(GetDevice());
+    Tensor counts = splits.Slice(0, 1, num_segments + 1)
+                            .Sub(splits.Slice(0, 0, num_segments))
+                            .To(dtype_)
+                            .Reshape(counts_shape);
+    return sum.Div_(counts);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& row_splits) const {
+    return SegmentReduction(*this, row_splits, kernel::ReductionOpCode::Max);
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -848,6 +1121,14 @@ Tensor Tensor::Sqrt_() {
     return *this;
 }
 
+void Tensor::Sqrt(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Sqrt);
+    } else {
+        out = Sqrt();
+    }
+}
+
 Tensor Tensor::Sin() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sin);
@@ -859,6 +1140,14 @@ Tensor Tensor::Sin_() {
     return *this;
 }
 
+void Tensor::Sin(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Sin);
+    } else {
+        out = Sin();
+    }
+}
+
 Tensor Tensor::Cos() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Cos);
@@ -870,6 +1159,14 @@ Tensor Tensor::Cos_() {
     return *this;
 }
 
+void Tensor::Cos(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Cos);
+    } else {
+        out = Cos();
+    }
+}
+
 Tensor Tensor::Neg() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Neg);
@@ -881,6 +1178,14 @@ Tensor Tensor::Neg_() {
     return *this;
 }
 
+void Tensor::Neg(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Neg);
+    } else {
+        out = Neg();
+    }
+}
+
 Tensor Tensor::Exp() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Exp);
@@ -892,6 +1197,14 @@ Tensor Tensor::Exp_() {
     return *this;
 }
 
+void Tensor::Exp(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Exp);
+    } else {
+        out = Exp();
+    }
+}
+
 Tensor Tensor::Abs() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Abs);
@@ -903,30 +1216,90 @@ Tensor Tensor::Abs_() {
     return *this;
 }
 
+void Tensor::Abs(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Abs);
+    } else {
+        out = Abs();
+    }
+}
+
 Tensor Tensor::Floor() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Floor);
     return dst_tensor;
 }
 
+Tensor Tensor::Floor_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Floor);
+    return *this;
+}
+
+void Tensor::Floor(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Floor);
+    } else {
+        out = Floor();
+    }
+}
+
 Tensor Tensor::Ceil() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Ceil);
     return dst_tensor;
 }
 
+Tensor Tensor::Ceil_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Ceil);
+    return *this;
+}
+
+void Tensor::Ceil(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Ceil);
+    } else {
+        out = Ceil();
+    }
+}
+
 Tensor Tensor::Round() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Round);
     return dst_tensor;
 }
 
+Tensor Tensor::Round_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Round);
+    return *this;
+}
+
+void Tensor::Round(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Round);
+    } else {
+        out = Round();
+    }
+}
+
 Tensor Tensor::Trunc() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Trunc);
     return dst_tensor;
 }
 
+Tensor Tensor::Trunc_() {
+    kernel::UnaryEW(*this, *this, kernel::UnaryEWOpCode::Trunc);
+    return *this;
+}
+
+void Tensor::Trunc(Tensor& out) const {
+    if (IsOutCompatible(out, shape_, dtype_, GetDevice())) {
+        kernel::UnaryEW(*this, out, kernel::UnaryEWOpCode::Trunc);
+    } else {
+        out = Trunc();
+    }
+}
+
 Device Tensor::GetDevice() const {
     if (blob_ == nullptr) {
         utility::LogError("Blob is null, cannot get device");
@@ -1146,6 +1519,9 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::Float16;
+                    break;
                 case 32:
                     dtype = Dtype::Float32;
                     break;
@@ -1157,6 +1533,16 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
                                       src->dl_tensor.dtype.bits);
             }
             break;
+        case DLDataTypeCode::kDLBfloat:
+            switch (src->dl_tensor.dtype.bits) {
+                case 16:
+                    dtype = Dtype::BFloat16;
+                    break;
+                default:
+                    utility::LogError("Unsupported kDLBfloat bits {}",
+                                      src->dl_tensor.dtype.bits);
+            }
+            break;
         default:
             utility::LogError("Unsupported dtype code {}",
                               src->dl_tensor.dtype.code);
@@ -1198,6 +1584,28 @@ Tensor Tensor::Load(const std::string& file_name) {
     return NumpyArray::Load(file_name).ToTensor();
 }
 
+Tensor Tensor::LoadMemoryMapped(const std::string& file_name) {
+    return NumpyArray::LoadMemoryMapped(file_name).ToTensor();
+}
+
+void Tensor::SaveNpz(const std::string& file_name,
+                     const std::unordered_map<std::string, Tensor>& tensors) {
+    std::unordered_map<std::string, NumpyArray> arrays;
+    for (const auto& kv : tensors) {
+        arrays.emplace(kv.first, NumpyArray(kv.second));
+    }
+    NumpyArray::SaveNpz(file_name, arrays);
+}
+
+std::unordered_map<std::string, Tensor> Tensor::LoadNpz(
+        const std::string& file_name, bool memory_mapped) {
+    std::unordered_map<std::string, Tensor> tensors;
+    for (const auto& kv : NumpyArray::LoadNpz(file_name, memory_mapped)) {
+        tensors.emplace(kv.first, kv.second.ToTensor());
+    }
+    return tensors;
+}
+
 bool Tensor::AllClose(const Tensor& other, double rtol, double atol) const {
     // TODO: support nan;
     return IsClose(other, rtol, atol).All();
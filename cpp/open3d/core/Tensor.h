@@ -30,7 +30,9 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/DLPack.h"
@@ -526,6 +528,14 @@ public:
     /// https://docs.scipy.org/doc/numpy/reference/arrays.indexing.html
     Tensor IndexGet(const std::vector<Tensor>& index_tensors) const;
 
+    /// \brief Boolean mask selection, same as IndexGet({mask}).
+    ///
+    /// The shape of the Bool \p mask must match the leading dimensions of the
+    /// tensor. Returns the selected slices, of shape
+    /// {num_true, shape[mask.NumDims():]...}. On CPU the slices are copied in
+    /// a single parallel pass without building index tensors.
+    Tensor MaskedSelect(const Tensor& mask) const;
+
     /// \brief Advanced indexing getter.
     ///
     /// We use the Numpy advanced indexing symnatics, see:
@@ -536,6 +546,21 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// \brief Scatter-add along dimension \p dim, in-place.
+    ///
+    /// For each i, adds the i-th slice of \p src along \p dim to the
+    /// index[i]-th slice of the tensor, e.g. for dim = 0
+    /// self[index[i], ...] += src[i, ...]. Repeated indices accumulate.
+    /// \p index is a 1-D Int64 tensor, \p src has the shape of the tensor
+    /// except for src.shape[dim] == index.shape[0].
+    Tensor IndexAdd_(int64_t dim, const Tensor& index, const Tensor& src);
+
+    /// \brief Scatter-max along dimension \p dim, in-place.
+    ///
+    /// Same as IndexAdd_, but keeps the maximum of the index[i]-th slice of
+    /// the tensor and the i-th slice of \p src.
+    Tensor IndexMax_(int64_t dim, const Tensor& index, const Tensor& src);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -579,102 +604,138 @@ public:
 
     /// Adds a tensor and returns the resulting tensor.
     Tensor Add(const Tensor& value) const;
+    /// Adds a scalar, which is passed by value to the kernel.
+    Tensor Add(Scalar scalar_value) const;
     template <typename T>
     Tensor Add(T scalar_value) const {
-        return Add(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Add(ToScalar(scalar_value));
     }
     Tensor operator+(const Tensor& value) const { return Add(value); }
     template <typename T>
     Tensor operator+(T scalar_value) const {
-        return Add(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Add(ToScalar(scalar_value));
     }
 
+    /// Output version of Tensor::Add. Writes the result to \p out, which is
+    /// only reallocated if its shape, dtype or device differ from the result.
+    /// \p out may be the current tensor or \p value.
+    void Add(const Tensor& value, Tensor& out) const;
+    void Add(Scalar scalar_value, Tensor& out) const;
+
     /// Inplace version of Tensor::Add. Adds a tensor to the current tensor and
     /// returns the current tensor.
     Tensor Add_(const Tensor& value);
+    Tensor Add_(Scalar scalar_value);
     template <typename T>
     Tensor Add_(T scalar_value) {
-        return Add_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Add_(ToScalar(scalar_value));
     }
     Tensor operator+=(const Tensor& value) { return Add_(value); }
     template <typename T>
     Tensor operator+=(T scalar_value) {
-        return Add_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Add_(ToScalar(scalar_value));
     }
 
     /// Substracts a tensor and returns the resulting tensor.
     Tensor Sub(const Tensor& value) const;
+    /// Substracts a scalar, which is passed by value to the kernel.
+    Tensor Sub(Scalar scalar_value) const;
     template <typename T>
     Tensor Sub(T scalar_value) const {
-        return Sub(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Sub(ToScalar(scalar_value));
     }
     Tensor operator-(const Tensor& value) const { return Sub(value); }
     template <typename T>
     Tensor operator-(T scalar_value) const {
-        return Sub(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Sub(ToScalar(scalar_value));
     }
 
+    /// Output version of Tensor::Sub. Writes the result to \p out, which is
+    /// only reallocated if its shape, dtype or device differ from the result.
+    /// \p out may be the current tensor or \p value.
+    void Sub(const Tensor& value, Tensor& out) const;
+    void Sub(Scalar scalar_value, Tensor& out) const;
+
     /// Inplace version of Tensor::Sub. Substracts a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Sub_(const Tensor& value);
+    Tensor Sub_(Scalar scalar_value);
     template <typename T>
     Tensor Sub_(T scalar_value) {
-        return Sub_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Sub_(ToScalar(scalar_value));
     }
     Tensor operator-=(const Tensor& value) { return Sub_(value); }
     template <typename T>
     Tensor operator-=(T scalar_value) {
-        return Sub_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Sub_(ToScalar(scalar_value));
     }
 
     /// Multiplies a tensor and returns the resulting tensor.
     Tensor Mul(const Tensor& value) const;
+    /// Multiplies a scalar, which is passed by value to the kernel.
+    Tensor Mul(Scalar scalar_value) const;
     template <typename T>
     Tensor Mul(T scalar_value) const {
-        return Mul(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Mul(ToScalar(scalar_value));
     }
     Tensor operator*(const Tensor& value) const { return Mul(value); }
     template <typename T>
     Tensor operator*(T scalar_value) const {
-        return Mul(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Mul(ToScalar(scalar_value));
     }
 
+    /// Output version of Tensor::Mul. Writes the result to \p out, which is
+    /// only reallocated if its shape, dtype or device differ from the result.
+    /// \p out may be the current tensor or \p value.
+    void Mul(const Tensor& value, Tensor& out) const;
+    void Mul(Scalar scalar_value, Tensor& out) const;
+
     /// Inplace version of Tensor::Mul. Multiplies a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Mul_(const Tensor& value);
+    Tensor Mul_(Scalar scalar_value);
     template <typename T>
     Tensor Mul_(T scalar_value) {
-        return Mul_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Mul_(ToScalar(scalar_value));
     }
     Tensor operator*=(const Tensor& value) { return Mul_(value); }
     template <typename T>
     Tensor operator*=(T scalar_value) {
-        return Mul_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Mul_(ToScalar(scalar_value));
     }
 
     /// Divides a tensor and returns the resulting tensor.
     Tensor Div(const Tensor& value) const;
+    /// Divides a scalar, which is passed by value to the kernel.
+    Tensor Div(Scalar scalar_value) const;
     template <typename T>
     Tensor Div(T scalar_value) const {
-        return Div(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Div(ToScalar(scalar_value));
     }
     Tensor operator/(const Tensor& value) const { return Div(value); }
     template <typename T>
     Tensor operator/(T scalar_value) const {
-        return Div(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Div(ToScalar(scalar_value));
     }
 
+    /// Output version of Tensor::Div. Writes the result to \p out, which is
+    /// only reallocated if its shape, dtype or device differ from the result.
+    /// \p out may be the current tensor or \p value.
+    void Div(const Tensor& value, Tensor& out) const;
+    void Div(Scalar scalar_value, Tensor& out) const;
+
     /// Inplace version of Tensor::Div. Divides a tensor to the current
     /// tensor and returns the current tensor.
     Tensor Div_(const Tensor& value);
+    Tensor Div_(Scalar scalar_value);
     template <typename T>
     Tensor Div_(T scalar_value) {
-        return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Div_(ToScalar(scalar_value));
     }
     Tensor operator/=(const Tensor& value) { return Div_(value); }
     template <typename T>
     Tensor operator/=(T scalar_value) {
-        return Div_(Tensor::Full({}, scalar_value, dtype_, GetDevice()));
+        return Div_(ToScalar(scalar_value));
     }
 
     /// Returns the sum of the tensor along the given \p dims.
@@ -722,54 +783,126 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the values of a 1-D tensor sorted in ascending order. Uses a
+    /// stable parallel radix sort, supports Int32, Int64, UInt8, UInt16,
+    /// Float32 and Float64. -0.0 sorts before 0.0.
+    Tensor Sort() const;
+
+    /// Returns the Int64 indices that sort a 1-D tensor in ascending order.
+    /// Equal values keep their original order.
+    Tensor ArgSort() const;
+
+    /// Returns the unique values of a 1-D tensor in ascending order, the Int64
+    /// indices of each element into the unique values, such that
+    /// values.IndexGet({inverse}) equals the tensor, and the Int64 counts of
+    /// each unique value.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// Returns the sums of the segments of rows [row_splits[i],
+    /// row_splits[i + 1]) of the tensor. \p row_splits is a 1-D Int64 tensor
+    /// from 0 to the number of rows, e.g. the prefix sum of the counts of
+    /// Unique() on sorted rows. The result has shape
+    /// {row_splits.shape[0] - 1, shape[1:]...}. Empty segments are 0.
+    Tensor SegmentSum(const Tensor& row_splits) const;
+
+    /// Returns the means of the segments of rows, see SegmentSum. Only
+    /// Float32 and Float64 are supported, empty segments are NaN.
+    Tensor SegmentMean(const Tensor& row_splits) const;
+
+    /// Returns the maxima of the segments of rows, see SegmentSum. Empty
+    /// segments are 0.
+    Tensor SegmentMax(const Tensor& row_splits) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
     /// Element-wise square root of a tensor, in-place.
     Tensor Sqrt_();
 
+    /// Output version of Tensor::Sqrt, reallocating \p out only if needed.
+    void Sqrt(Tensor& out) const;
+
     /// Element-wise sine of a tensor, returning a new tensor.
     Tensor Sin() const;
 
     /// Element-wise sine of a tensor, in-place.
     Tensor Sin_();
 
+    /// Output version of Tensor::Sin, reallocating \p out only if needed.
+    void Sin(Tensor& out) const;
+
     /// Element-wise cosine of a tensor, returning a new tensor.
     Tensor Cos() const;
 
     /// Element-wise cosine of a tensor, in-place.
     Tensor Cos_();
 
+    /// Output version of Tensor::Cos, reallocating \p out only if needed.
+    void Cos(Tensor& out) const;
+
     /// Element-wise negation of a tensor, returning a new tensor.
     Tensor Neg() const;
 
     /// Element-wise negation of a tensor, in-place.
     Tensor Neg_();
 
+    /// Output version of Tensor::Neg, reallocating \p out only if needed.
+    void Neg(Tensor& out) const;
+
     /// Element-wise exponential of a tensor, returning a new tensor.
     Tensor Exp() const;
 
     /// Element-wise base-e exponential of a tensor, in-place.
     Tensor Exp_();
 
+    /// Output version of Tensor::Exp, reallocating \p out only if needed.
+    void Exp(Tensor& out) const;
+
     /// Element-wise absolute value of a tensor, returning a new tensor.
     Tensor Abs() const;
 
     /// Element-wise absolute value of a tensor, in-place.
     Tensor Abs_();
 
+    /// Output version of Tensor::Abs, reallocating \p out only if needed.
+    void Abs(Tensor& out) const;
+
     /// Element-wise floor value of a tensor, returning a new tensor.
     Tensor Floor() const;
 
+    /// Element-wise floor value of a tensor, in-place.
+    Tensor Floor_();
+
+    /// Output version of Tensor::Floor, reallocating \p out only if needed.
+    void Floor(Tensor& out) const;
+
     /// Element-wise ceil value of a tensor, returning a new tensor.
     Tensor Ceil() const;
 
+    /// Element-wise ceil value of a tensor, in-place.
+    Tensor Ceil_();
+
+    /// Output version of Tensor::Ceil, reallocating \p out only if needed.
+    void Ceil(Tensor& out) const;
+
     /// Element-wise round value of a tensor, returning a new tensor.
     Tensor Round() const;
 
+    /// Element-wise round value of a tensor, in-place.
+    Tensor Round_();
+
+    /// Output version of Tensor::Round, reallocating \p out only if needed.
+    void Round(Tensor& out) const;
+
     /// Element-wise trunc value of a tensor, returning a new tensor.
     Tensor Trunc() const;
 
+    /// Element-wise trunc value of a tensor, in-place.
+    Tensor Trunc_();
+
+    /// Output version of Tensor::Trunc, reallocating \p out only if needed.
+    void Trunc(Tensor& out) const;
+
     /// Element-wise logical not of a tensor, returning a new boolean tensor.
     ///
     /// If the tensor is not boolean, 0 will be treated as False, while non-zero
@@ -1132,6 +1265,21 @@ public:
     /// Load tensor from numpy's npy format.
     static Tensor Load(const std::string& file_name);
 
+    /// Load tensor from numpy's npy format by memory mapping the file. No data
+    /// is read upfront, pages are loaded on first access, e.g. by slicing or
+    /// IndexGet. Modifications are private and not written back to the file.
+    static Tensor LoadMemoryMapped(const std::string& file_name);
+
+    /// Save tensors to numpy's uncompressed npz format, same as np.savez.
+    static void SaveNpz(const std::string& file_name,
+                        const std::unordered_map<std::string, Tensor>& tensors);
+
+    /// Load tensors from numpy's npz format, keyed by array name. If \p
+    /// memory_mapped is true, uncompressed arrays are memory mapped as in
+    /// LoadMemoryMapped().
+    static std::unordered_map<std::string, Tensor> LoadNpz(
+            const std::string& file_name, bool memory_mapped = false);
+
     /// Assert that the Tensor has the specified shape.
     void AssertShape(const SizeVector& expected_shape,
                      const std::string& error_msg = "") const;
@@ -1151,6 +1299,23 @@ public:
 protected:
     std::string ScalarPtrToString(const void* ptr) const;
 
+    /// Wraps a scalar operand in a Scalar. Integers of any width, e.g. size_t,
+    /// are widened to int64_t first.
+    template <typename T,
+              typename std::enable_if<std::is_integral<T>::value &&
+                                              !std::is_same<T, bool>::value,
+                                      int>::type = 0>
+    static Scalar ToScalar(T scalar_value) {
+        return Scalar(static_cast<int64_t>(scalar_value));
+    }
+    template <typename T,
+              typename std::enable_if<!std::is_integral<T>::value ||
+                                              std::is_same<T, bool>::value,
+                                      int>::type = 0>
+    static Scalar ToScalar(T scalar_value) {
+        return Scalar(scalar_value);
+    }
+
 protected:
     /// SizeVector of the Tensor. SizeVector[i] is the legnth of dimension
     /// i.
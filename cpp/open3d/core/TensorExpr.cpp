@@ -0,0 +1,304 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+struct TensorExpr::Node {
+    enum class Kind { Tensor, Scalar, Unary, Binary };
+
+    Kind kind_;
+    core::Tensor tensor_;
+    core::Scalar scalar_ = 0;
+    kernel::UnaryEWOpCode unary_op_code_ = kernel::UnaryEWOpCode::Neg;
+    kernel::BinaryEWOpCode binary_op_code_ = kernel::BinaryEWOpCode::Add;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+
+    SizeVector shape_;
+    Dtype dtype_;
+    Device device_;
+};
+
+/// Flattens an expression tree to a kernel::FusedEWProgram. Shared sub-trees
+/// are evaluated once and a tensor used several times is loaded once.
+class FusedEWProgramBuilder {
+public:
+    using Node = TensorExpr::Node;
+
+    FusedEWProgramBuilder(const std::shared_ptr<const Node>& root) {
+        // Registers of the instructions come after the inputs and scalars, so
+        // leaves are collected first.
+        CollectLeaves(root.get());
+        for (auto& kv : leaf_registers_) {
+            if (kv.first->kind_ == Node::Kind::Scalar) {
+                kv.second += inputs_.size();
+            }
+        }
+        EmitInstructions(root.get());
+    }
+
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+    const kernel::FusedEWProgram& GetProgram() const { return program_; }
+
+private:
+    void CollectLeaves(const Node* node) {
+        if (leaf_registers_.count(node)) {
+            return;
+        }
+        if (node->kind_ == Node::Kind::Tensor) {
+            int64_t input_idx = inputs_.size();
+            for (size_t i = 0; i < inputs_.size(); ++i) {
+                if (IsSameTensor(inputs_[i], node->tensor_)) {
+                    input_idx = i;
+                    break;
+                }
+            }
+            if (input_idx == static_cast<int64_t>(inputs_.size())) {
+                inputs_.push_back(node->tensor_);
+            }
+            leaf_registers_[node] = input_idx;
+        } else if (node->kind_ == Node::Kind::Scalar) {
+            // Offset by the number of inputs in the constructor.
+            leaf_registers_[node] = program_.scalars_.size();
+            program_.scalars_.push_back(node->scalar_);
+        } else {
+            CollectLeaves(node->lhs_.get());
+            if (node->kind_ == Node::Kind::Binary) {
+                CollectLeaves(node->rhs_.get());
+            }
+        }
+    }
+
+    int64_t EmitInstructions(const Node* node) {
+        auto it = leaf_registers_.find(node);
+        if (it != leaf_registers_.end()) {
+            return it->second;
+        }
+        it = instruction_registers_.find(node);
+        if (it != instruction_registers_.end()) {
+            return it->second;
+        }
+
+        kernel::FusedEWInstruction instruction;
+        instruction.lhs_ = EmitInstructions(node->lhs_.get());
+        if (node->kind_ == Node::Kind::Binary) {
+            instruction.is_binary_ = true;
+            instruction.binary_op_code_ = node->binary_op_code_;
+            instruction.rhs_ = EmitInstructions(node->rhs_.get());
+        } else {
+            instruction.unary_op_code_ = node->unary_op_code_;
+        }
+        int64_t reg = inputs_.size() + program_.scalars_.size() +
+                      program_.instructions_.size();
+        program_.instructions_.push_back(instruction);
+        instruction_registers_[node] = reg;
+        return reg;
+    }
+
+    static bool IsSameTensor(const Tensor& a, const Tensor& b) {
+        return a.GetDataPtr() == b.GetDataPtr() &&
+               a.GetShape() == b.GetShape() &&
+               a.GetStrides() == b.GetStrides() &&
+               a.GetDtype() == b.GetDtype() && a.GetDevice() == b.GetDevice();
+    }
+
+    std::vector<Tensor> inputs_;
+    kernel::FusedEWProgram program_;
+    std::unordered_map<const Node*, int64_t> leaf_registers_;
+    std::unordered_map<const Node*, int64_t> instruction_registers_;
+};
+
+static std::shared_ptr<const TensorExpr::Node> MakeUnaryNode(
+        const std::shared_ptr<const TensorExpr::Node>& src,
+        kernel::UnaryEWOpCode op_code) {
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->kind_ = TensorExpr::Node::Kind::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    return node;
+}
+
+static std::shared_ptr<const TensorExpr::Node> MakeBinaryNode(
+        const std::shared_ptr<const TensorExpr::Node>& lhs,
+        const std::shared_ptr<const TensorExpr::Node>& rhs,
+        kernel::BinaryEWOpCode op_code) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.", lhs->device_.ToString(),
+                          rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", lhs->dtype_.ToString(),
+                          rhs->dtype_.ToString());
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->kind_ = TensorExpr::Node::Kind::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    return node;
+}
+
+static std::shared_ptr<const TensorExpr::Node> MakeScalarNode(
+        Scalar scalar_value,
+        const std::shared_ptr<const TensorExpr::Node>& like) {
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->kind_ = TensorExpr::Node::Kind::Scalar;
+    node->scalar_ = scalar_value;
+    node->shape_ = {};
+    node->dtype_ = like->dtype_;
+    node->device_ = like->device_;
+    return node;
+}
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Tensor;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Add));
+}
+
+TensorExpr TensorExpr::Add(Scalar scalar_value) const {
+    return TensorExpr(MakeBinaryNode(node_, MakeScalarNode(scalar_value, node_),
+                                     kernel::BinaryEWOpCode::Add));
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Sub));
+}
+
+TensorExpr TensorExpr::Sub(Scalar scalar_value) const {
+    return TensorExpr(MakeBinaryNode(node_, MakeScalarNode(scalar_value, node_),
+                                     kernel::BinaryEWOpCode::Sub));
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Mul));
+}
+
+TensorExpr TensorExpr::Mul(Scalar scalar_value) const {
+    return TensorExpr(MakeBinaryNode(node_, MakeScalarNode(scalar_value, node_),
+                                     kernel::BinaryEWOpCode::Mul));
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(node_, value.node_, kernel::BinaryEWOpCode::Div));
+}
+
+TensorExpr TensorExpr::Div(Scalar scalar_value) const {
+    return TensorExpr(MakeBinaryNode(node_, MakeScalarNode(scalar_value, node_),
+                                     kernel::BinaryEWOpCode::Div));
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Sqrt));
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Sin));
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Cos));
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Neg));
+}
+
+TensorExpr TensorExpr::Exp() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Exp));
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Abs));
+}
+
+TensorExpr TensorExpr::Floor() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Floor));
+}
+
+TensorExpr TensorExpr::Ceil() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Ceil));
+}
+
+TensorExpr TensorExpr::Round() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Round));
+}
+
+TensorExpr TensorExpr::Trunc() const {
+    return TensorExpr(MakeUnaryNode(node_, kernel::UnaryEWOpCode::Trunc));
+}
+
+Tensor TensorExpr::Eval() const {
+    Tensor dst(GetShape(), GetDtype(), GetDevice());
+    Eval(dst);
+    return dst;
+}
+
+void TensorExpr::Eval(Tensor& dst) const {
+    if (dst.GetShape() != GetShape()) {
+        utility::LogError("Output shape {} does not match expression shape {}.",
+                          dst.GetShape(), GetShape());
+    }
+    FusedEWProgramBuilder builder(node_);
+    kernel::FusedEW(builder.GetInputs(), dst, builder.GetProgram());
+}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Lazily evaluated chain of arithmetic element-wise ops.
+///
+/// Each Tensor op, e.g. `a.Mul(b).Add(c).Sqrt()`, runs its own kernel and
+/// materializes a full temporary tensor. TensorExpr only records the ops. The
+/// whole chain is executed by Eval() in a single pass over the elements,
+/// without allocating the intermediate results.
+///
+/// Example:
+/// ```cpp
+/// Tensor d = TensorExpr(a).Mul(b).Add(c).Sqrt().Eval();
+/// ```
+///
+/// The operands must have the same dtype and device, and their shapes must be
+/// broadcastable. Supported ops are Add, Sub, Mul, Div and the non-boolean
+/// unary ops. At most MAX_INPUTS (10) distinct tensors can be used in one
+/// expression; scalar operands do not count.
+class TensorExpr {
+public:
+    /// Creates an expression that evaluates to \p tensor.
+    explicit TensorExpr(const Tensor& tensor);
+
+    /// Element-wise arithmetic ops. The ops are only recorded, computation is
+    /// deferred to Eval().
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Add(const Tensor& value) const { return Add(TensorExpr(value)); }
+    TensorExpr Add(Scalar scalar_value) const;
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Sub(const Tensor& value) const { return Sub(TensorExpr(value)); }
+    TensorExpr Sub(Scalar scalar_value) const;
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Mul(const Tensor& value) const { return Mul(TensorExpr(value)); }
+    TensorExpr Mul(Scalar scalar_value) const;
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Div(const Tensor& value) const { return Div(TensorExpr(value)); }
+    TensorExpr Div(Scalar scalar_value) const;
+
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    TensorExpr operator+(Scalar scalar_value) const {
+        return Add(scalar_value);
+    }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    TensorExpr operator-(Scalar scalar_value) const {
+        return Sub(scalar_value);
+    }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    TensorExpr operator*(Scalar scalar_value) const {
+        return Mul(scalar_value);
+    }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+    TensorExpr operator/(Scalar scalar_value) const {
+        return Div(scalar_value);
+    }
+
+    /// Element-wise unary ops, deferred to Eval(). Sqrt, Sin, Cos and Exp
+    /// require Float32 or Float64 operands.
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+    TensorExpr Floor() const;
+    TensorExpr Ceil() const;
+    TensorExpr Round() const;
+    TensorExpr Trunc() const;
+
+    /// Evaluates the expression into a new tensor.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into \p dst. \p dst must have the shape, dtype
+    /// and device of the expression. \p dst may be one of the operands.
+    void Eval(Tensor& dst) const;
+
+    SizeVector GetShape() const;
+    Dtype GetDtype() const;
+    Device GetDevice() const;
+
+public:
+    struct Node;
+
+private:
+    explicit TensorExpr(const std::shared_ptr<const Node>& node)
+        : node_(node) {}
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -26,7 +26,9 @@
 
 #include "open3d/core/TensorList.h"
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "open3d/core/SizeVector.h"
 
@@ -72,6 +74,24 @@ TensorList TensorList::FromTensor(const Tensor& tensor, bool inplace) {
     }
 }
 
+TensorList TensorList::Chunked(const SizeVector& element_shape,
+                               Dtype dtype,
+                               const Device& device,
+                               int64_t chunk_size) {
+    if (chunk_size <= 0) {
+        utility::LogError("Chunk size must be positive, but got {}.",
+                          chunk_size);
+    }
+    // The first chunk is allocated by the first append.
+    TensorList tensorlist(element_shape, 0, 0,
+                          Tensor(shape_util::Concat({0}, element_shape), dtype,
+                                 device),
+                          /*is_resizable=*/true);
+    tensorlist.is_chunked_ = true;
+    tensorlist.chunk_size_ = chunk_size;
+    return tensorlist;
+}
+
 TensorList TensorList::Clone() const {
     TensorList copied(*this);
     copied.CopyFrom(*this);
@@ -82,17 +102,96 @@ void TensorList::CopyFrom(const TensorList& other) {
     *this = other;
     // Copy the full other.internal_tensor_, not just other.AsTensor().
     internal_tensor_ = other.internal_tensor_.Clone();
+    for (Tensor& chunk : chunks_) {
+        chunk = chunk.Clone();
+    }
     // After copy, the resulting tensorlist is always resizable.
     is_resizable_ = true;
 }
 
 Tensor TensorList::AsTensor() const {
-    return internal_tensor_.Slice(0, 0, size_);
+    if (chunks_.empty()) {
+        return internal_tensor_.Slice(0, 0, size_);
+    }
+    return Gather(size_);
+}
+
+std::vector<Tensor> TensorList::GetChunks() const {
+    std::vector<Tensor> chunks = chunks_;
+    int64_t last_chunk_size = size_ - GetChunksSize();
+    if (last_chunk_size > 0) {
+        chunks.push_back(internal_tensor_.Slice(0, 0, last_chunk_size));
+    }
+    return chunks;
+}
+
+void TensorList::MakeContiguous() {
+    if (chunks_.empty()) {
+        return;
+    }
+    int64_t reserved_size = size_ + chunk_size_;
+    internal_tensor_ = Gather(reserved_size);
+    reserved_size_ = reserved_size;
+    chunks_.clear();
+    chunk_ends_.clear();
+}
+
+Tensor TensorList::AppendEmpty(int64_t count) {
+    AssertIsResizable(*this, __FUNCTION__);
+    if (count < 0) {
+        utility::LogError("Cannot append a negative number {} of elements.",
+                          count);
+    }
+
+    if (!is_chunked_) {
+        ResizeWithExpand(size_ + count);
+        return internal_tensor_.Slice(0, size_ - count, size_);
+    }
+
+    int64_t last_chunk_size = size_ - GetChunksSize();
+    if (last_chunk_size + count > reserved_size_) {
+        // Keep the filled part of the last chunk in place and continue in a
+        // new chunk.
+        if (last_chunk_size > 0) {
+            chunks_.push_back(internal_tensor_.Slice(0, 0, last_chunk_size));
+            chunk_ends_.push_back(size_);
+        }
+        reserved_size_ = std::max(count, chunk_size_);
+        internal_tensor_ =
+                Tensor(shape_util::Concat({reserved_size_}, element_shape_),
+                       GetDtype(), GetDevice());
+        last_chunk_size = 0;
+    }
+    size_ += count;
+    return internal_tensor_.Slice(0, last_chunk_size, last_chunk_size + count);
 }
 
 void TensorList::Resize(int64_t new_size) {
     AssertIsResizable(*this, __FUNCTION__);
 
+    if (is_chunked_) {
+        if (new_size >= size_) {
+            AppendEmpty(new_size - size_).Fill(0);
+            return;
+        }
+        // The kept part of the chunk containing the new end becomes the last
+        // chunk. It is full, so that the next append starts a new chunk
+        // instead of writing to memory that may be shared, e.g. with the
+        // inputs of Concat.
+        if (new_size < GetChunksSize()) {
+            size_t i = std::upper_bound(chunk_ends_.begin(), chunk_ends_.end(),
+                                        new_size) -
+                       chunk_ends_.begin();
+            internal_tensor_ = chunks_[i];
+            chunks_.resize(i);
+            chunk_ends_.resize(i);
+        }
+        reserved_size_ = new_size - GetChunksSize();
+        internal_tensor_ = internal_tensor_.Slice(0, 0, reserved_size_);
+        size_ = new_size;
+        return;
+    }
+
     // Increase internal tensor size.
     int64_t old_size = size_;
     ResizeWithExpand(new_size);
@@ -116,8 +215,7 @@ void TensorList::PushBack(const Tensor& tensor) {
                           GetDevice().ToString(),
                           tensor.GetDevice().ToString());
     }
-    ResizeWithExpand(size_ + 1);
-    internal_tensor_[size_ - 1] = tensor;  // same as operator[](-1) = tensor;
+    AppendEmpty(1)[0] = tensor;
 }
 
 void TensorList::Extend(const TensorList& other) {
@@ -137,14 +235,18 @@ void TensorList::Extend(const TensorList& other) {
                           GetDtype().ToString(), other.GetDtype().ToString());
     }
 
-    // Expand *this.
-    int64_t other_size = other.GetSize();
-    ResizeWithExpand(size_ + other_size);
+    // Needs to take the chunks of other before expanding *this, since *this
+    // and other can be the same tensorlist.
+    std::vector<Tensor> other_chunks = other.GetChunks();
+    Tensor dst = AppendEmpty(other.GetSize());
 
-    // Needs to slice other since *this and other can be the same tensorlist.
     // Assigning to a Tensor rvalue is an actual copy.
-    internal_tensor_.Slice(0, size_ - other_size, size_) =
-            other.AsTensor().Slice(0, 0, other_size);
+    int64_t offset = 0;
+    for (const Tensor& chunk : other_chunks) {
+        int64_t chunk_size = chunk.GetShape()[0];
+        dst.Slice(0, offset, offset + chunk_size) = chunk;
+        offset += chunk_size;
+    }
 }
 
 TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
@@ -154,18 +256,76 @@ TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
     return result;
 }
 
+TensorList TensorList::Concat(const std::vector<TensorList>& tensorlists,
+                              int64_t chunk_size) {
+    if (tensorlists.empty()) {
+        utility::LogError("Empty input tensorlists cannot be concatenated.");
+    }
+    const TensorList& first = tensorlists[0];
+    TensorList result = Chunked(first.GetElementShape(), first.GetDtype(),
+                                first.GetDevice(), chunk_size);
+    for (const TensorList& tensorlist : tensorlists) {
+        if (tensorlist.GetElementShape() != result.GetElementShape()) {
+            utility::LogError("TensorList shapes {} and {} are inconsistent.",
+                              result.GetElementShape(),
+                              tensorlist.GetElementShape());
+        }
+        if (tensorlist.GetDevice() != result.GetDevice()) {
+            utility::LogError("TensorList device {} and {} are inconsistent.",
+                              result.GetDevice().ToString(),
+                              tensorlist.GetDevice().ToString());
+        }
+        if (tensorlist.GetDtype() != result.GetDtype()) {
+            utility::LogError("TensorList dtype {} and {} are inconsistent.",
+                              result.GetDtype().ToString(),
+                              tensorlist.GetDtype().ToString());
+        }
+        // The chunks are sliced to their valid elements, so appending to the
+        // result never writes to them.
+        for (const Tensor& chunk : tensorlist.GetChunks()) {
+            result.size_ += chunk.GetShape()[0];
+            result.chunks_.push_back(chunk);
+            result.chunk_ends_.push_back(result.size_);
+        }
+    }
+    return result;
+}
+
 Tensor TensorList::operator[](int64_t index) const {
     // WrapDim asserts index is within range.
     index = shape_util::WrapDim(index, size_);
-    return internal_tensor_[index];
+    int64_t chunks_size = GetChunksSize();
+    if (index >= chunks_size) {
+        return internal_tensor_[index - chunks_size];
+    }
+    size_t i = std::upper_bound(chunk_ends_.begin(), chunk_ends_.end(), index) -
+               chunk_ends_.begin();
+    int64_t chunk_begin = i == 0 ? 0 : chunk_ends_[i - 1];
+    return chunks_[i][index - chunk_begin];
 }
 
 void TensorList::Clear() {
     AssertIsResizable(*this, __FUNCTION__);
-    *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    if (is_chunked_) {
+        *this = Chunked(element_shape_, GetDtype(), GetDevice(), chunk_size_);
+    } else {
+        *this = TensorList(element_shape_, GetDtype(), GetDevice());
+    }
 }
 
 // Protected
+Tensor TensorList::Gather(int64_t reserved_size) const {
+    Tensor gathered(shape_util::Concat({reserved_size}, element_shape_),
+                    GetDtype(), GetDevice());
+    int64_t offset = 0;
+    for (const Tensor& chunk : GetChunks()) {
+        int64_t chunk_size = chunk.GetShape()[0];
+        gathered.Slice(0, offset, offset + chunk_size) = chunk;
+        offset += chunk_size;
+    }
+    return gathered;
+}
+
 void TensorList::ResizeWithExpand(int64_t new_size) {
     int64_t new_reserved_size = ComputeReserveSize(new_size);
     if (new_reserved_size <= reserved_size_) {
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
@@ -55,6 +56,11 @@ namespace core {
 ///   - element_shape        : (8, 8, 8)
 ///   - reserved_size        : M, where M >= N
 ///   - internal_tensor.shape: (M, 8, 8, 8)
+///
+/// A chunked tensorlist, created with TensorList::Chunked, instead stores the
+/// Tensors in a sequence of internal tensors (chunks). Appending never moves
+/// the existing elements; when the last chunk is full, a new one is
+/// allocated. AsTensor() gathers the chunks into one tensor on demand.
 class TensorList {
 public:
     /// Useful to support operator[] in a map.
@@ -182,6 +188,18 @@ public:
     /// tensor values will be copied when creating the tensorlist.
     static TensorList FromTensor(const Tensor& tensor, bool inplace = false);
 
+    /// Factory function to create an empty chunked tensorlist.
+    ///
+    /// \param element_shape Shape of the contained tensors, e.g. {3,}.
+    /// \param dtype Data type of the contained tensors. e.g. Dtype::Float32.
+    /// \param device Device of the contained tensors. e.g. Device("CPU:0").
+    /// \param chunk_size Minimum number of elements of a newly allocated
+    /// chunk. A larger chunk is allocated if a single append needs more.
+    static TensorList Chunked(const SizeVector& element_shape,
+                              Dtype dtype,
+                              const Device& device = Device("CPU:0"),
+                              int64_t chunk_size = 4096);
+
     /// Copy constructor for tensorlist. The internal tensor will share the same
     /// memory as the input. Also see: the copy constructor for Tensor.
     TensorList(const TensorList& other) = default;
@@ -208,14 +226,34 @@ public:
     TensorList Clone() const;
 
     /// Return the reference of the contained valid tensors with shared memory.
+    /// If a chunked tensorlist has more than one chunk, the chunks are
+    /// gathered into a new tensor instead, see MakeContiguous().
     Tensor AsTensor() const;
 
+    /// Return the contained valid tensors as a list of tensors with shared
+    /// memory, one per chunk. Unlike AsTensor(), this never copies.
+    std::vector<Tensor> GetChunks() const;
+
+    /// Gather the chunks of a chunked tensorlist into a single internal
+    /// tensor, so that AsTensor() shares memory again. Following appends fill
+    /// the space reserved after the gathered elements first.
+    void MakeContiguous();
+
     /// Resize tensorlist.
     /// If the size increases, the increased part will be initialized with 0.
-    /// If the size decreases, the reserved_size_ remain unchanged. This
-    /// operation is only valid for resizable tensorlist.
+    /// If the size decreases, the reserved_size_ remain unchanged, unless the
+    /// tensorlist is chunked, in which case the next append starts a new
+    /// chunk. This operation is only valid for resizable tensorlist.
     void Resize(int64_t new_size);
 
+    /// Append \p count uninitialized elements to the tensorlist and return
+    /// them as a writable tensor of shape (count, *element_shape) with shared
+    /// memory, e.g. for a producer to write a batch into without an extra
+    /// copy. The returned tensor is valid until the tensorlist is resized
+    /// again, unless the tensorlist is chunked, in which case it stays valid.
+    /// This operation is only valid for resizable tensorlist.
+    Tensor AppendEmpty(int64_t count);
+
     /// Push back a tensor to the tensorlist. The values will be copied. This
     /// operation is only valid for resizable tensorlist.
     ///
@@ -235,6 +273,14 @@ public:
     /// Two tensorlists must have the same element_shape, type, and device.
     static TensorList Concatenate(const TensorList& a, const TensorList& b);
 
+    /// Concatenate tensorlists without copying. Returns a chunked tensorlist
+    /// whose chunks share memory with the input tensorlists, the data is only
+    /// gathered when required by AsTensor() or MakeContiguous(). Appending to
+    /// the result never writes to the memory of the inputs.
+    /// The tensorlists must have the same element_shape, dtype, and device.
+    static TensorList Concat(const std::vector<TensorList>& tensorlists,
+                             int64_t chunk_size = 4096);
+
     /// Concatenate two tensorlists.
     TensorList operator+(const TensorList& other) const {
         return Concatenate(*this, other);
@@ -284,10 +330,14 @@ public:
 
     int64_t GetReservedSize() const { return reserved_size_; }
 
+    /// Return the internal tensor. For a chunked tensorlist, this is the
+    /// last chunk, which elements are currently appended to.
     const Tensor& GetInternalTensor() const { return internal_tensor_; }
 
     bool IsResizable() const { return is_resizable_; }
 
+    bool IsChunked() const { return is_chunked_; }
+
 protected:
     /// Fully specified constructor.
     TensorList(const SizeVector element_shape,
@@ -315,6 +365,15 @@ protected:
     /// with reserved_size_ = (1 << (ceil(log2(size_)) + 1)).
     static int64_t ComputeReserveSize(int64_t size);
 
+    /// Number of elements in the full chunks before internal_tensor_.
+    int64_t GetChunksSize() const {
+        return chunk_ends_.empty() ? 0 : chunk_ends_.back();
+    }
+
+    /// Copy the valid elements into a new tensor with \p reserved_size
+    /// elements.
+    Tensor Gather(int64_t reserved_size) const;
+
 protected:
     /// The shape for each element tensor in the tensorlist.
     SizeVector element_shape_;
@@ -342,6 +401,20 @@ protected:
     /// created with pre-allocated shared buffer, the tensorlist is not
     /// resizable.
     bool is_resizable_ = true;
+
+    /// Whether the tensorlist is chunked. For a chunked tensorlist, the
+    /// elements [0, GetChunksSize()) are stored in chunks_, and the remaining
+    /// ones in internal_tensor_, which holds reserved_size_ elements.
+    bool is_chunked_ = false;
+
+    /// Minimum number of elements of a newly allocated chunk.
+    int64_t chunk_size_ = 0;
+
+    /// The full chunks, each sliced to its valid elements.
+    std::vector<Tensor> chunks_;
+
+    /// The end index of each of chunks_ in the tensorlist.
+    std::vector<int64_t> chunk_ends_;
 };
 }  // namespace core
 }  // namespace open3d
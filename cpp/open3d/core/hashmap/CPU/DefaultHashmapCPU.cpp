@@ -35,9 +35,11 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
-    return std::make_shared<CPUHashmap<DefaultHash, DefaultKeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+        const Device& device,
+        const HashmapBackend& backend) {
+    return CreateTemplateCPUHashmap<DefaultHash, DefaultKeyEq>(
+            init_buckets, init_capacity, dsize_key, dsize_value, device,
+            backend);
 }
 
 }  // namespace core
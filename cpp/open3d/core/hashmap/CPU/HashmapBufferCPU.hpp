@@ -46,14 +46,17 @@ public:
                             int64_t dsize_value,
                             Tensor &keys,
                             Tensor &values,
-                            Tensor &heap)
+                            Tensor &heap,
+                            bool clear_values = true)
         : capacity_(capacity),
           dsize_key_(dsize_key),
           dsize_value_(dsize_value),
           keys_(static_cast<uint8_t *>(keys.GetDataPtr())),
           values_(static_cast<uint8_t *>(values.GetDataPtr())),
           heap_(static_cast<addr_t *>(heap.GetDataPtr())) {
-        std::memset(values_, 0, capacity_ * dsize_value_);
+        if (clear_values) {
+            std::memset(values_, 0, capacity_ * dsize_value_);
+        }
     }
 
     void Reset() {
@@ -0,0 +1,685 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Open addressing hashmap for CPU.
+//
+// Slots are grouped into buckets of kGroupSize. Every slot has a one byte
+// control value, which is either kEmpty, kDeleted, kBusy (being inserted) or
+// a 7-bit tag from the key's hash. Lookups compare the tags of a whole bucket
+// at once with SIMD and only compare keys for matching tags. Keys and values
+// stay in the HashmapBuffer, a slot only stores the buffer address.
+//
+// Concurrent inserts claim empty slots with compare-and-swap. Slots are never
+// emptied again (erase leaves a tombstone), and an inserter never passes an
+// empty slot without trying to claim it, so two threads inserting the same
+// key always meet at the same slot. Tombstones are cleared by rebuilding the
+// index.
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OPEN3D_HASHMAP_SSE2
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "open3d/core/hashmap/CPU/HashmapBufferCPU.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace core {
+
+template <typename Hash, typename KeyEq>
+class CPULinearProbingHashmap : public DeviceHashmap<Hash, KeyEq> {
+public:
+    /// The bucket count is derived from \p init_capacity so that the table is
+    /// at most 7/8 full, \p init_buckets is only a lower bound.
+    CPULinearProbingHashmap(int64_t init_buckets,
+                            int64_t init_capacity,
+                            int64_t dsize_key,
+                            int64_t dsize_value,
+                            const Device& device);
+
+    ~CPULinearProbingHashmap();
+
+    /// Grows the index to at least \p buckets buckets. Unlike the other
+    /// backends, buffer addresses of existing keys are preserved.
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    int64_t Size() const override;
+
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    /// The heap, heap counter, control bytes, slot addresses and tombstone
+    /// count, all on the CPU.
+    std::unordered_map<std::string, Tensor> GetIndexTensors() override;
+
+    bool Attach(const Tensor& key_buffer,
+                const Tensor& value_buffer,
+                const std::unordered_map<std::string, Tensor>& index) override;
+
+protected:
+    static constexpr int64_t kGroupSize = 16;
+    static constexpr uint8_t kEmpty = 0x80;
+    static constexpr uint8_t kDeleted = 0xfe;
+    static constexpr uint8_t kBusy = 0xff;
+    // Maximum ratio of used slots, including tombstones, is 7/8.
+    static constexpr int64_t kMaxLoadNumerator = 7;
+    static constexpr int64_t kMaxLoadDenominator = 8;
+
+    static_assert(sizeof(std::atomic<uint8_t>) == 1,
+                  "std::atomic<uint8_t> must be 1 byte.");
+
+    Hash hash_fn_;
+    KeyEq cmp_fn_;
+
+    /// Control bytes of all slots, see kEmpty, kDeleted and kBusy. Stored in
+    /// a UInt8 tensor, so that the index can be saved and attached.
+    Tensor ctrl_buffer_;
+    std::atomic<uint8_t>* ctrl_ = nullptr;
+    /// Buffer address of the key in each full slot, in an Int32 tensor.
+    Tensor slot_addrs_buffer_;
+    addr_t* slot_addrs_ = nullptr;
+    int64_t num_tombstones_ = 0;
+
+    std::shared_ptr<CPUHashmapBufferContext> buffer_ctx_;
+
+    /// Post-mixes the user hash, the low 7 bits are used as the tag and the
+    /// rest selects the bucket.
+    uint64_t HashKey(const void* key) const;
+
+    /// Bitmask of the slots in \p group whose control byte equals \p value.
+    uint32_t MatchGroup(int64_t group, uint8_t value) const;
+
+    /// Bitmask of the slots in \p group that are empty, busy or tagged with
+    /// \p tag, taken from a single snapshot of the group. Separate snapshots
+    /// could miss a slot that turned from empty to busy to tagged in between.
+    uint32_t MatchInsertCandidates(int64_t group, uint8_t tag) const;
+
+    /// Index of the lowest set bit of a non-zero \p mask.
+    static int LowestBit(uint32_t mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    const void* GetKeyPtr(addr_t addr) const {
+        return buffer_ctx_->keys_ + addr * this->dsize_key_;
+    }
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    /// Makes room for \p count more keys, growing the buffer or rebuilding
+    /// the index when needed.
+    void Reserve(int64_t count);
+
+    /// Grows the key/value buffers to \p capacity, preserving addresses.
+    void GrowBuffer(int64_t capacity);
+
+    /// Rebuilds the index with \p buckets buckets from the active entries.
+    void RebuildIndex(int64_t buckets);
+
+    /// Minimum bucket count to hold \p capacity keys.
+    static int64_t MinBucketCount(int64_t capacity);
+};
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::CPULinearProbingHashmap(
+        int64_t init_buckets,
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap<Hash, KeyEq>(
+              init_buckets, init_capacity, dsize_key, dsize_value, device),
+      hash_fn_(dsize_key),
+      cmp_fn_(dsize_key) {
+    this->capacity_ = 0;
+    GrowBuffer(init_capacity);
+    RebuildIndex(init_buckets);
+}
+
+template <typename Hash, typename KeyEq>
+CPULinearProbingHashmap<Hash, KeyEq>::~CPULinearProbingHashmap() {}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::Size() const {
+    return buffer_ctx_->HeapCounter();
+}
+
+template <typename Hash, typename KeyEq>
+uint64_t CPULinearProbingHashmap<Hash, KeyEq>::HashKey(const void* key) const {
+    // Finalizer of MurmurHash3. FNV-style user hashes have poor low bits.
+    uint64_t hash = hash_fn_(key);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+    return hash;
+}
+
+template <typename Hash, typename KeyEq>
+uint32_t CPULinearProbingHashmap<Hash, KeyEq>::MatchGroup(int64_t group,
+                                                          uint8_t value) const {
+    const std::atomic<uint8_t>* ctrl = ctrl_ + group * kGroupSize;
+#ifdef OPEN3D_HASHMAP_SSE2
+    // A racy snapshot is fine: callers re-load matched slots atomically.
+    __m128i ctrl_vec =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    __m128i match = _mm_cmpeq_epi8(ctrl_vec, _mm_set1_epi8(char(value)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(match));
+#else
+    uint32_t mask = 0;
+    for (int64_t i = 0; i < kGroupSize; ++i) {
+        if (ctrl[i].load(std::memory_order_relaxed) == value) {
+            mask |= uint32_t(1) << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template <typename Hash, typename KeyEq>
+uint32_t CPULinearProbingHashmap<Hash, KeyEq>::MatchInsertCandidates(
+        int64_t group, uint8_t tag) const {
+    const std::atomic<uint8_t>* ctrl = ctrl_ + group * kGroupSize;
+#ifdef OPEN3D_HASHMAP_SSE2
+    __m128i ctrl_vec =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    __m128i match = _mm_or_si128(
+            _mm_cmpeq_epi8(ctrl_vec, _mm_set1_epi8(char(tag))),
+            _mm_or_si128(_mm_cmpeq_epi8(ctrl_vec, _mm_set1_epi8(char(kEmpty))),
+                         _mm_cmpeq_epi8(ctrl_vec, _mm_set1_epi8(char(kBusy)))));
+    return static_cast<uint32_t>(_mm_movemask_epi8(match));
+#else
+    uint32_t mask = 0;
+    for (int64_t i = 0; i < kGroupSize; ++i) {
+        uint8_t value = ctrl[i].load(std::memory_order_relaxed);
+        if (value == tag || value == kEmpty || value == kBusy) {
+            mask |= uint32_t(1) << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Insert(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Activate(const void* input_keys,
+                                                    addr_t* output_addrs,
+                                                    bool* output_masks,
+                                                    int64_t count) {
+    Reserve(count);
+    InsertImpl(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Find(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+    const int64_t group_mask = this->bucket_count_ - 1;
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const void* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+        uint64_t hash = HashKey(key);
+        uint8_t tag = static_cast<uint8_t>(hash & 0x7f);
+        int64_t group = static_cast<int64_t>(hash >> 7) & group_mask;
+
+        bool found = false;
+        addr_t addr = 0;
+        while (true) {
+            uint32_t matches = MatchGroup(group, tag);
+            while (matches != 0 && !found) {
+                int bit = LowestBit(matches);
+                matches &= matches - 1;
+                int64_t slot = group * kGroupSize + bit;
+                if (cmp_fn_(key, GetKeyPtr(slot_addrs_[slot]))) {
+                    found = true;
+                    addr = slot_addrs_[slot];
+                }
+            }
+            if (found || MatchGroup(group, kEmpty) != 0) {
+                break;
+            }
+            group = (group + 1) & group_mask;
+        }
+        output_masks[i] = found;
+        output_addrs[i] = addr;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Erase(const void* input_keys,
+                                                 bool* output_masks,
+                                                 int64_t count) {
+    const int64_t group_mask = this->bucket_count_ - 1;
+    int64_t num_erased = 0;
+#pragma omp parallel for reduction(+ : num_erased)
+    for (int64_t i = 0; i < count; ++i) {
+        const void* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+        uint64_t hash = HashKey(key);
+        uint8_t tag = static_cast<uint8_t>(hash & 0x7f);
+        int64_t group = static_cast<int64_t>(hash >> 7) & group_mask;
+
+        bool erased = false;
+        bool done = false;
+        while (!done) {
+            uint32_t matches = MatchGroup(group, tag);
+            while (matches != 0 && !done) {
+                int bit = LowestBit(matches);
+                matches &= matches - 1;
+                int64_t slot = group * kGroupSize + bit;
+                addr_t addr = slot_addrs_[slot];
+                if (cmp_fn_(key, GetKeyPtr(addr))) {
+                    // Duplicated keys in the input race for the same slot,
+                    // only one of them erases it.
+                    uint8_t expected = tag;
+                    erased = ctrl_[slot].compare_exchange_strong(
+                            expected, kDeleted, std::memory_order_acq_rel);
+                    if (erased) {
+                        buffer_ctx_->DeviceFree(addr);
+                    }
+                    done = true;
+                }
+            }
+            done = done || MatchGroup(group, kEmpty) != 0;
+            group = (group + 1) & group_mask;
+        }
+        output_masks[i] = erased;
+        num_erased += erased ? 1 : 0;
+    }
+    num_tombstones_ += num_erased;
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::GetActiveIndices(
+        addr_t* output_indices) {
+    // Two passes over blocks of buckets: count full slots per block, then
+    // write each block at its prefix sum offset.
+    const int64_t kBlockSize = 1024;
+    const int64_t num_blocks =
+            (this->bucket_count_ + kBlockSize - 1) / kBlockSize;
+    std::vector<int64_t> block_offsets(num_blocks + 1, 0);
+#pragma omp parallel for
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        int64_t group_end =
+                std::min((block + 1) * kBlockSize, this->bucket_count_);
+        int64_t block_count = 0;
+        for (int64_t slot = block * kBlockSize * kGroupSize;
+             slot < group_end * kGroupSize; ++slot) {
+            block_count += ctrl_[slot].load(std::memory_order_relaxed) < kEmpty;
+        }
+        block_offsets[block + 1] = block_count;
+    }
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        block_offsets[block + 1] += block_offsets[block];
+    }
+#pragma omp parallel for
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        int64_t group_end =
+                std::min((block + 1) * kBlockSize, this->bucket_count_);
+        int64_t offset = block_offsets[block];
+        for (int64_t slot = block * kBlockSize * kGroupSize;
+             slot < group_end * kGroupSize; ++slot) {
+            if (ctrl_[slot].load(std::memory_order_relaxed) < kEmpty) {
+                output_indices[offset++] = slot_addrs_[slot];
+            }
+        }
+    }
+    return block_offsets[num_blocks];
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Rehash(int64_t buckets) {
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(this->bucket_count_);
+    int64_t new_capacity =
+            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
+    if (new_capacity > this->capacity_) {
+        GrowBuffer(new_capacity);
+    }
+    RebuildIndex(buckets);
+}
+
+template <typename Hash, typename KeyEq>
+std::vector<int64_t> CPULinearProbingHashmap<Hash, KeyEq>::BucketSizes()
+        const {
+    std::vector<int64_t> ret(this->bucket_count_, 0);
+    for (int64_t slot = 0; slot < this->bucket_count_ * kGroupSize; ++slot) {
+        ret[slot / kGroupSize] +=
+                ctrl_[slot].load(std::memory_order_relaxed) < kEmpty;
+    }
+    return ret;
+}
+
+template <typename Hash, typename KeyEq>
+float CPULinearProbingHashmap<Hash, KeyEq>::LoadFactor() const {
+    return float(Size()) / float(this->bucket_count_);
+}
+
+template <typename Hash, typename KeyEq>
+std::unordered_map<std::string, Tensor>
+CPULinearProbingHashmap<Hash, KeyEq>::GetIndexTensors() {
+    return {{"heap", this->buffer_->GetHeap()},
+            {"heap_counter", Tensor::Init<int64_t>({Size()})},
+            {"ctrl", ctrl_buffer_},
+            {"slot_addrs", slot_addrs_buffer_},
+            {"num_tombstones", Tensor::Init<int64_t>({num_tombstones_})}};
+}
+
+template <typename Hash, typename KeyEq>
+bool CPULinearProbingHashmap<Hash, KeyEq>::Attach(
+        const Tensor& key_buffer,
+        const Tensor& value_buffer,
+        const std::unordered_map<std::string, Tensor>& index) {
+    for (const char* name :
+         {"heap", "heap_counter", "ctrl", "slot_addrs", "num_tombstones"}) {
+        if (index.count(name) == 0 ||
+            index.at(name).GetDevice() != this->device_ ||
+            !index.at(name).IsContiguous()) {
+            return false;
+        }
+    }
+    const Tensor& heap = index.at("heap");
+    const Tensor& ctrl = index.at("ctrl");
+    const Tensor& slot_addrs = index.at("slot_addrs");
+    int64_t capacity = heap.GetLength();
+    int64_t num_slots = ctrl.GetLength();
+    int64_t heap_counter = index.at("heap_counter").Item<int64_t>();
+    if (key_buffer.GetDtype().ByteSize() != this->dsize_key_ ||
+        value_buffer.GetDtype().ByteSize() != this->dsize_value_ ||
+        key_buffer.GetDevice() != this->device_ ||
+        value_buffer.GetDevice() != this->device_ ||
+        key_buffer.GetLength() != capacity ||
+        value_buffer.GetLength() != capacity ||
+        heap.GetDtype() != Dtype::Int32 || ctrl.GetDtype() != Dtype::UInt8 ||
+        slot_addrs.GetDtype() != Dtype::Int32 ||
+        slot_addrs.GetLength() != num_slots || num_slots % kGroupSize != 0 ||
+        (num_slots & (num_slots - 1)) != 0 || heap_counter < 0 ||
+        heap_counter > capacity) {
+        return false;
+    }
+
+    this->capacity_ = capacity;
+    this->bucket_count_ = num_slots / kGroupSize;
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(key_buffer, value_buffer, heap);
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap(), /*clear_values=*/false);
+    buffer_ctx_->heap_counter_ = static_cast<int>(heap_counter);
+    ctrl_buffer_ = ctrl;
+    ctrl_ = static_cast<std::atomic<uint8_t>*>(ctrl_buffer_.GetDataPtr());
+    slot_addrs_buffer_ = slot_addrs;
+    slot_addrs_ = static_cast<addr_t*>(slot_addrs_buffer_.GetDataPtr());
+    num_tombstones_ = index.at("num_tombstones").Item<int64_t>();
+    return true;
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::InsertImpl(const void* input_keys,
+                                                      const void* input_values,
+                                                      addr_t* output_addrs,
+                                                      bool* output_masks,
+                                                      int64_t count) {
+    const int64_t group_mask = this->bucket_count_ - 1;
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const void* key =
+                static_cast<const uint8_t*>(input_keys) + this->dsize_key_ * i;
+        uint64_t hash = HashKey(key);
+        uint8_t tag = static_cast<uint8_t>(hash & 0x7f);
+        int64_t group = static_cast<int64_t>(hash >> 7) & group_mask;
+
+        bool done = false;
+        bool inserted = false;
+        addr_t addr = 0;
+        while (!done) {
+            // Visit tag matches, empty and busy slots in slot order. The
+            // group is rescanned if another thread changed a slot under us.
+            uint32_t candidates = MatchInsertCandidates(group, tag);
+            bool rescan = false;
+            while (candidates != 0 && !done && !rescan) {
+                int bit = LowestBit(candidates);
+                candidates &= candidates - 1;
+                int64_t slot = group * kGroupSize + bit;
+                uint8_t ctrl = ctrl_[slot].load(std::memory_order_acquire);
+                if (ctrl == kBusy) {
+                    while (ctrl_[slot].load(std::memory_order_acquire) ==
+                           kBusy) {
+                        std::this_thread::yield();
+                    }
+                    rescan = true;
+                } else if (ctrl == tag) {
+                    if (cmp_fn_(key, GetKeyPtr(slot_addrs_[slot]))) {
+                        addr = slot_addrs_[slot];
+                        done = true;
+                    }
+                } else if (ctrl == kEmpty) {
+                    uint8_t expected = kEmpty;
+                    if (ctrl_[slot].compare_exchange_strong(
+                                expected, kBusy, std::memory_order_acq_rel)) {
+                        addr = buffer_ctx_->DeviceAllocate();
+                        std::memcpy(buffer_ctx_->keys_ +
+                                            addr * this->dsize_key_,
+                                    key, this->dsize_key_);
+                        slot_addrs_[slot] = addr;
+                        // Publish the key before copying the value, so that
+                        // duplicates waiting on this slot can proceed.
+                        ctrl_[slot].store(tag, std::memory_order_release);
+
+                        uint8_t* dst_value = buffer_ctx_->values_ +
+                                             addr * this->dsize_value_;
+                        if (input_values != nullptr) {
+                            std::memcpy(dst_value,
+                                        static_cast<const uint8_t*>(
+                                                input_values) +
+                                                this->dsize_value_ * i,
+                                        this->dsize_value_);
+                        } else {
+                            std::memset(dst_value, 0, this->dsize_value_);
+                        }
+                        inserted = true;
+                        done = true;
+                    } else {
+                        rescan = true;
+                    }
+                }
+            }
+            if (!done && !rescan) {
+                group = (group + 1) & group_mask;
+            }
+        }
+        output_addrs[i] = addr;
+        output_masks[i] = inserted;
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::Reserve(int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        GrowBuffer(std::max(this->capacity_ * 2, new_size));
+        RebuildIndex(MinBucketCount(this->capacity_));
+    } else if ((new_size + num_tombstones_) * kMaxLoadDenominator >
+               this->bucket_count_ * kGroupSize * kMaxLoadNumerator) {
+        // Clears the tombstones. The bucket count is enough for capacity_
+        // live keys.
+        RebuildIndex(this->bucket_count_);
+    }
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::GrowBuffer(int64_t capacity) {
+    int64_t old_capacity = this->capacity_;
+    std::shared_ptr<HashmapBuffer> old_buffer = this->buffer_;
+    std::shared_ptr<CPUHashmapBufferContext> old_buffer_ctx = buffer_ctx_;
+
+    this->capacity_ = capacity;
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferContext>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+    if (old_buffer_ctx == nullptr) {
+        return;
+    }
+
+    // Existing keys keep their addresses. The free list of the old heap is
+    // followed by the new addresses.
+    std::memcpy(buffer_ctx_->keys_, old_buffer_ctx->keys_,
+                old_capacity * this->dsize_key_);
+    std::memcpy(buffer_ctx_->values_, old_buffer_ctx->values_,
+                old_capacity * this->dsize_value_);
+    std::memcpy(buffer_ctx_->heap_, old_buffer_ctx->heap_,
+                old_capacity * sizeof(addr_t));
+    buffer_ctx_->heap_counter_ = old_buffer_ctx->HeapCounter();
+}
+
+template <typename Hash, typename KeyEq>
+void CPULinearProbingHashmap<Hash, KeyEq>::RebuildIndex(int64_t buckets) {
+    int64_t size = Size();
+    std::vector<addr_t> active_addrs(size);
+    if (size > 0) {
+        GetActiveIndices(active_addrs.data());
+    }
+
+    // Power of two bucket count for masking.
+    int64_t bucket_count = 1;
+    while (bucket_count < std::max(buckets, MinBucketCount(this->capacity_))) {
+        bucket_count *= 2;
+    }
+    this->bucket_count_ = bucket_count;
+    int64_t num_slots = bucket_count * kGroupSize;
+    ctrl_buffer_ = Tensor({num_slots}, Dtype::UInt8, this->device_);
+    ctrl_ = static_cast<std::atomic<uint8_t>*>(ctrl_buffer_.GetDataPtr());
+    slot_addrs_buffer_ =
+            Tensor::Zeros({num_slots}, Dtype::Int32, this->device_);
+    slot_addrs_ = static_cast<addr_t*>(slot_addrs_buffer_.GetDataPtr());
+    num_tombstones_ = 0;
+#pragma omp parallel for
+    for (int64_t slot = 0; slot < num_slots; ++slot) {
+        ctrl_[slot].store(kEmpty, std::memory_order_relaxed);
+    }
+
+    // Keys are known to be unique, so the first empty slot is claimed
+    // without comparing keys.
+    const int64_t group_mask = bucket_count - 1;
+#pragma omp parallel for
+    for (int64_t i = 0; i < size; ++i) {
+        addr_t addr = active_addrs[i];
+        uint64_t hash = HashKey(GetKeyPtr(addr));
+        uint8_t tag = static_cast<uint8_t>(hash & 0x7f);
+        int64_t group = static_cast<int64_t>(hash >> 7) & group_mask;
+        bool done = false;
+        while (!done) {
+            uint32_t empties = MatchGroup(group, kEmpty);
+            while (empties != 0 && !done) {
+                int bit = LowestBit(empties);
+                empties &= empties - 1;
+                int64_t slot = group * kGroupSize + bit;
+                uint8_t expected = kEmpty;
+                if (ctrl_[slot].compare_exchange_strong(
+                            expected, tag, std::memory_order_relaxed)) {
+                    slot_addrs_[slot] = addr;
+                    done = true;
+                }
+            }
+            group = (group + 1) & group_mask;
+        }
+    }
+}
+
+template <typename Hash, typename KeyEq>
+int64_t CPULinearProbingHashmap<Hash, KeyEq>::MinBucketCount(
+        int64_t capacity) {
+    int64_t min_slots =
+            (capacity * kMaxLoadDenominator + kMaxLoadNumerator - 1) /
+            kMaxLoadNumerator;
+    return std::max((min_slots + kGroupSize - 1) / kGroupSize, int64_t(1));
+}
+
+}  // namespace core
+}  // namespace open3d
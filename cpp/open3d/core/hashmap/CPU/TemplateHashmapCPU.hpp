@@ -27,20 +27,31 @@
 #pragma once
 
 #include "open3d/core/hashmap/CPU/HashmapCPU.h"
+#include "open3d/core/hashmap/CPU/LinearProbingHashmapCPU.h"
 
 namespace open3d {
 namespace core {
 
 /// Templated factory.
 template <typename Hash, typename KeyEq>
-std::shared_ptr<CPUHashmap<Hash, KeyEq>> CreateTemplateCPUHashmap(
+std::shared_ptr<DeviceHashmap<Hash, KeyEq>> CreateTemplateCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device) {
-    return std::make_shared<CPUHashmap<Hash, KeyEq>>(
-            init_buckets, init_capacity, dsize_key, dsize_value, device);
+        const Device& device,
+        const HashmapBackend& backend = HashmapBackend::Default) {
+    if (backend == HashmapBackend::Default ||
+        backend == HashmapBackend::LinearProbing) {
+        return std::make_shared<CPULinearProbingHashmap<Hash, KeyEq>>(
+                init_buckets, init_capacity, dsize_key, dsize_value, device);
+    } else if (backend == HashmapBackend::TBB) {
+        return std::make_shared<CPUHashmap<Hash, KeyEq>>(
+                init_buckets, init_capacity, dsize_key, dsize_value, device);
+    } else {
+        utility::LogError(
+                "[CreateTemplateCPUHashmap]: Unsupported CPU hashmap backend");
+    }
 }
 }  // namespace core
 }  // namespace open3d
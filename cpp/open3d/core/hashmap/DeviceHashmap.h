@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
 
 namespace open3d {
@@ -168,6 +172,23 @@ public:
     /// Return size / bucket_count.
     virtual float LoadFactor() const = 0;
 
+    /// Return the tensors that, together with the key and value buffers, hold
+    /// the full state of the hashmap, keyed by name. Empty if the backend
+    /// cannot be restored from them with Attach().
+    virtual std::unordered_map<std::string, Tensor> GetIndexTensors() {
+        return {};
+    }
+
+    /// Restore the state of a hashmap of the same backend from its key and
+    /// value buffers and the tensors returned by its GetIndexTensors(). The
+    /// tensors are adopted as storage without copying or rehashing. Returns
+    /// false if the backend or the device does not support it.
+    virtual bool Attach(const Tensor& key_buffer,
+                        const Tensor& value_buffer,
+                        const std::unordered_map<std::string, Tensor>& index) {
+        return false;
+    }
+
 public:
     int64_t bucket_count_;
     int64_t capacity_;
@@ -198,14 +219,16 @@ std::shared_ptr<DefaultDeviceHashmap> CreateDefaultDeviceHashmap(
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCPUHashmap(
         int64_t init_buckets,
         int64_t init_capacity,
         int64_t dsize_key,
         int64_t dsize_value,
-        const Device& device);
+        const Device& device,
+        const HashmapBackend& backend);
 
 std::shared_ptr<DefaultDeviceHashmap> CreateDefaultCUDAHashmap(
         int64_t init_buckets,
@@ -32,6 +32,10 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include "open3d/core/Profiler.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashmap.h"
 #include "open3d/utility/Console.h"
@@ -45,8 +49,10 @@ Hashmap::Hashmap(int64_t init_capacity,
                  const Dtype& dtype_value,
                  const SizeVector& element_shape_key,
                  const SizeVector& element_shape_value,
-                 const Device& device)
-    : dtype_key_(dtype_key),
+                 const Device& device,
+                 const HashmapBackend& backend)
+    : backend_(backend),
+      dtype_key_(dtype_key),
       dtype_value_(dtype_value),
       element_shape_key_(element_shape_key),
       element_shape_value_(element_shape_value) {
@@ -68,7 +74,7 @@ Hashmap::Hashmap(int64_t init_capacity,
             init_capacity,
             dtype_key.ByteSize() * element_shape_key_.NumElements(),
             dtype_value.ByteSize() * element_shape_value_.NumElements(),
-            device);
+            device, backend);
 }
 
 void Hashmap::Rehash(int64_t buckets) {
@@ -111,6 +117,9 @@ void Hashmap::Insert(const Tensor& input_keys,
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    ProfilerScope scope("Hashmap", "Insert",
+                        {&input_keys, &input_values, &output_addrs,
+                         &output_masks});
     device_hashmap_->Insert(input_keys.GetDataPtr(), input_values.GetDataPtr(),
                             static_cast<addr_t*>(output_addrs.GetDataPtr()),
                             static_cast<bool*>(output_masks.GetDataPtr()),
@@ -139,6 +148,8 @@ void Hashmap::Activate(const Tensor& input_keys,
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    ProfilerScope scope("Hashmap", "Activate",
+                        {&input_keys, &output_addrs, &output_masks});
     device_hashmap_->Activate(input_keys.GetDataPtr(),
                               static_cast<addr_t*>(output_addrs.GetDataPtr()),
                               static_cast<bool*>(output_masks.GetDataPtr()),
@@ -167,6 +178,8 @@ void Hashmap::Find(const Tensor& input_keys,
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
 
+    ProfilerScope scope("Hashmap", "Find",
+                        {&input_keys, &output_addrs, &output_masks});
     device_hashmap_->Find(input_keys.GetDataPtr(),
                           static_cast<addr_t*>(output_addrs.GetDataPtr()),
                           static_cast<bool*>(output_masks.GetDataPtr()), count);
@@ -190,6 +203,7 @@ void Hashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
     int64_t count = shape[0];
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    ProfilerScope scope("Hashmap", "Erase", {&input_keys, &output_masks});
     device_hashmap_->Erase(input_keys.GetDataPtr(),
                            static_cast<bool*>(output_masks.GetDataPtr()),
                            count);
@@ -210,8 +224,13 @@ Hashmap Hashmap::To(const Device& device, bool copy) const {
         return *this;
     }
 
+    // Backends are device specific, keep the backend on the same device type.
+    HashmapBackend backend = device.GetType() == GetDevice().GetType()
+                                     ? backend_
+                                     : HashmapBackend::Default;
     Hashmap new_hashmap(GetCapacity(), dtype_key_, dtype_value_,
-                        element_shape_key_, element_shape_value_, device);
+                        element_shape_key_, element_shape_value_, device,
+                        backend);
 
     Tensor keys = GetKeyTensor().To(device, /*copy=*/true);
     Tensor values = GetValueTensor().To(device, /*copy=*/true);
@@ -227,6 +246,175 @@ Hashmap Hashmap::To(const Device& device, bool copy) const {
     return new_hashmap;
 }
 
+// Object dtypes have no numpy equivalent and are saved as raw bytes, with the
+// dtype name stored alongside.
+static Tensor AsSavable(const Tensor& tensor, int64_t element_byte_size) {
+    if (!tensor.GetDtype().IsObject()) {
+        return tensor;
+    }
+    SizeVector shape{tensor.GetLength(), element_byte_size};
+    return Tensor(shape, shape_util::DefaultStrides(shape),
+                  const_cast<void*>(tensor.GetDataPtr()), Dtype::UInt8,
+                  tensor.GetBlob());
+}
+
+static Tensor ShapeToTensor(const SizeVector& shape) {
+    return Tensor(std::vector<int64_t>(shape.begin(), shape.end()),
+                  {static_cast<int64_t>(shape.size())}, Dtype::Int64);
+}
+
+static Tensor DtypeNameToTensor(const Dtype& dtype) {
+    std::string name = dtype.ToString();
+    return Tensor(std::vector<uint8_t>(name.begin(), name.end()),
+                  {static_cast<int64_t>(name.size())}, Dtype::UInt8);
+}
+
+static Dtype SavedDtype(const std::unordered_map<std::string, Tensor>& arrays,
+                        const std::string& prefix,
+                        const SizeVector& element_shape) {
+    const Tensor& saved = arrays.at(prefix + "s");
+    auto it = arrays.find(prefix + "_object_dtype");
+    if (it == arrays.end()) {
+        return saved.GetDtype();
+    }
+    // Saved as (N, element_byte_size) raw bytes.
+    int64_t element_byte_size = saved.GetShape().back();
+    std::vector<uint8_t> name = it->second.ToFlatVector<uint8_t>();
+    return Dtype(Dtype::DtypeCode::Object,
+                 element_byte_size / std::max(element_shape.NumElements(),
+                                              int64_t(1)),
+                 std::string(name.begin(), name.end()));
+}
+
+// Whether a saved buffer is a contiguous array of elements of
+// element_byte_size bytes, i.e. can be used as hashmap buffer.
+static bool IsBuffer(const Tensor& saved, int64_t element_byte_size) {
+    return saved.IsContiguous() && saved.NumDims() > 0 &&
+           saved.NumElements() * saved.GetDtype().ByteSize() ==
+                   saved.GetLength() * element_byte_size;
+}
+
+// Reinterpret a saved buffer as the object dtype of the hashmap buffers,
+// without copying.
+static Tensor AsBuffer(const Tensor& saved,
+                       int64_t element_byte_size,
+                       const std::string& name) {
+    return Tensor({saved.GetLength()}, {1},
+                  const_cast<void*>(saved.GetDataPtr()),
+                  Dtype(Dtype::DtypeCode::Object, element_byte_size, name),
+                  saved.GetBlob());
+}
+
+void Hashmap::Save(const std::string& file_name) const {
+    Device host("CPU:0");
+    std::unordered_map<std::string, Tensor> arrays;
+    std::unordered_map<std::string, Tensor> index =
+            device_hashmap_->GetIndexTensors();
+    Tensor active_addrs;
+    GetActiveIndices(active_addrs);
+    if (index.empty()) {
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        Tensor keys = GetKeyTensor().IndexGet({active_indices}).To(host);
+        Tensor values = GetValueTensor().IndexGet({active_indices}).To(host);
+        arrays.emplace("keys", AsSavable(keys, GetKeyBytesize()));
+        arrays.emplace("values", AsSavable(values, GetValueBytesize()));
+    } else {
+        // The whole buffers with the backend index, so that Load() can attach
+        // them instead of inserting the keys again.
+        arrays.emplace("keys",
+                       AsSavable(GetKeyTensor().To(host), GetKeyBytesize()));
+        arrays.emplace("values", AsSavable(GetValueTensor().To(host),
+                                           GetValueBytesize()));
+        for (auto& kv : index) {
+            arrays.emplace("index_" + kv.first, kv.second.To(host));
+        }
+        // For the backends that cannot attach the index and insert the
+        // active entries again.
+        arrays.emplace("active_addrs", active_addrs.To(host));
+    }
+    arrays.emplace("key_element_shape", ShapeToTensor(element_shape_key_));
+    arrays.emplace("value_element_shape", ShapeToTensor(element_shape_value_));
+    arrays.emplace("capacity", Tensor::Init<int64_t>({GetCapacity()}));
+    if (dtype_key_.IsObject()) {
+        arrays.emplace("key_object_dtype", DtypeNameToTensor(dtype_key_));
+    }
+    if (dtype_value_.IsObject()) {
+        arrays.emplace("value_object_dtype", DtypeNameToTensor(dtype_value_));
+    }
+    Tensor::SaveNpz(file_name, arrays);
+}
+
+Hashmap Hashmap::Load(const std::string& file_name,
+                      const Device& device,
+                      bool memory_mapped,
+                      const HashmapBackend& backend) {
+    std::unordered_map<std::string, Tensor> arrays =
+            Tensor::LoadNpz(file_name, memory_mapped);
+    for (const char* name : {"keys", "values", "key_element_shape",
+                             "value_element_shape", "capacity"}) {
+        if (arrays.count(name) == 0) {
+            utility::LogError(
+                    "[Hashmap] {} is not a saved hashmap, missing array {}.",
+                    file_name, name);
+        }
+    }
+
+    std::vector<int64_t> shape_key =
+            arrays.at("key_element_shape").ToFlatVector<int64_t>();
+    std::vector<int64_t> shape_value =
+            arrays.at("value_element_shape").ToFlatVector<int64_t>();
+    SizeVector element_shape_key(shape_key.begin(), shape_key.end());
+    SizeVector element_shape_value(shape_value.begin(), shape_value.end());
+
+    Tensor keys = arrays.at("keys");
+    Tensor values = arrays.at("values");
+    if (values.GetLength() != keys.GetLength()) {
+        utility::LogError(
+                "[Hashmap] {} has {} keys but {} values, file is corrupted.",
+                file_name, keys.GetLength(), values.GetLength());
+    }
+    Dtype dtype_key = SavedDtype(arrays, "key", element_shape_key);
+    Dtype dtype_value = SavedDtype(arrays, "value", element_shape_value);
+
+    std::unordered_map<std::string, Tensor> index;
+    const std::string prefix = "index_";
+    for (const auto& kv : arrays) {
+        if (kv.first.compare(0, prefix.size(), prefix) == 0) {
+            index.emplace(kv.first.substr(prefix.size()), kv.second);
+        }
+    }
+    if (!index.empty()) {
+        // Attach the saved buffers and index if the backend supports it.
+        Hashmap hashmap(1, dtype_key, dtype_value, element_shape_key,
+                        element_shape_value, device, backend);
+        int64_t dsize_key = hashmap.GetKeyBytesize();
+        int64_t dsize_value = hashmap.GetValueBytesize();
+        if (IsBuffer(keys, dsize_key) && IsBuffer(values, dsize_value) &&
+            hashmap.device_hashmap_->Attach(
+                    AsBuffer(keys, dsize_key, "_hash_k"),
+                    AsBuffer(values, dsize_value, "_hash_v"), index)) {
+            return hashmap;
+        }
+        if (arrays.count("active_addrs") == 0) {
+            utility::LogError("[Hashmap] {} has a corrupted index.",
+                              file_name);
+        }
+        Tensor active_indices = arrays.at("active_addrs").To(Dtype::Int64);
+        keys = keys.IndexGet({active_indices});
+        values = values.IndexGet({active_indices});
+    }
+
+    int64_t count = keys.GetLength();
+    int64_t capacity = std::max(arrays.at("capacity").Item<int64_t>(), count);
+    Hashmap hashmap(capacity, dtype_key, dtype_value, element_shape_key,
+                    element_shape_value, device, backend);
+    if (count > 0) {
+        Tensor addrs, masks;
+        hashmap.Insert(keys.To(device), values.To(device), addrs, masks);
+    }
+    return hashmap;
+}
+
 Hashmap Hashmap::CPU() const { return To(Device("CPU:0"), /*copy=*/false); }
 
 Hashmap Hashmap::CUDA(int device_id) const {
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#pragma once
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -39,6 +41,19 @@ template <typename Hash, typename KeyEq>
 class DeviceHashmap;
 typedef DeviceHashmap<DefaultHash, DefaultKeyEq> DefaultDeviceHashmap;
 
+/// Hash table implementation behind a Hashmap.
+enum class HashmapBackend {
+    /// LinearProbing on CPU, Slab on CUDA.
+    Default,
+    /// CPU: tbb::concurrent_unordered_map of pointers to the keys.
+    TBB,
+    /// CPU: open addressing with SIMD tag matching, see
+    /// CPU/LinearProbingHashmapCPU.h.
+    LinearProbing,
+    /// CUDA: slab hash.
+    Slab
+};
+
 class Hashmap {
 public:
     static constexpr int64_t kDefaultElemsPerBucket = 4;
@@ -62,7 +77,8 @@ public:
             const Dtype& dtype_value,
             const SizeVector& element_shape_key,
             const SizeVector& element_shape_value,
-            const Device& device);
+            const Device& device,
+            const HashmapBackend& backend = HashmapBackend::Default);
 
     ~Hashmap(){};
 
@@ -119,11 +135,35 @@ public:
     Hashmap CPU() const;
     Hashmap CUDA(int device_id = 0) const;
 
+    /// Save the hashmap to \p file_name in numpy's npz format. With the
+    /// LinearProbing CPU backend, the whole key/value buffers are saved with
+    /// the index and the active addresses; otherwise only the active keys and
+    /// values are.
+    void Save(const std::string& file_name) const;
+
+    /// Load a hashmap written by Save() onto \p device. A saved LinearProbing
+    /// index loaded onto the CPU with the Default or LinearProbing backend is
+    /// attached as is, without inserting the keys, and buffer addresses are
+    /// preserved. In all other cases the keys are inserted again, query the
+    /// new addresses with Find() or GetActiveIndices(). If \p memory_mapped
+    /// is true, the file is memory mapped: an attached hashmap then uses the
+    /// mapping as its storage, so loading takes constant time and pages are
+    /// only read when accessed. Changes are private to the process and never
+    /// written back to the file.
+    static Hashmap Load(
+            const std::string& file_name,
+            const Device& device = Device("CPU:0"),
+            bool memory_mapped = false,
+            const HashmapBackend& backend = HashmapBackend::Default);
+
     int64_t Size() const;
 
     int64_t GetCapacity() const;
     int64_t GetBucketCount() const;
     Device GetDevice() const;
+    HashmapBackend GetBackend() const { return backend_; }
+    Dtype GetKeyDtype() const { return dtype_key_; }
+    Dtype GetValueDtype() const { return dtype_value_; }
     int64_t GetKeyBytesize() const;
     int64_t GetValueBytesize() const;
 
@@ -146,12 +186,11 @@ protected:
     void AssertValueDtype(const Dtype& dtype_val,
                           const SizeVector& elem_shape) const;
 
-    Dtype GetKeyDtype() const { return dtype_key_; }
-    Dtype GetValueDtype() const { return dtype_value_; }
-
 private:
     std::shared_ptr<DefaultDeviceHashmap> device_hashmap_;
 
+    HashmapBackend backend_ = HashmapBackend::Default;
+
     Dtype dtype_key_ = Dtype::Undefined;
     Dtype dtype_value_ = Dtype::Undefined;
 
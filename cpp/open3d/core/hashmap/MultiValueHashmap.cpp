@@ -0,0 +1,282 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/hashmap/MultiValueHashmap.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+
+static SizeVector WithLength(int64_t length, const SizeVector& element_shape) {
+    SizeVector shape = element_shape;
+    shape.insert(shape.begin(), length);
+    return shape;
+}
+
+MultiValueHashmap::MultiValueHashmap(
+        int64_t init_capacity,
+        const Dtype& dtype_key,
+        const SizeVector& element_shape_key,
+        const std::vector<std::string>& value_names,
+        const std::vector<Dtype>& dtypes_value,
+        const std::vector<SizeVector>& element_shapes_value,
+        const Device& device,
+        const HashmapBackend& backend)
+    : backend_(backend),
+      dtype_key_(dtype_key),
+      element_shape_key_(element_shape_key),
+      value_names_(value_names),
+      dtypes_value_(dtypes_value),
+      element_shapes_value_(element_shapes_value) {
+    if (value_names_.empty() || value_names_.size() != dtypes_value_.size() ||
+        value_names_.size() != element_shapes_value_.size()) {
+        utility::LogError(
+                "[MultiValueHashmap] Expected the same non-zero number of "
+                "value names, dtypes and element shapes, but got {}, {} and "
+                "{}.",
+                value_names_.size(), dtypes_value_.size(),
+                element_shapes_value_.size());
+    }
+    for (size_t i = 0; i < value_names_.size(); ++i) {
+        if (std::count(value_names_.begin(), value_names_.end(),
+                       value_names_[i]) > 1) {
+            utility::LogError("[MultiValueHashmap] Duplicated value name {}.",
+                              value_names_[i]);
+        }
+        if (dtypes_value_[i].GetDtypeCode() == Dtype::DtypeCode::Undefined ||
+            dtypes_value_[i].IsObject()) {
+            utility::LogError(
+                    "[MultiValueHashmap] Unsupported dtype {} for value {}.",
+                    dtypes_value_[i].ToString(), value_names_[i]);
+        }
+        if (element_shapes_value_[i].NumElements() == 0) {
+            utility::LogError(
+                    "[MultiValueHashmap] element shape 0 is not supported for "
+                    "value {}.",
+                    value_names_[i]);
+        }
+    }
+
+    index_ = std::make_shared<Hashmap>(init_capacity, dtype_key_, Dtype::UInt8,
+                                       element_shape_key_, SizeVector{1},
+                                       device, backend_);
+    value_buffers_ = std::make_shared<std::vector<Tensor>>();
+    for (size_t i = 0; i < value_names_.size(); ++i) {
+        value_buffers_->push_back(Tensor::Zeros(
+                WithLength(index_->GetCapacity(), element_shapes_value_[i]),
+                dtypes_value_[i], device));
+    }
+}
+
+void MultiValueHashmap::Reserve(int64_t capacity) {
+    if (capacity <= GetCapacity()) {
+        return;
+    }
+
+    // The index is rebuilt here rather than grown by the backend, since
+    // backends may reassign addresses on growth and the value buffers have to
+    // follow.
+    Device device = GetDevice();
+    auto index = std::make_shared<Hashmap>(capacity, dtype_key_, Dtype::UInt8,
+                                           element_shape_key_, SizeVector{1},
+                                           device, backend_);
+    std::vector<Tensor> value_buffers;
+    for (size_t i = 0; i < value_names_.size(); ++i) {
+        value_buffers.push_back(Tensor::Zeros(
+                WithLength(index->GetCapacity(), element_shapes_value_[i]),
+                dtypes_value_[i], device));
+    }
+
+    if (Size() > 0) {
+        Tensor active_addrs;
+        index_->GetActiveIndices(active_addrs);
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+
+        Tensor addrs, masks;
+        index->Activate(index_->GetKeyTensor().IndexGet({active_indices}),
+                        addrs, masks);
+        Tensor new_indices = addrs.To(Dtype::Int64);
+        for (size_t i = 0; i < value_buffers.size(); ++i) {
+            value_buffers[i].IndexSet(
+                    {new_indices},
+                    value_buffers_->at(i).IndexGet({active_indices}));
+        }
+    }
+
+    *index_ = *index;
+    *value_buffers_ = std::move(value_buffers);
+}
+
+Tensor MultiValueHashmap::ActivateImpl(const Tensor& input_keys,
+                                       Tensor& output_addrs,
+                                       Tensor& output_masks) {
+    // Mirrors the growth policy of the backends, which then never grow on
+    // their own.
+    int64_t new_size = Size() + input_keys.GetLength();
+    if (new_size > GetCapacity()) {
+        Reserve(std::max(GetCapacity() * 2, new_size));
+    }
+
+    index_->Activate(input_keys, output_addrs, output_masks);
+    return output_addrs.IndexGet({output_masks}).To(Dtype::Int64);
+}
+
+void MultiValueHashmap::Insert(const Tensor& input_keys,
+                               const std::vector<Tensor>& input_values,
+                               Tensor& output_addrs,
+                               Tensor& output_masks) {
+    if (input_values.size() != value_names_.size()) {
+        utility::LogError(
+                "[MultiValueHashmap] Expected {} value tensors, but got {}.",
+                value_names_.size(), input_values.size());
+    }
+    int64_t count = input_keys.GetLength();
+    for (size_t i = 0; i < input_values.size(); ++i) {
+        const Tensor& value = input_values[i];
+        if (value.GetDtype() != dtypes_value_[i] ||
+            value.GetShape() != WithLength(count, element_shapes_value_[i])) {
+            utility::LogError(
+                    "[MultiValueHashmap] Invalid value {}, expected {} {}, "
+                    "but got {} {}.",
+                    value_names_[i], dtypes_value_[i].ToString(),
+                    WithLength(count, element_shapes_value_[i]).ToString(),
+                    value.GetDtype().ToString(), value.GetShape().ToString());
+        }
+        if (value.GetDevice() != GetDevice()) {
+            utility::LogError(
+                    "[MultiValueHashmap] Incompatible device for value {}, "
+                    "expected {}, but got {}.",
+                    value_names_[i], GetDevice().ToString(),
+                    value.GetDevice().ToString());
+        }
+    }
+
+    Tensor inserted = ActivateImpl(input_keys, output_addrs, output_masks);
+    for (size_t i = 0; i < input_values.size(); ++i) {
+        value_buffers_->at(i).IndexSet(
+                {inserted}, input_values[i].IndexGet({output_masks}));
+    }
+}
+
+void MultiValueHashmap::Activate(const Tensor& input_keys,
+                                 Tensor& output_addrs,
+                                 Tensor& output_masks) {
+    Tensor inserted = ActivateImpl(input_keys, output_addrs, output_masks);
+    int64_t count = inserted.GetLength();
+    for (size_t i = 0; i < value_buffers_->size(); ++i) {
+        value_buffers_->at(i).IndexSet(
+                {inserted},
+                Tensor::Zeros(WithLength(count, element_shapes_value_[i]),
+                              dtypes_value_[i], GetDevice()));
+    }
+}
+
+void MultiValueHashmap::Find(const Tensor& input_keys,
+                             Tensor& output_addrs,
+                             Tensor& output_masks) {
+    index_->Find(input_keys, output_addrs, output_masks);
+}
+
+void MultiValueHashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    index_->Erase(input_keys, output_masks);
+}
+
+void MultiValueHashmap::GetActiveIndices(Tensor& output_addrs) const {
+    index_->GetActiveIndices(output_addrs);
+}
+
+MultiValueHashmap MultiValueHashmap::Clone() const {
+    return To(GetDevice(), /*copy=*/true);
+}
+
+MultiValueHashmap MultiValueHashmap::To(const Device& device, bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return *this;
+    }
+
+    // Backends are device specific, keep the backend on the same device type.
+    HashmapBackend backend = device.GetType() == GetDevice().GetType()
+                                     ? backend_
+                                     : HashmapBackend::Default;
+    MultiValueHashmap new_hashmap(GetCapacity(), dtype_key_, element_shape_key_,
+                                  value_names_, dtypes_value_,
+                                  element_shapes_value_, device, backend);
+    if (Size() == 0) {
+        return new_hashmap;
+    }
+
+    Tensor active_addrs;
+    GetActiveIndices(active_addrs);
+    Tensor active_indices = active_addrs.To(Dtype::Int64);
+
+    std::vector<Tensor> values;
+    for (const Tensor& value_buffer : *value_buffers_) {
+        values.push_back(value_buffer.IndexGet({active_indices}).To(device));
+    }
+    Tensor addrs, masks;
+    new_hashmap.Insert(GetKeyTensor().IndexGet({active_indices}).To(device),
+                       values, addrs, masks);
+    return new_hashmap;
+}
+
+int64_t MultiValueHashmap::Size() const { return index_->Size(); }
+
+int64_t MultiValueHashmap::GetCapacity() const {
+    return index_->GetCapacity();
+}
+
+Device MultiValueHashmap::GetDevice() const { return index_->GetDevice(); }
+
+Dtype MultiValueHashmap::GetValueDtype(const std::string& name) const {
+    return dtypes_value_[GetValueIndex(name)];
+}
+
+Tensor MultiValueHashmap::GetKeyTensor() const {
+    return index_->GetKeyTensor();
+}
+
+Tensor MultiValueHashmap::GetValueTensor(const std::string& name) const {
+    return value_buffers_->at(GetValueIndex(name));
+}
+
+std::vector<Tensor> MultiValueHashmap::GetValueTensors() const {
+    return *value_buffers_;
+}
+
+int64_t MultiValueHashmap::GetValueIndex(const std::string& name) const {
+    auto it = std::find(value_names_.begin(), value_names_.end(), name);
+    if (it == value_names_.end()) {
+        utility::LogError("[MultiValueHashmap] Unknown value {}.", name);
+    }
+    return it - value_names_.begin();
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hashmap with several named values per key, stored as a structure of
+/// arrays: every value has its own dtype, element shape and buffer of shape
+/// (capacity, *element_shape). Kernels that only read some of the values only
+/// touch those buffers, e.g. a raycaster reading tsdf skips weight and color.
+///
+/// The keys are managed by a Hashmap used as an index. Addresses returned by
+/// Insert(), Activate(), Find() and GetActiveIndices() index every value
+/// buffer. They stay valid until the map grows, see Reserve().
+///
+/// Example: voxel blocks with separate tsdf, weight and color buffers:
+/// - dtype_key = Dtype::Int32, element_shape_key = {3}
+/// - value_names = {"tsdf", "weight", "color"}
+/// - dtypes_value = {Dtype::Float32, Dtype::UInt16, Dtype::UInt8}
+/// - element_shapes_value = {{8, 8, 8}, {8, 8, 8}, {8, 8, 8, 3}}
+class MultiValueHashmap {
+public:
+    MultiValueHashmap(int64_t init_capacity,
+                      const Dtype& dtype_key,
+                      const SizeVector& element_shape_key,
+                      const std::vector<std::string>& value_names,
+                      const std::vector<Dtype>& dtypes_value,
+                      const std::vector<SizeVector>& element_shapes_value,
+                      const Device& device,
+                      const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Grow the capacity to at least \p capacity. Growing rebuilds the index
+    /// and moves the values, so previously returned addresses are invalid.
+    void Reserve(int64_t capacity);
+
+    /// Parallel insert keys with one Tensor per value, in the order of the
+    /// value names. Values of keys that already exist are left untouched.
+    /// Return \addrs and \masks as in Hashmap::Insert().
+    void Insert(const Tensor& input_keys,
+                const std::vector<Tensor>& input_values,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
+    /// Parallel activate keys, values of newly activated keys are zeroed.
+    void Activate(const Tensor& input_keys,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    void Find(const Tensor& input_keys,
+              Tensor& output_addrs,
+              Tensor& output_masks);
+
+    void Erase(const Tensor& input_keys, Tensor& output_masks);
+
+    void GetActiveIndices(Tensor& output_addrs) const;
+
+    MultiValueHashmap Clone() const;
+    MultiValueHashmap To(const Device& device, bool copy = false) const;
+
+    int64_t Size() const;
+    int64_t GetCapacity() const;
+    Device GetDevice() const;
+    HashmapBackend GetBackend() const { return backend_; }
+
+    const std::vector<std::string>& GetValueNames() const {
+        return value_names_;
+    }
+    Dtype GetValueDtype(const std::string& name) const;
+
+    /// Key buffer of shape (capacity, *element_shape_key).
+    Tensor GetKeyTensor() const;
+
+    /// Buffer of the value \p name with shape (capacity, *element_shape).
+    Tensor GetValueTensor(const std::string& name) const;
+
+    /// All value buffers in the order of the value names.
+    std::vector<Tensor> GetValueTensors() const;
+
+protected:
+    int64_t GetValueIndex(const std::string& name) const;
+
+    /// Insert keys and return the addresses of the newly inserted ones,
+    /// growing the map first if needed.
+    Tensor ActivateImpl(const Tensor& input_keys,
+                        Tensor& output_addrs,
+                        Tensor& output_masks);
+
+private:
+    /// The index and the value buffers are shared between copies, like the
+    /// storage of a Hashmap, so that growth is visible to all of them.
+    std::shared_ptr<Hashmap> index_;
+    std::shared_ptr<std::vector<Tensor>> value_buffers_;
+
+    HashmapBackend backend_;
+
+    Dtype dtype_key_;
+    SizeVector element_shape_key_;
+
+    std::vector<std::string> value_names_;
+    std::vector<Dtype> dtypes_value_;
+    std::vector<SizeVector> element_shapes_value_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include <vector>
 
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -45,6 +47,38 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class>
                 BinaryEWOpCode::Ne,
         };
 
+static const char* BinaryEWOpName(BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            return "Add";
+        case BinaryEWOpCode::Sub:
+            return "Sub";
+        case BinaryEWOpCode::Mul:
+            return "Mul";
+        case BinaryEWOpCode::Div:
+            return "Div";
+        case BinaryEWOpCode::LogicalAnd:
+            return "LogicalAnd";
+        case BinaryEWOpCode::LogicalOr:
+            return "LogicalOr";
+        case BinaryEWOpCode::LogicalXor:
+            return "LogicalXor";
+        case BinaryEWOpCode::Gt:
+            return "Gt";
+        case BinaryEWOpCode::Lt:
+            return "Lt";
+        case BinaryEWOpCode::Ge:
+            return "Ge";
+        case BinaryEWOpCode::Le:
+            return "Le";
+        case BinaryEWOpCode::Eq:
+            return "Eq";
+        case BinaryEWOpCode::Ne:
+            return "Ne";
+    }
+    return "Unknown";
+}
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
@@ -68,6 +102,8 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    ProfilerScope scope("BinaryEW", BinaryEWOpName(op_code),
+                        {&dst, &lhs, &rhs});
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
@@ -82,6 +118,32 @@ void BinaryEW(const Tensor& lhs,
     }
 }
 
+void BinaryEW(const Tensor& lhs,
+              Scalar rhs,
+              Tensor& dst,
+              BinaryEWOpCode op_code) {
+    const bool is_arithmetic = s_boolean_binary_ew_op_codes.find(op_code) ==
+                               s_boolean_binary_ew_op_codes.end();
+    if (is_arithmetic &&
+        lhs.GetDevice().GetType() == Device::DeviceType::CPU &&
+        dst.GetDevice() == lhs.GetDevice() &&
+        dst.GetShape() == lhs.GetShape() &&
+        dst.GetDtype() == lhs.GetDtype() && lhs.IsContiguous() &&
+        dst.IsContiguous()) {
+        ProfilerScope scope("BinaryEW", BinaryEWOpName(op_code), {&dst, &lhs});
+        BinaryEWScalarCPU(lhs, rhs, dst, op_code);
+        return;
+    }
+
+    // Other devices and layouts broadcast the scalar as a 0-d tensor.
+    Tensor rhs_tensor;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(lhs.GetDtype(), [&]() {
+        rhs_tensor = Tensor::Full({}, rhs.To<scalar_t>(), lhs.GetDtype(),
+                                  lhs.GetDevice());
+    });
+    BinaryEW(lhs, rhs_tensor, dst, op_code);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
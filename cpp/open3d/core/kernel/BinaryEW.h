@@ -28,6 +28,7 @@
 
 #include <unordered_set>
 
+#include "open3d/core/Scalar.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
 #include "open3d/utility/Helper.h"
@@ -60,11 +61,26 @@ void BinaryEW(const Tensor& lhs,
               Tensor& dst,
               BinaryEWOpCode op_code);
 
+/// Binary op between a tensor and a scalar, which is converted to the dtype of
+/// the tensor. Arithmetic ops on contiguous CPU tensors pass the scalar by
+/// value to the kernel without allocating a 0-d tensor.
+void BinaryEW(const Tensor& lhs,
+              Scalar rhs,
+              Tensor& dst,
+              BinaryEWOpCode op_code);
+
 void BinaryEWCPU(const Tensor& lhs,
                  const Tensor& rhs,
                  Tensor& dst,
                  BinaryEWOpCode op_code);
 
+/// Arithmetic op between a contiguous tensor and a scalar. dst must be
+/// contiguous with the shape and dtype of lhs.
+void BinaryEWScalarCPU(const Tensor& lhs,
+                       Scalar rhs,
+                       Tensor& dst,
+                       BinaryEWOpCode op_code);
+
 #ifdef BUILD_CUDA_MODULE
 void BinaryEWCUDA(const Tensor& lhs,
                   const Tensor& rhs,
@@ -76,18 +92,34 @@ inline void Add(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
     BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Add);
 }
 
+inline void Add(const Tensor& lhs, Scalar rhs, Tensor& dst) {
+    BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Add);
+}
+
 inline void Sub(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
     BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Sub);
 }
 
+inline void Sub(const Tensor& lhs, Scalar rhs, Tensor& dst) {
+    BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Sub);
+}
+
 inline void Mul(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
     BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Mul);
 }
 
+inline void Mul(const Tensor& lhs, Scalar rhs, Tensor& dst) {
+    BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Mul);
+}
+
 inline void Div(const Tensor& lhs, const Tensor& rhs, Tensor& dst) {
     BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Div);
 }
 
+inline void Div(const Tensor& lhs, Scalar rhs, Tensor& dst) {
+    BinaryEW(lhs, rhs, dst, BinaryEWOpCode::Div);
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
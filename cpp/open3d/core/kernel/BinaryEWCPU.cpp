@@ -206,20 +206,32 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t>(
+                            indexer, CPUAddElementKernel<scalar_t>,
+                            [](scalar_t lhs, scalar_t rhs) {
+                                return static_cast<scalar_t>(lhs + rhs);
+                            });
                     break;
                 case BinaryEWOpCode::Sub:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t>(
+                            indexer, CPUSubElementKernel<scalar_t>,
+                            [](scalar_t lhs, scalar_t rhs) {
+                                return static_cast<scalar_t>(lhs - rhs);
+                            });
                     break;
                 case BinaryEWOpCode::Mul:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t>(
+                            indexer, CPUMulElementKernel<scalar_t>,
+                            [](scalar_t lhs, scalar_t rhs) {
+                                return static_cast<scalar_t>(lhs * rhs);
+                            });
                     break;
                 case BinaryEWOpCode::Div:
-                    CPULauncher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    CPULauncher::LaunchBinaryEWKernel<scalar_t>(
+                            indexer, CPUDivElementKernel<scalar_t>,
+                            [](scalar_t lhs, scalar_t rhs) {
+                                return static_cast<scalar_t>(lhs / rhs);
+                            });
                     break;
                 default:
                     break;
@@ -228,6 +240,66 @@ void BinaryEWCPU(const Tensor& lhs,
     }
 }
 
+/// Runs op over n contiguous elements of lhs_ptr and the scalar rhs, in
+/// parallel over chunks of the vectorized grain size.
+template <typename scalar_t, typename func_t>
+static void LaunchScalarBinaryEWCPUKernel(const scalar_t* lhs_ptr,
+                                          scalar_t rhs,
+                                          scalar_t* dst_ptr,
+                                          int64_t n,
+                                          func_t op) {
+    ParallelFor(n, CPULauncher::kVectorizedGrain,
+                [&](int64_t start, int64_t end) {
+                    VectorizedBinaryLoop(lhs_ptr + start, false, &rhs, true,
+                                         dst_ptr + start, end - start, op);
+                });
+}
+
+void BinaryEWScalarCPU(const Tensor& lhs,
+                       Scalar rhs,
+                       Tensor& dst,
+                       BinaryEWOpCode op_code) {
+    DISPATCH_DTYPE_TO_TEMPLATE(lhs.GetDtype(), [&]() {
+        const scalar_t value = rhs.To<scalar_t>();
+        const scalar_t* lhs_ptr =
+                static_cast<const scalar_t*>(lhs.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        const int64_t n = lhs.NumElements();
+        switch (op_code) {
+            case BinaryEWOpCode::Add:
+                LaunchScalarBinaryEWCPUKernel(
+                        lhs_ptr, value, dst_ptr, n,
+                        [](scalar_t lhs, scalar_t rhs) {
+                            return static_cast<scalar_t>(lhs + rhs);
+                        });
+                break;
+            case BinaryEWOpCode::Sub:
+                LaunchScalarBinaryEWCPUKernel(
+                        lhs_ptr, value, dst_ptr, n,
+                        [](scalar_t lhs, scalar_t rhs) {
+                            return static_cast<scalar_t>(lhs - rhs);
+                        });
+                break;
+            case BinaryEWOpCode::Mul:
+                LaunchScalarBinaryEWCPUKernel(
+                        lhs_ptr, value, dst_ptr, n,
+                        [](scalar_t lhs, scalar_t rhs) {
+                            return static_cast<scalar_t>(lhs * rhs);
+                        });
+                break;
+            case BinaryEWOpCode::Div:
+                LaunchScalarBinaryEWCPUKernel(
+                        lhs_ptr, value, dst_ptr, n,
+                        [](scalar_t lhs, scalar_t rhs) {
+                            return static_cast<scalar_t>(lhs / rhs);
+                        });
+                break;
+            default:
+                utility::LogError("BinaryEWScalarCPU: Unsupported op.");
+        }
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
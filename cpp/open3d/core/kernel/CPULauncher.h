@@ -32,6 +32,7 @@
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPUVectorized.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
 
@@ -48,48 +49,170 @@ public:
     /// \param element_kernel A function that takes pointer location and
     /// workload_idx, computes the value to fill, and fills the value at the
     /// pointer location.
+    /// \param grain_size Minimum number of workloads per parallel task.
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
-                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
-        }
+                                      func_t element_kernel,
+                                      int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                           workload_idx);
+                        }
+                    });
     }
 
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                    func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+                                    func_t element_kernel,
+                                    int64_t grain_size = kDefaultGrainSize) {
+        const int64_t src_step = GetInputByteStep(indexer, 0);
+        if (src_step >= 0 && indexer.IsOutputContiguous()) {
+            // Fast path: step the pointers instead of computing the offsets
+            // from workload_idx.
+            const char* src = indexer.GetInputPtr(0, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t dst_step = indexer.GetOutput().dtype_byte_size_;
+            ParallelFor(indexer.NumWorkloads(), grain_size,
+                        [&](int64_t start, int64_t end) {
+                            for (int64_t workload_idx = start;
+                                 workload_idx < end; ++workload_idx) {
+                                element_kernel(src + workload_idx * src_step,
+                                               dst + workload_idx * dst_step);
+                            }
+                        });
+            return;
         }
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                           indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
+    }
+
+    /// Same as LaunchUnaryEWKernel(indexer, element_kernel), but when the
+    /// input and output are contiguous, runs \p vec_kernel over the buffers
+    /// with VectorizedUnaryLoop.
+    ///
+    /// \param element_kernel A function that takes the input and output
+    /// pointers of one element.
+    /// \param vec_kernel A function that takes a scalar_t value and returns
+    /// the result of type scalar_t. The input and output dtypes of the indexer
+    /// must be scalar_t.
+    /// \param grain_size Minimum number of elements per parallel task of the
+    /// vectorized loop.
+    template <typename scalar_t, typename func_t, typename vec_func_t>
+    static void LaunchUnaryEWKernel(const Indexer& indexer,
+                                    func_t element_kernel,
+                                    vec_func_t vec_kernel,
+                                    int64_t grain_size = kVectorizedGrain) {
+        if (!indexer.IsInputContiguous(0) || !indexer.IsOutputContiguous()) {
+            LaunchUnaryEWKernel(indexer, element_kernel);
+            return;
+        }
+        const scalar_t* src =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        VectorizedUnaryLoop(src + start, dst + start,
+                                            end - start, vec_kernel);
+                    });
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+                                     func_t element_kernel,
+                                     int64_t grain_size = kDefaultGrainSize) {
+        const int64_t lhs_step = GetInputByteStep(indexer, 0);
+        const int64_t rhs_step = GetInputByteStep(indexer, 1);
+        if (lhs_step >= 0 && rhs_step >= 0 && indexer.IsOutputContiguous()) {
+            // Fast path: step the pointers instead of computing the offsets
+            // from workload_idx.
+            const char* lhs = indexer.GetInputPtr(0, 0);
+            const char* rhs = indexer.GetInputPtr(1, 0);
+            char* dst = indexer.GetOutputPtr(0);
+            const int64_t dst_step = indexer.GetOutput().dtype_byte_size_;
+            ParallelFor(indexer.NumWorkloads(), grain_size,
+                        [&](int64_t start, int64_t end) {
+                            for (int64_t workload_idx = start;
+                                 workload_idx < end; ++workload_idx) {
+                                element_kernel(lhs + workload_idx * lhs_step,
+                                               rhs + workload_idx * rhs_step,
+                                               dst + workload_idx * dst_step);
+                            }
+                        });
+            return;
         }
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                           indexer.GetInputPtr(1, workload_idx),
+                                           indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
     }
 
-    template <typename func_t>
-    static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
-                                            func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
+    /// Same as LaunchBinaryEWKernel(indexer, element_kernel), but when the
+    /// output is contiguous and each input is either contiguous or a
+    /// broadcasted scalar, runs \p vec_kernel over the buffers with
+    /// VectorizedBinaryLoop.
+    ///
+    /// \param element_kernel A function that takes the lhs, rhs and output
+    /// pointers of one element.
+    /// \param vec_kernel A function that takes two scalar_t values and returns
+    /// the result of type scalar_t. The input and output dtypes of the indexer
+    /// must be scalar_t.
+    /// \param grain_size Minimum number of elements per parallel task of the
+    /// vectorized loop.
+    template <typename scalar_t, typename func_t, typename vec_func_t>
+    static void LaunchBinaryEWKernel(const Indexer& indexer,
+                                     func_t element_kernel,
+                                     vec_func_t vec_kernel,
+                                     int64_t grain_size = kVectorizedGrain) {
+        const int64_t lhs_step = GetInputByteStep(indexer, 0);
+        const int64_t rhs_step = GetInputByteStep(indexer, 1);
+        if (lhs_step < 0 || rhs_step < 0 || !indexer.IsOutputContiguous()) {
+            LaunchBinaryEWKernel(indexer, element_kernel);
+            return;
         }
+        const bool lhs_scalar = lhs_step == 0;
+        const bool rhs_scalar = rhs_step == 0;
+        const scalar_t* lhs =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
+        const scalar_t* rhs =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(1, 0));
+        scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        VectorizedBinaryLoop(lhs_scalar ? lhs : lhs + start,
+                                             lhs_scalar,
+                                             rhs_scalar ? rhs : rhs + start,
+                                             rhs_scalar, dst + start,
+                                             end - start, vec_kernel);
+                    });
+    }
+
+    template <typename func_t>
+    static void LaunchAdvancedIndexerKernel(
+            const AdvancedIndexer& indexer,
+            func_t element_kernel,
+            int64_t grain_size = kDefaultGrainSize) {
+        ParallelFor(indexer.NumWorkloads(), grain_size,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            element_kernel(indexer.GetInputPtr(workload_idx),
+                                           indexer.GetOutputPtr(workload_idx));
+                        }
+                    });
     }
 
     template <typename scalar_t, typename func_t>
@@ -119,16 +242,19 @@ public:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                element_kernel(indexer.GetInputPtr(0, workload_idx),
-                               &thread_results[thread_idx]);
+        ParallelFor(num_threads, 1, [&](int64_t task_start, int64_t task_end) {
+            for (int64_t thread_idx = task_start; thread_idx < task_end;
+                 ++thread_idx) {
+                int64_t start = thread_idx * workload_per_thread;
+                int64_t end =
+                        std::min(start + workload_per_thread, num_workloads);
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   &thread_results[thread_idx]);
+                }
             }
-        }
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -163,20 +289,53 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        ParallelFor(indexer_shape[best_dim], 1,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t i = start; i < end; ++i) {
+                            Indexer sub_indexer(indexer);
+                            sub_indexer.ShrinkDim(best_dim, i, 1);
+                            LaunchReductionKernelSerial<scalar_t>(
+                                    sub_indexer, element_kernel);
+                        }
+                    });
     }
 
     /// General kernels with non-conventional indexers
+    /// \param grain_size Minimum number of workloads per parallel task. The
+    /// default splits even small loops, since the work per element is
+    /// unknown.
     template <typename func_t>
-    static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
+    static void LaunchGeneralKernel(int64_t n,
+                                    func_t element_kernel,
+                                    int64_t grain_size = 1) {
+        ParallelFor(n, grain_size, [&](int64_t start, int64_t end) {
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                element_kernel(workload_idx);
+            }
+        });
+    }
+
+    /// Default minimum number of workloads per parallel task of the
+    /// element-wise kernels. Smaller loops run in the calling thread.
+    static constexpr int64_t kDefaultGrainSize = 4096;
+
+    /// Minimum number of elements per parallel task in the vectorized
+    /// kernels.
+    static constexpr int64_t kVectorizedGrain = 32768;
+
+private:
+    /// Returns the byte step between consecutive workloads of the
+    /// \p input_idx -th input: dtype_byte_size if it is contiguous, 0 if it is
+    /// a broadcasted scalar and -1 otherwise.
+    static int64_t GetInputByteStep(const Indexer& indexer,
+                                    int64_t input_idx) {
+        if (indexer.IsInputScalar(input_idx)) {
+            return 0;
+        } else if (indexer.IsInputContiguous(input_idx)) {
+            return indexer.GetInput(input_idx).dtype_byte_size_;
+        } else {
+            return -1;
         }
     }
 };
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPUVectorized.h"
+
+#include <atomic>
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static CPUVectorISA DetectCPUVectorISA() {
+#ifdef OPEN3D_CPU_VECTOR_ISA_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+        return CPUVectorISA::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return CPUVectorISA::AVX2;
+    }
+#endif
+    return CPUVectorISA::None;
+}
+
+static std::atomic<CPUVectorISA>& CurrentCPUVectorISA() {
+    static std::atomic<CPUVectorISA> isa(GetSupportedCPUVectorISA());
+    return isa;
+}
+
+CPUVectorISA GetSupportedCPUVectorISA() {
+    static const CPUVectorISA supported_isa = DetectCPUVectorISA();
+    return supported_isa;
+}
+
+CPUVectorISA GetCPUVectorISA() {
+    return CurrentCPUVectorISA().load(std::memory_order_relaxed);
+}
+
+void SetCPUVectorISA(CPUVectorISA isa) {
+    CPUVectorISA supported_isa = GetSupportedCPUVectorISA();
+    if (static_cast<int>(isa) > static_cast<int>(supported_isa)) {
+        isa = supported_isa;
+    }
+    CurrentCPUVectorISA().store(isa);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
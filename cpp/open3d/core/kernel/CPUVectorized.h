@@ -0,0 +1,262 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file CPUVectorized.h
+/// \brief Vectorized loops over contiguous CPU buffers.
+///
+/// Each loop is compiled several times: for the baseline ISA of the build and,
+/// with GCC or Clang on x86-64, for AVX2 and AVX-512. The version matching the
+/// host CPU is selected at runtime, so that the library does not need to be
+/// built with -march flags.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class CPUVectorISA { None = 0, AVX2 = 1, AVX512 = 2 };
+
+/// Returns the best vector ISA supported by the host CPU and the compiler.
+CPUVectorISA GetSupportedCPUVectorISA();
+
+/// Returns the vector ISA used by the vectorized CPU loops.
+CPUVectorISA GetCPUVectorISA();
+
+/// Sets the vector ISA used by the vectorized CPU loops, e.g. to compare
+/// results in tests. Clamped to GetSupportedCPUVectorISA().
+void SetCPUVectorISA(CPUVectorISA isa);
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define OPEN3D_CPU_VECTOR_ISA_DISPATCH
+#define OPEN3D_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define OPEN3D_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#define OPEN3D_FORCE_INLINE inline __attribute__((always_inline))
+#else
+#define OPEN3D_FORCE_INLINE inline
+#endif
+
+namespace vectorized {
+
+// Number of independent accumulators in reductions. Allows the compiler to
+// keep a full vector register of partial results without reassociating
+// floating point operations. 16 floats fill one AVX-512 register.
+static constexpr int64_t kNumLanes = 16;
+
+template <typename scalar_t, typename func_t>
+OPEN3D_FORCE_INLINE void UnaryLoopImpl(const scalar_t* src,
+                                       scalar_t* dst,
+                                       int64_t n,
+                                       func_t op) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = op(src[i]);
+    }
+}
+
+template <typename scalar_t, typename func_t>
+OPEN3D_FORCE_INLINE void BinaryLoopImpl(const scalar_t* lhs,
+                                        bool lhs_scalar,
+                                        const scalar_t* rhs,
+                                        bool rhs_scalar,
+                                        scalar_t* dst,
+                                        int64_t n,
+                                        func_t op) {
+    if (lhs_scalar && rhs_scalar) {
+        const scalar_t value = op(lhs[0], rhs[0]);
+        std::fill_n(dst, n, value);
+    } else if (lhs_scalar) {
+        const scalar_t lhs_value = lhs[0];
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(lhs_value, rhs[i]);
+        }
+    } else if (rhs_scalar) {
+        const scalar_t rhs_value = rhs[0];
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(lhs[i], rhs_value);
+        }
+    } else {
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = op(lhs[i], rhs[i]);
+        }
+    }
+}
+
+template <typename scalar_t, typename acc_t, typename func_t>
+OPEN3D_FORCE_INLINE acc_t ReduceLoopImpl(const scalar_t* src,
+                                         int64_t n,
+                                         acc_t identity,
+                                         func_t op) {
+    acc_t lanes[kNumLanes];
+    for (int64_t l = 0; l < kNumLanes; ++l) {
+        lanes[l] = identity;
+    }
+    int64_t i = 0;
+    for (; i + kNumLanes <= n; i += kNumLanes) {
+        for (int64_t l = 0; l < kNumLanes; ++l) {
+            lanes[l] = op(lanes[l], static_cast<acc_t>(src[i + l]));
+        }
+    }
+    acc_t result = identity;
+    for (int64_t l = 0; l < kNumLanes; ++l) {
+        result = op(result, lanes[l]);
+    }
+    for (; i < n; ++i) {
+        result = op(result, static_cast<acc_t>(src[i]));
+    }
+    return result;
+}
+
+#ifdef OPEN3D_CPU_VECTOR_ISA_DISPATCH
+template <typename scalar_t, typename func_t>
+OPEN3D_TARGET_AVX2 void UnaryLoopAVX2(const scalar_t* src,
+                                      scalar_t* dst,
+                                      int64_t n,
+                                      func_t op) {
+    UnaryLoopImpl(src, dst, n, op);
+}
+
+template <typename scalar_t, typename func_t>
+OPEN3D_TARGET_AVX512 void UnaryLoopAVX512(const scalar_t* src,
+                                          scalar_t* dst,
+                                          int64_t n,
+                                          func_t op) {
+    UnaryLoopImpl(src, dst, n, op);
+}
+
+template <typename scalar_t, typename func_t>
+OPEN3D_TARGET_AVX2 void BinaryLoopAVX2(const scalar_t* lhs,
+                                       bool lhs_scalar,
+                                       const scalar_t* rhs,
+                                       bool rhs_scalar,
+                                       scalar_t* dst,
+                                       int64_t n,
+                                       func_t op) {
+    BinaryLoopImpl(lhs, lhs_scalar, rhs, rhs_scalar, dst, n, op);
+}
+
+template <typename scalar_t, typename func_t>
+OPEN3D_TARGET_AVX512 void BinaryLoopAVX512(const scalar_t* lhs,
+                                           bool lhs_scalar,
+                                           const scalar_t* rhs,
+                                           bool rhs_scalar,
+                                           scalar_t* dst,
+                                           int64_t n,
+                                           func_t op) {
+    BinaryLoopImpl(lhs, lhs_scalar, rhs, rhs_scalar, dst, n, op);
+}
+
+template <typename scalar_t, typename acc_t, typename func_t>
+OPEN3D_TARGET_AVX2 acc_t ReduceLoopAVX2(const scalar_t* src,
+                                        int64_t n,
+                                        acc_t identity,
+                                        func_t op) {
+    return ReduceLoopImpl(src, n, identity, op);
+}
+
+template <typename scalar_t, typename acc_t, typename func_t>
+OPEN3D_TARGET_AVX512 acc_t ReduceLoopAVX512(const scalar_t* src,
+                                            int64_t n,
+                                            acc_t identity,
+                                            func_t op) {
+    return ReduceLoopImpl(src, n, identity, op);
+}
+#endif
+
+}  // namespace vectorized
+
+/// dst[i] = op(src[i]) for i in [0, n).
+template <typename scalar_t, typename func_t>
+void VectorizedUnaryLoop(const scalar_t* src,
+                         scalar_t* dst,
+                         int64_t n,
+                         func_t op) {
+#ifdef OPEN3D_CPU_VECTOR_ISA_DISPATCH
+    switch (GetCPUVectorISA()) {
+        case CPUVectorISA::AVX512:
+            return vectorized::UnaryLoopAVX512(src, dst, n, op);
+        case CPUVectorISA::AVX2:
+            return vectorized::UnaryLoopAVX2(src, dst, n, op);
+        default:
+            break;
+    }
+#endif
+    vectorized::UnaryLoopImpl(src, dst, n, op);
+}
+
+/// dst[i] = op(lhs[i], rhs[i]) for i in [0, n). If \p lhs_scalar or
+/// \p rhs_scalar is true, the corresponding operand is a single value that is
+/// broadcasted. \p dst may be the same buffer as \p lhs or \p rhs.
+template <typename scalar_t, typename func_t>
+void VectorizedBinaryLoop(const scalar_t* lhs,
+                          bool lhs_scalar,
+                          const scalar_t* rhs,
+                          bool rhs_scalar,
+                          scalar_t* dst,
+                          int64_t n,
+                          func_t op) {
+#ifdef OPEN3D_CPU_VECTOR_ISA_DISPATCH
+    switch (GetCPUVectorISA()) {
+        case CPUVectorISA::AVX512:
+            return vectorized::BinaryLoopAVX512(lhs, lhs_scalar, rhs,
+                                                rhs_scalar, dst, n, op);
+        case CPUVectorISA::AVX2:
+            return vectorized::BinaryLoopAVX2(lhs, lhs_scalar, rhs,
+                                              rhs_scalar, dst, n, op);
+        default:
+            break;
+    }
+#endif
+    vectorized::BinaryLoopImpl(lhs, lhs_scalar, rhs, rhs_scalar, dst, n, op);
+}
+
+/// Reduces src[0:n] with op, starting from identity. The elements are
+/// converted to the accumulation type acc_t, e.g. float for Float16. The order
+/// of the reduction differs from a serial loop.
+template <typename scalar_t, typename acc_t, typename func_t>
+acc_t VectorizedReduceLoop(const scalar_t* src,
+                           int64_t n,
+                           acc_t identity,
+                           func_t op) {
+#ifdef OPEN3D_CPU_VECTOR_ISA_DISPATCH
+    switch (GetCPUVectorISA()) {
+        case CPUVectorISA::AVX512:
+            return vectorized::ReduceLoopAVX512(src, n, identity, op);
+        case CPUVectorISA::AVX2:
+            return vectorized::ReduceLoopAVX2(src, n, identity, op);
+        default:
+            break;
+    }
+#endif
+    return vectorized::ReduceLoopImpl(src, n, identity, op);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#ifdef BUILD_CUDA_MODULE
+/// Runs the instructions one by one with the regular BinaryEW and UnaryEW
+/// kernels. Used for devices without a fused implementation.
+static void FusedEWEager(const std::vector<Tensor>& inputs,
+                         Tensor& dst,
+                         const FusedEWProgram& program) {
+    Dtype dtype = dst.GetDtype();
+    Device device = dst.GetDevice();
+    std::vector<Tensor> registers = inputs;
+    for (const Scalar& scalar : program.scalars_) {
+        registers.push_back(Tensor::Full({}, scalar, dtype, device));
+    }
+    for (const FusedEWInstruction& instruction : program.instructions_) {
+        const Tensor& lhs = registers[instruction.lhs_];
+        if (instruction.is_binary_) {
+            const Tensor& rhs = registers[instruction.rhs_];
+            Tensor result(shape_util::BroadcastedShape(lhs.GetShape(),
+                                                       rhs.GetShape()),
+                          dtype, device);
+            BinaryEW(lhs, rhs, result, instruction.binary_op_code_);
+            registers.push_back(result);
+        } else {
+            Tensor result(lhs.GetShape(), dtype, device);
+            UnaryEW(lhs, result, instruction.unary_op_code_);
+            registers.push_back(result);
+        }
+    }
+    Copy(registers.back(), dst);
+}
+#endif
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program) {
+    if (inputs.empty()) {
+        utility::LogError("FusedEW expects at least one input.");
+    }
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW supports at most {} inputs, but got {}.",
+                          MAX_INPUTS, inputs.size());
+    }
+
+    // Inputs and dst must be on the same device and have the same dtype.
+    Dtype dtype = dst.GetDtype();
+    Device device = dst.GetDevice();
+    SizeVector broadcasted_input_shape = inputs[0].GetShape();
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(), device.ToString());
+        }
+        if (input.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(), dtype.ToString());
+        }
+        broadcasted_input_shape = shape_util::BroadcastedShape(
+                broadcasted_input_shape, input.GetShape());
+    }
+    if (broadcasted_input_shape != dst.GetShape()) {
+        utility::LogError(
+                "The broadcasted input shape {} does not match the output "
+                "shape {}.",
+                broadcasted_input_shape, dst.GetShape());
+    }
+    if (dtype == Dtype::Bool || dtype.IsObject()) {
+        utility::LogError("FusedEW does not support dtype {}.",
+                          dtype.ToString());
+    }
+
+    // Only arithmetic ops are fused, since they preserve the dtype.
+    int64_t num_registers = inputs.size() + program.scalars_.size();
+    for (const FusedEWInstruction& instruction : program.instructions_) {
+        if (instruction.lhs_ < 0 || instruction.lhs_ >= num_registers ||
+            (instruction.is_binary_ &&
+             (instruction.rhs_ < 0 || instruction.rhs_ >= num_registers))) {
+            utility::LogError("FusedEW: invalid register index.");
+        }
+        if (instruction.is_binary_ &&
+            s_boolean_binary_ew_op_codes.count(instruction.binary_op_code_)) {
+            utility::LogError("FusedEW does not support boolean binary ops.");
+        }
+        if (!instruction.is_binary_ &&
+            instruction.unary_op_code_ == UnaryEWOpCode::LogicalNot) {
+            utility::LogError("FusedEW does not support LogicalNot.");
+        }
+        num_registers++;
+    }
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, dst, program);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWEager(inputs, dst, program);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
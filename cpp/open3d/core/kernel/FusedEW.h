@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// One element-wise op of a FusedEWProgram.
+struct FusedEWInstruction {
+    /// If true, binary_op_code_ is applied to registers lhs_ and rhs_.
+    /// Otherwise, unary_op_code_ is applied to register lhs_.
+    bool is_binary_ = false;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    int64_t lhs_ = 0;
+    int64_t rhs_ = 0;
+};
+
+/// A chain of arithmetic element-wise ops evaluated in a single pass, without
+/// materializing the intermediate results.
+///
+/// Register layout:
+/// - [0, num_inputs): values of the input tensors.
+/// - [num_inputs, num_inputs + scalars_.size()): scalar constants.
+/// - num_inputs + scalars_.size() + i: result of instructions_[i].
+///
+/// The result of the last instruction is written to the output. If there are
+/// no instructions, input 0 is copied to the output.
+struct FusedEWProgram {
+    std::vector<Scalar> scalars_;
+    std::vector<FusedEWInstruction> instructions_;
+};
+
+/// Evaluates \p program element-wise. \p inputs are broadcasted to the shape of
+/// \p dst. All inputs and \p dst must have the same dtype and device. On CPU,
+/// the program runs in one fused pass. On other devices the instructions are
+/// executed one after another with temporary tensors.
+void FusedEW(const std::vector<Tensor>& inputs,
+             Tensor& dst,
+             const FusedEWProgram& program);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                Tensor& dst,
+                const FusedEWProgram& program);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,236 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Number of elements evaluated together. The registers of a tile stay in a
+// per-thread scratch buffer, small enough to remain in L1/L2 cache.
+static constexpr int64_t kTileSize = 256;
+
+template <typename scalar_t>
+static void CPUUnaryTile(UnaryEWOpCode op_code,
+                         const scalar_t* src,
+                         scalar_t* dst,
+                         int64_t n) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(-src[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Floor:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::floor(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Ceil:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::ceil(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Round:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::round(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Trunc:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::trunc(static_cast<double>(src[i])));
+            }
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void CPUBinaryTile(BinaryEWOpCode op_code,
+                          const scalar_t* lhs,
+                          const scalar_t* rhs,
+                          scalar_t* dst,
+                          int64_t n) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < n; ++i) {
+                dst[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("Unimplemented op_code for FusedEWCPU");
+            break;
+    }
+}
+
+template <typename scalar_t>
+static void LaunchFusedEWCPUKernel(const Indexer& indexer,
+                                   const FusedEWProgram& program) {
+    const int64_t num_inputs = indexer.NumInputs();
+    const int64_t num_scalars = static_cast<int64_t>(program.scalars_.size());
+    const int64_t num_instructions =
+            static_cast<int64_t>(program.instructions_.size());
+    const int64_t num_registers = num_inputs + num_scalars + num_instructions;
+    const int64_t result_register =
+            num_instructions == 0 ? 0 : num_registers - 1;
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_tiles = (num_workloads + kTileSize - 1) / kTileSize;
+
+    ParallelFor(num_tiles, 1, [&](int64_t tile_start, int64_t tile_end) {
+        // Scratch registers, allocated once per task.
+        std::vector<scalar_t> registers(num_registers * kTileSize);
+        for (int64_t i = 0; i < num_scalars; ++i) {
+            std::fill_n(&registers[(num_inputs + i) * kTileSize], kTileSize,
+                        program.scalars_[i].To<scalar_t>());
+        }
+
+        for (int64_t tile_idx = tile_start; tile_idx < tile_end; ++tile_idx) {
+            const int64_t start = tile_idx * kTileSize;
+            const int64_t n = std::min(kTileSize, num_workloads - start);
+
+            for (int64_t i = 0; i < num_inputs; ++i) {
+                scalar_t* reg = &registers[i * kTileSize];
+                for (int64_t k = 0; k < n; ++k) {
+                    reg[k] = *reinterpret_cast<const scalar_t*>(
+                            indexer.GetInputPtr(i, start + k));
+                }
+            }
+
+            for (int64_t j = 0; j < num_instructions; ++j) {
+                const FusedEWInstruction& instruction =
+                        program.instructions_[j];
+                scalar_t* reg_dst =
+                        &registers[(num_inputs + num_scalars + j) * kTileSize];
+                const scalar_t* reg_lhs =
+                        &registers[instruction.lhs_ * kTileSize];
+                if (instruction.is_binary_) {
+                    const scalar_t* reg_rhs =
+                            &registers[instruction.rhs_ * kTileSize];
+                    CPUBinaryTile(instruction.binary_op_code_, reg_lhs,
+                                  reg_rhs, reg_dst, n);
+                } else {
+                    CPUUnaryTile(instruction.unary_op_code_, reg_lhs, reg_dst,
+                                 n);
+                }
+            }
+
+            const scalar_t* reg_result =
+                    &registers[result_register * kTileSize];
+            for (int64_t k = 0; k < n; ++k) {
+                *reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(start + k)) =
+                        reg_result[k];
+            }
+        }
+    });
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                Tensor& dst,
+                const FusedEWProgram& program) {
+    Dtype dtype = dst.GetDtype();
+    auto assert_dtype_is_float = [](Dtype dtype) -> void {
+        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+            utility::LogError(
+                    "Only supports Float32 and Float64, but {} is used.",
+                    dtype.ToString());
+        }
+    };
+    for (const FusedEWInstruction& instruction : program.instructions_) {
+        if (!instruction.is_binary_ &&
+            (instruction.unary_op_code_ == UnaryEWOpCode::Sqrt ||
+             instruction.unary_op_code_ == UnaryEWOpCode::Sin ||
+             instruction.unary_op_code_ == UnaryEWOpCode::Cos ||
+             instruction.unary_op_code_ == UnaryEWOpCode::Exp)) {
+            assert_dtype_is_float(dtype);
+        }
+    }
+
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        LaunchFusedEWCPUKernel<scalar_t>(indexer, program);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
@@ -37,6 +38,11 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+/// Bytes of the elements of a tensor.
+static int64_t NumBytes(const Tensor& tensor) {
+    return tensor.NumElements() * tensor.GetDtype().ByteSize();
+}
+
 void IndexGet(const Tensor& src,
               Tensor& dst,
               const std::vector<Tensor>& index_tensors,
@@ -52,6 +58,8 @@ void IndexGet(const Tensor& src,
         return;
     }
 
+    // Reads and writes the bytes of dst.
+    ProfilerScope scope("IndexGetSet", "IndexGet", dst, 2 * NumBytes(dst));
     if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexGetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -72,6 +80,8 @@ void IndexSet(const Tensor& src,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
 
+    // Reads and writes the bytes of src.
+    ProfilerScope scope("IndexGetSet", "IndexSet", dst, 2 * NumBytes(src));
     if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexSetCPU(src_same_device, dst, index_tensors, indexed_shape,
                     indexed_strides);
@@ -85,6 +95,52 @@ void IndexSet(const Tensor& src,
     }
 }
 
+void IndexGetRows(const Tensor& src, Tensor& dst, const Tensor& index) {
+    ProfilerScope scope("IndexGetSet", "IndexGetRows", dst,
+                        2 * NumBytes(dst) + NumBytes(index));
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, dst, index);
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& index) {
+    ProfilerScope scope("IndexGetSet", "IndexSetRows", dst,
+                        2 * NumBytes(src) + NumBytes(index));
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src, dst, index);
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+void IndexReduce(const Tensor& src,
+                 Tensor& dst,
+                 const Tensor& index,
+                 ReductionOpCode op_code) {
+    if (op_code != ReductionOpCode::Sum && op_code != ReductionOpCode::Max) {
+        utility::LogError("IndexReduce: Unsupported reduction op.");
+    }
+    // Reads src, reads and writes the rows of dst it is reduced into.
+    ProfilerScope scope(
+            "IndexGetSet",
+            op_code == ReductionOpCode::Sum ? "IndexAdd" : "IndexMax", dst,
+            3 * NumBytes(src) + NumBytes(index));
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexReduceCPU(src, dst, index, op_code);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        // Reduced on the host, the scattered rows of a CUDA kernel would need
+        // atomics for every dtype.
+        Device host("CPU:0");
+        Tensor dst_host = dst.To(host);
+        IndexReduceCPU(src.To(host), dst_host, index.To(host), op_code);
+        dst.CopyFrom(dst_host);
+    } else {
+        utility::LogError("IndexReduce: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -73,6 +74,31 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Row gather dst[i] = src[index[i]] of contiguous tensors with a 1-D Int64
+/// index, the fast path of IndexGet on the first dimension. CPU only.
+void IndexGetRows(const Tensor& src, Tensor& dst, const Tensor& index);
+
+void IndexGetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index);
+
+/// Row scatter dst[index[i]] = src[i] of contiguous tensors with a 1-D Int64
+/// index, the fast path of IndexSet on the first dimension. CPU only.
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& index);
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index);
+
+/// Row scatter reduction dst[index[i]] = op(dst[index[i]], src[i]) of
+/// contiguous tensors with a 1-D Int64 index. Repeated indices are reduced
+/// in order. Supports ReductionOpCode::Sum and ReductionOpCode::Max.
+void IndexReduce(const Tensor& src,
+                 Tensor& dst,
+                 const Tensor& index,
+                 ReductionOpCode op_code);
+
+void IndexReduceCPU(const Tensor& src,
+                    Tensor& dst,
+                    const Tensor& index,
+                    ReductionOpCode op_code);
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
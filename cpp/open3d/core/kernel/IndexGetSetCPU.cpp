@@ -24,11 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -92,6 +96,192 @@ void IndexSetCPU(const Tensor& src,
     }
 }
 
+namespace {
+
+/// Rows are prefetched this many indices ahead in the row kernels.
+constexpr int64_t kPrefetchDistance = 8;
+
+/// Approximate number of bytes moved by each task of the row kernels.
+constexpr int64_t kRowGrainBytes = 1 << 15;
+
+inline void PrefetchRow(const void* ptr) {
+#if defined(__GNUC__)
+    __builtin_prefetch(ptr);
+#endif
+}
+
+/// Checks that the index is within [-num_rows, num_rows). Negative indices
+/// count from the end, as in IndexGet and IndexSet.
+void CheckRowIndex(const Tensor& index, int64_t num_rows) {
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    const int64_t num_indices = index.NumElements();
+    if (num_indices == 0) {
+        return;
+    }
+    auto min_max = std::minmax_element(index_ptr, index_ptr + num_indices);
+    if (*min_max.first < -num_rows || *min_max.second >= num_rows) {
+        utility::LogError(
+                "Index out of bounds, indices must be in [{}, {}), but got "
+                "[{}, {}].",
+                -num_rows, num_rows, *min_max.first, *min_max.second);
+    }
+}
+
+inline int64_t WrapRow(int64_t index, int64_t num_rows) {
+    return index + num_rows * (index < 0);
+}
+
+/// Copies rows between src and dst, dst[dst_row(i)] = src[src_row(i)] for
+/// i in [0, num_rows). kRowBytes > 0 makes the memcpy size a compile time
+/// constant for the common narrow rows.
+template <int64_t kRowBytes, typename src_row_t, typename dst_row_t>
+void CopyRows(const char* src,
+              char* dst,
+              int64_t num_rows,
+              int64_t row_bytes_,
+              src_row_t src_row,
+              dst_row_t dst_row) {
+    const int64_t row_bytes = kRowBytes > 0 ? kRowBytes : row_bytes_;
+    const int64_t grain_size = std::max<int64_t>(1, kRowGrainBytes / row_bytes);
+    ParallelFor(num_rows, grain_size, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            if (i + kPrefetchDistance < end) {
+                PrefetchRow(src + src_row(i + kPrefetchDistance) * row_bytes);
+            }
+            std::memcpy(dst + dst_row(i) * row_bytes,
+                        src + src_row(i) * row_bytes, row_bytes);
+        }
+    });
+}
+
+template <typename src_row_t, typename dst_row_t>
+void CopyRows(const char* src,
+              char* dst,
+              int64_t num_rows,
+              int64_t row_bytes,
+              src_row_t src_row,
+              dst_row_t dst_row) {
+    switch (row_bytes) {
+        case 4:
+            CopyRows<4>(src, dst, num_rows, row_bytes, src_row, dst_row);
+            break;
+        case 8:
+            CopyRows<8>(src, dst, num_rows, row_bytes, src_row, dst_row);
+            break;
+        case 12:
+            CopyRows<12>(src, dst, num_rows, row_bytes, src_row, dst_row);
+            break;
+        case 16:
+            CopyRows<16>(src, dst, num_rows, row_bytes, src_row, dst_row);
+            break;
+        case 24:
+            CopyRows<24>(src, dst, num_rows, row_bytes, src_row, dst_row);
+            break;
+        default:
+            CopyRows<0>(src, dst, num_rows, row_bytes, src_row, dst_row);
+    }
+}
+
+/// Each task owns a range of the dst rows and scans the whole index for the
+/// rows it owns, so that repeated indices are reduced without atomics and in
+/// the same order for any number of threads.
+template <typename scalar_t, typename func_t>
+void ReduceRows(const scalar_t* src,
+                scalar_t* dst,
+                const int64_t* index,
+                int64_t num_indices,
+                int64_t num_dst_rows,
+                int64_t row_size,
+                func_t reduce) {
+    const int64_t num_bytes = num_indices * row_size * sizeof(scalar_t);
+    const int64_t num_tasks =
+            num_bytes < kRowGrainBytes
+                    ? 1
+                    : std::min<int64_t>(GetMaxThreads(), num_dst_rows);
+    ParallelFor(num_tasks, 1, [&](int64_t start, int64_t end) {
+        for (int64_t task = start; task < end; ++task) {
+            const int64_t row_begin = num_dst_rows * task / num_tasks;
+            const int64_t row_end = num_dst_rows * (task + 1) / num_tasks;
+            for (int64_t i = 0; i < num_indices; ++i) {
+                const int64_t row = WrapRow(index[i], num_dst_rows);
+                if (row < row_begin || row >= row_end) {
+                    continue;
+                }
+                scalar_t* dst_row = dst + row * row_size;
+                const scalar_t* src_row = src + i * row_size;
+                for (int64_t j = 0; j < row_size; ++j) {
+                    dst_row[j] = reduce(dst_row[j], src_row[j]);
+                }
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void IndexGetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index) {
+    const int64_t num_src_rows = src.GetShape()[0];
+    CheckRowIndex(index, num_src_rows);
+    const int64_t num_indices = index.NumElements();
+    if (num_indices == 0 || dst.NumElements() == 0) {
+        return;
+    }
+    const int64_t row_bytes =
+            dst.NumElements() / num_indices * src.GetDtype().ByteSize();
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    CopyRows(
+            static_cast<const char*>(src.GetDataPtr()),
+            static_cast<char*>(dst.GetDataPtr()), num_indices, row_bytes,
+            [&](int64_t i) { return WrapRow(index_ptr[i], num_src_rows); },
+            [](int64_t i) { return i; });
+}
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index) {
+    const int64_t num_dst_rows = dst.GetShape()[0];
+    CheckRowIndex(index, num_dst_rows);
+    const int64_t num_indices = index.NumElements();
+    if (num_indices == 0 || src.NumElements() == 0) {
+        return;
+    }
+    const int64_t row_bytes =
+            src.NumElements() / num_indices * src.GetDtype().ByteSize();
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    CopyRows(
+            static_cast<const char*>(src.GetDataPtr()),
+            static_cast<char*>(dst.GetDataPtr()), num_indices, row_bytes,
+            [](int64_t i) { return i; },
+            [&](int64_t i) { return WrapRow(index_ptr[i], num_dst_rows); });
+}
+
+void IndexReduceCPU(const Tensor& src,
+                    Tensor& dst,
+                    const Tensor& index,
+                    ReductionOpCode op_code) {
+    const int64_t num_dst_rows = dst.GetShape()[0];
+    CheckRowIndex(index, num_dst_rows);
+    const int64_t num_indices = index.NumElements();
+    if (num_indices == 0 || src.NumElements() == 0) {
+        return;
+    }
+    const int64_t row_size = src.NumElements() / num_indices;
+    const int64_t* index_ptr = static_cast<const int64_t*>(index.GetDataPtr());
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        if (op_code == ReductionOpCode::Sum) {
+            ReduceRows(src_ptr, dst_ptr, index_ptr, num_indices, num_dst_rows,
+                       row_size, [](scalar_t a, scalar_t b) { return a + b; });
+        } else if (op_code == ReductionOpCode::Max) {
+            ReduceRows(src_ptr, dst_ptr, index_ptr, num_indices, num_dst_rows,
+                       row_size,
+                       [](scalar_t a, scalar_t b) { return a < b ? b : a; });
+        } else {
+            utility::LogError("IndexReduceCPU: Unsupported reduction op.");
+        }
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -49,6 +49,36 @@ Tensor NonZero(const Tensor& src) {
     }
 }
 
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask) {
+    mask.AssertDtype(Dtype::Bool);
+    mask.AssertDevice(src.GetDevice());
+    const SizeVector src_shape = src.GetShape();
+    const int64_t mask_dims = mask.NumDims();
+    if (mask_dims == 0 || mask_dims > src.NumDims() ||
+        mask.GetShape() !=
+                SizeVector(src_shape.begin(), src_shape.begin() + mask_dims)) {
+        utility::LogError(
+                "MaskedSelect: mask shape {} does not match the leading "
+                "dimensions of tensor shape {}.",
+                mask.GetShape().ToString(), src_shape.ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return MaskedSelectCPU(src, mask);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // Advanced indexing with the expanded mask.
+        std::vector<Tensor> index_tensors = mask.NonZeroNumpy();
+        return src.IndexGet(index_tensors);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("MaskedSelect: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
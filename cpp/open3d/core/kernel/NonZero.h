@@ -40,6 +40,13 @@ Tensor NonZeroCPU(const Tensor& src);
 Tensor NonZeroCUDA(const Tensor& src);
 #endif
 
+/// Selects the slices of src where the boolean mask is true. The shape of
+/// mask must match the leading dimensions of src. The result has shape
+/// {num_true, src.shape[mask.NumDims():]...}.
+Tensor MaskedSelect(const Tensor& src, const Tensor& mask);
+
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask);
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
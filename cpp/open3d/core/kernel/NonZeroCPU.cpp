@@ -24,53 +24,155 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/kernel/NonZero.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+namespace {
+
+/// Number of elements per task of the compaction.
+constexpr int64_t kChunkSize = 1 << 14;
+
+/// Rows up to this size are copied without branching on the mask.
+constexpr int64_t kMaxBranchlessRowBytes = 64;
+
+inline int64_t NumChunks(int64_t num_elements) {
+    return (num_elements + kChunkSize - 1) / kChunkSize;
+}
+
+/// Counts the non-zero elements of each chunk of src. Returns the inclusive
+/// prefix sum of the counts, i.e. the output offset after each chunk.
+template <typename scalar_t>
+std::vector<int64_t> ChunkOffsets(const scalar_t* src, int64_t num_elements) {
+    const int64_t num_chunks = NumChunks(num_elements);
+    std::vector<int64_t> offsets(num_chunks);
+    ParallelFor(num_chunks, 1, [&](int64_t start, int64_t end) {
+        for (int64_t chunk = start; chunk < end; ++chunk) {
+            const int64_t last =
+                    std::min(num_elements, (chunk + 1) * kChunkSize);
+            int64_t count = 0;
+            for (int64_t i = chunk * kChunkSize; i < last; ++i) {
+                count += src[i] != static_cast<scalar_t>(0);
+            }
+            offsets[chunk] = count;
+        }
+    });
+    utility::InclusivePrefixSum(offsets.data(), offsets.data() + num_chunks,
+                                offsets.data());
+    return offsets;
+}
+
+}  // namespace
+
 Tensor NonZeroCPU(const Tensor& src) {
-    // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
+    Tensor src_contiguous = src.Contiguous();
+    const SizeVector shape = src.GetShape();
+    const int64_t num_dims = src.NumDims();
     const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
+    Tensor result;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    return static_cast<float>(*static_cast<scalar_t*>(
-                                   src_iter.GetPtr(index))) != 0;
-                });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
-    });
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        const std::vector<int64_t> offsets =
+                ChunkOffsets(src_ptr, num_elements);
+        const int64_t num_non_zeros = offsets.empty() ? 0 : offsets.back();
+        result = Tensor({num_dims, num_non_zeros}, Dtype::Int64,
+                        src.GetDevice());
+        int64_t* result_ptr = static_cast<int64_t*>(result.GetDataPtr());
 
-    // Transform flattend indices to indices in each dimension.
-    SizeVector shape = src.GetShape();
-    const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
+        // Each chunk writes the indices in each dimension of its non-zero
+        // elements directly to its range of the output.
+        ParallelFor(NumChunks(num_elements), 1, [&](int64_t start,
+                                                    int64_t end) {
+            for (int64_t chunk = start; chunk < end; ++chunk) {
+                int64_t out = chunk == 0 ? 0 : offsets[chunk - 1];
+                const int64_t out_end = offsets[chunk];
+                const int64_t first = chunk * kChunkSize;
+                int64_t index[MAX_DIMS];
+                int64_t flat_index = first;
+                for (int64_t dim = num_dims - 1; dim >= 0; --dim) {
+                    index[dim] = flat_index % shape[dim];
+                    flat_index /= shape[dim];
+                }
+                // The index is written unconditionally and overwritten if the
+                // element is zero, which avoids mispredicted branches on
+                // random masks. The loop stops after the last non-zero.
+                for (int64_t i = first; out < out_end; ++i) {
+                    for (int64_t dim = 0; dim < num_dims; ++dim) {
+                        result_ptr[dim * num_non_zeros + out] = index[dim];
+                    }
+                    out += src_ptr[i] != static_cast<scalar_t>(0);
+                    for (int64_t dim = num_dims - 1; dim >= 0; --dim) {
+                        if (++index[dim] < shape[dim]) {
+                            break;
+                        }
+                        index[dim] = 0;
+                    }
+                }
+            }
+        });
+    });
+    return result;
+}
 
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, Dtype::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+Tensor MaskedSelectCPU(const Tensor& src, const Tensor& mask) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor mask_contiguous = mask.Contiguous();
+    const int64_t num_rows = mask.NumElements();
+    const bool* mask_ptr =
+            static_cast<const bool*>(mask_contiguous.GetDataPtr());
+    const std::vector<int64_t> offsets = ChunkOffsets(mask_ptr, num_rows);
+    const int64_t num_selected = offsets.empty() ? 0 : offsets.back();
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#pragma omp parallel for schedule(static)
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
-        int64_t non_zero_index = non_zero_indices[i];
-        for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            *static_cast<int64_t*>(result_iter.GetPtr(
-                    dim * num_non_zeros + i)) = non_zero_index % shape[dim];
-            non_zero_index = non_zero_index / shape[dim];
-        }
+    SizeVector dst_shape{num_selected};
+    int64_t row_size = 1;
+    for (int64_t dim = mask.NumDims(); dim < src.NumDims(); ++dim) {
+        dst_shape.push_back(src.GetShape()[dim]);
+        row_size *= src.GetShape()[dim];
+    }
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t row_bytes = row_size * src.GetDtype().ByteSize();
+    if (row_bytes == 0) {
+        return dst;
     }
 
-    return result;
+    const char* src_ptr =
+            static_cast<const char*>(src_contiguous.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    ParallelFor(NumChunks(num_rows), 1, [&](int64_t start, int64_t end) {
+        for (int64_t chunk = start; chunk < end; ++chunk) {
+            int64_t out = chunk == 0 ? 0 : offsets[chunk - 1];
+            const int64_t out_end = offsets[chunk];
+            if (row_bytes <= kMaxBranchlessRowBytes) {
+                // Copy every row, unselected rows are overwritten.
+                for (int64_t i = chunk * kChunkSize; out < out_end; ++i) {
+                    std::memcpy(dst_ptr + out * row_bytes,
+                                src_ptr + i * row_bytes, row_bytes);
+                    out += mask_ptr[i];
+                }
+            } else {
+                for (int64_t i = chunk * kChunkSize; out < out_end; ++i) {
+                    if (mask_ptr[i]) {
+                        std::memcpy(dst_ptr + out * row_bytes,
+                                    src_ptr + i * row_bytes, row_bytes);
+                        ++out;
+                    }
+                }
+            }
+        }
+    });
+    return dst;
 }
 
 }  // namespace kernel
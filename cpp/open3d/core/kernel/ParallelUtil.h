@@ -26,25 +26,19 @@
 
 #pragma once
 
+#include "open3d/core/CPUExecutor.h"
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
+/// Number of threads of the current CPU executor.
 inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
+    return static_cast<int>(GetCPUExecutor()->GetNumThreads());
 }
 
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
-}
+/// True if called from inside a parallel loop of the current CPU executor.
+inline bool InParallel() { return GetCPUExecutor()->InParallel(); }
 
 }  // namespace kernel
 }  // namespace core
@@ -26,12 +26,35 @@
 
 #include "open3d/core/kernel/Reduction.h"
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/SizeVector.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+static const char* ReductionOpName(ReductionOpCode op_code) {
+    switch (op_code) {
+        case ReductionOpCode::Sum:
+            return "Sum";
+        case ReductionOpCode::Prod:
+            return "Prod";
+        case ReductionOpCode::Min:
+            return "Min";
+        case ReductionOpCode::Max:
+            return "Max";
+        case ReductionOpCode::ArgMin:
+            return "ArgMin";
+        case ReductionOpCode::ArgMax:
+            return "ArgMax";
+        case ReductionOpCode::All:
+            return "All";
+        case ReductionOpCode::Any:
+            return "Any";
+    }
+    return "Unknown";
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
@@ -88,6 +111,7 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    ProfilerScope scope("Reduction", ReductionOpName(op_code), {&src, &dst});
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         ReductionCPU(src, dst, dims, keepdim, op_code);
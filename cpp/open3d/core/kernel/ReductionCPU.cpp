@@ -24,11 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdlib>
 #include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPUVectorized.h"
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Console.h"
@@ -85,112 +88,318 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// A group of dimensions of a reduction, e.g. all kept dimensions or all
+/// reduced dimensions, with the source and destination byte strides. The
+/// dimensions are visited in row-major order.
+struct ReductionDimGroup {
+    int64_t ndims_ = 0;
+    int64_t shape_[MAX_DIMS];
+    int64_t src_byte_strides_[MAX_DIMS];
+    int64_t dst_byte_strides_[MAX_DIMS];
+
+    void AddDim(int64_t size,
+                int64_t src_byte_stride,
+                int64_t dst_byte_stride) {
+        shape_[ndims_] = size;
+        src_byte_strides_[ndims_] = src_byte_stride;
+        dst_byte_strides_[ndims_] = dst_byte_stride;
+        ndims_++;
+    }
+
+    int64_t NumElements() const {
+        int64_t num_elements = 1;
+        for (int64_t i = 0; i < ndims_; ++i) {
+            num_elements *= shape_[i];
+        }
+        return num_elements;
+    }
+
+    /// Absolute source byte stride of the innermost dimension, or 0 if the
+    /// group has no dimension.
+    int64_t InnerSrcByteStride() const {
+        return ndims_ == 0 ? 0 : std::abs(src_byte_strides_[ndims_ - 1]);
+    }
+};
+
+/// Visits the elements of a ReductionDimGroup in order, updating the byte
+/// offsets incrementally instead of decomposing a linear index per element.
+class ReductionDimIterator {
+public:
+    ReductionDimIterator(const ReductionDimGroup& group, int64_t start_idx)
+        : group_(group) {
+        for (int64_t i = group_.ndims_ - 1; i >= 0; --i) {
+            index_[i] = start_idx % group_.shape_[i];
+            start_idx /= group_.shape_[i];
+            src_offset_ += index_[i] * group_.src_byte_strides_[i];
+            dst_offset_ += index_[i] * group_.dst_byte_strides_[i];
+        }
+    }
+
+    void Next() {
+        for (int64_t i = group_.ndims_ - 1; i >= 0; --i) {
+            index_[i]++;
+            src_offset_ += group_.src_byte_strides_[i];
+            dst_offset_ += group_.dst_byte_strides_[i];
+            if (index_[i] < group_.shape_[i]) {
+                return;
+            }
+            src_offset_ -= group_.shape_[i] * group_.src_byte_strides_[i];
+            dst_offset_ -= group_.shape_[i] * group_.dst_byte_strides_[i];
+            index_[i] = 0;
+        }
+    }
+
+    int64_t GetSrcOffset() const { return src_offset_; }
+    int64_t GetDstOffset() const { return dst_offset_; }
+
+private:
+    const ReductionDimGroup& group_;
+    int64_t index_[MAX_DIMS];
+    int64_t src_offset_ = 0;
+    int64_t dst_offset_ = 0;
+};
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
     CPUReductionEngine& operator=(const CPUReductionEngine&) = delete;
     CPUReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
 
-    template <typename func_t, typename scalar_t>
-    void Run(const func_t& reduce_func, scalar_t identity) {
-        // See: PyTorch's TensorIterator::parallel_reduce for the reference
-        // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
-            LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
-        } else if (indexer_.NumOutputElements() <= 1) {
-            LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
-                                                   identity);
+    /// \param reduce_func A function that takes two acc_t values and returns
+    /// the reduced acc_t value.
+    /// \param identity Identity of reduce_func. The input and output elements
+    /// are of type scalar_t and the partial results are accumulated in acc_t,
+    /// e.g. float for Float16.
+    template <typename scalar_t, typename func_t, typename acc_t>
+    void Run(const func_t& reduce_func, acc_t identity) {
+        if (indexer_.NumWorkloads() == 0) {
+            // The output has already been filled with identity.
+            return;
+        }
+        if (indexer_.NumOutputElements() <= 1 &&
+            indexer_.IsInputContiguous(0)) {
+            LaunchReductionKernelVectorized<scalar_t>(indexer_, reduce_func,
+                                                      identity);
         } else {
-            LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
+            LaunchReductionKernelTiled<scalar_t>(indexer_, reduce_func,
+                                                 identity);
         }
     }
 
 private:
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelSerial(const Indexer& indexer,
-                                            func_t element_kernel) {
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            scalar_t* src = reinterpret_cast<scalar_t*>(
-                    indexer.GetInputPtr(0, workload_idx));
-            scalar_t* dst = reinterpret_cast<scalar_t*>(
-                    indexer.GetOutputPtr(workload_idx));
-            *dst = element_kernel(*src, *dst);
-        }
-    }
-
-    /// Create num_threads workers to compute partial reductions and then reduce
-    /// to the final results. This only applies to reduction op with one output.
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionKernelTwoPass(const Indexer& indexer,
-                                             func_t element_kernel,
-                                             scalar_t identity) {
-        if (indexer.NumOutputElements() > 1) {
-            utility::LogError(
-                    "Internal error: two-pass reduction only works for "
-                    "single-output reduction ops.");
-        }
+    /// Reduces a contiguous input to a single output. The input is split into
+    /// one chunk per thread and each chunk is reduced with
+    /// VectorizedReduceLoop. This only applies to reduction op with one output.
+    template <typename scalar_t, typename func_t, typename acc_t>
+    static void LaunchReductionKernelVectorized(const Indexer& indexer,
+                                                func_t element_kernel,
+                                                acc_t identity) {
+        const scalar_t* src =
+                reinterpret_cast<const scalar_t*>(indexer.GetInputPtr(0, 0));
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = InParallel() ? 1 : GetMaxThreads();
+        num_threads = std::max<int64_t>(
+                1, std::min(num_threads, num_workloads / kMinWorkloadsPerTask));
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
-        std::vector<scalar_t> thread_results(num_threads, identity);
+        std::vector<acc_t> thread_results(num_threads, identity);
+        auto reduce_func = [&](acc_t acc, acc_t value) {
+            return element_kernel(value, acc);
+        };
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
+        ParallelFor(num_threads, 1, [&](int64_t task_start, int64_t task_end) {
+            for (int64_t thread_idx = task_start; thread_idx < task_end;
+                 ++thread_idx) {
+                int64_t start = thread_idx * workload_per_thread;
+                int64_t end =
+                        std::min(start + workload_per_thread, num_workloads);
+                if (start < end) {
+                    thread_results[thread_idx] = VectorizedReduceLoop(
+                            src + start, end - start, identity, reduce_func);
+                }
             }
-        }
+        });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
+        acc_t result = static_cast<acc_t>(*dst);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            *dst = element_kernel(thread_results[thread_idx], *dst);
+            result = element_kernel(thread_results[thread_idx], result);
         }
+        *dst = static_cast<scalar_t>(result);
     }
 
-    template <typename scalar_t, typename func_t>
-    static void LaunchReductionParallelDim(const Indexer& indexer,
-                                           func_t element_kernel) {
-        // Prefers outer dimension >= num_threads.
-        const int64_t* indexer_shape = indexer.GetMasterShape();
-        const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
-
-        // Init best_dim as the outer-most non-reduction dim.
-        int64_t best_dim = num_dims - 1;
-        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
-            best_dim--;
-        }
-        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
-             --dim) {
-            if (indexer_shape[dim] >= num_threads) {
-                best_dim = dim;
-                break;
-            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
-                best_dim = dim;
+    /// Reduction with any mix of kept and reduced dimensions.
+    ///
+    /// The outputs are split into tiles of up to kTileSize elements, and the
+    /// reduced elements are split into num_splits ranges, so that there are
+    /// enough (tile, split) tasks for all threads even when there are only a
+    /// few outputs, e.g. when reducing a (N, 3) tensor over dim 0. Each task
+    /// accumulates its tile in a small local buffer. If the innermost
+    /// dimension of the input is reduced, each output is reduced over its
+    /// range in turn, otherwise the task walks the reduced elements in the
+    /// outer loop and the tile in the inner loop, so that the input is read in
+    /// memory order in both cases. Contiguous reduced ranges are reduced with
+    /// VectorizedReduceLoop. With num_splits > 1, the partial results
+    /// are combined after all tasks finish.
+    template <typename scalar_t, typename func_t, typename acc_t>
+    static void LaunchReductionKernelTiled(const Indexer& indexer,
+                                           func_t element_kernel,
+                                           acc_t identity) {
+        ReductionDimGroup keep_dims;
+        ReductionDimGroup reduce_dims;
+        const int64_t* master_shape = indexer.GetMasterShape();
+        const TensorRef& src_tr = indexer.GetInput(0);
+        const TensorRef& dst_tr = indexer.GetOutput(0);
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (master_shape[dim] <= 1) {
+                continue;
+            } else if (indexer.IsReductionDim(dim)) {
+                reduce_dims.AddDim(master_shape[dim], src_tr.byte_strides_[dim],
+                                   0);
+            } else {
+                keep_dims.AddDim(master_shape[dim], src_tr.byte_strides_[dim],
+                                 dst_tr.byte_strides_[dim]);
             }
         }
-        if (best_dim == -1) {
-            utility::LogError(
-                    "Internal error: all dims are reduction dims, use "
-                    "LaunchReductionKernelTwoPass instead.");
+        const char* src = static_cast<const char*>(src_tr.data_ptr_);
+        char* dst = static_cast<char*>(dst_tr.data_ptr_);
+        const int64_t num_outputs = keep_dims.NumElements();
+        const int64_t num_reduced = reduce_dims.NumElements();
+        const bool reduce_inner = reduce_dims.ndims_ > 0 &&
+                                  reduce_dims.InnerSrcByteStride() <
+                                          keep_dims.InnerSrcByteStride();
+        const bool reduce_contiguous =
+                reduce_dims.ndims_ == 1 &&
+                reduce_dims.src_byte_strides_[0] ==
+                        static_cast<int64_t>(sizeof(scalar_t));
+
+        // Choose the number of splits of the reduced elements.
+        const int64_t num_threads = InParallel() ? 1 : GetMaxThreads();
+        const int64_t tile_size = std::min(num_outputs, kTileSize);
+        const int64_t num_tiles = (num_outputs + tile_size - 1) / tile_size;
+        int64_t num_splits = 1;
+        if (num_tiles < num_threads) {
+            num_splits = (num_threads + num_tiles - 1) / num_tiles;
+            num_splits = std::min(
+                    num_splits,
+                    num_reduced * tile_size / kMinWorkloadsPerTask);
+            num_splits = std::max<int64_t>(1, num_splits);
         }
+        const int64_t reduced_per_split =
+                (num_reduced + num_splits - 1) / num_splits;
+        const int64_t num_tasks = num_tiles * num_splits;
+
+        // Partial results of each split, only used if num_splits > 1.
+        std::vector<acc_t> partials(num_splits > 1 ? num_splits * num_outputs
+                                                   : 0);
+
+        auto run_task = [&](int64_t task_idx) {
+            const int64_t tile_idx = task_idx / num_splits;
+            const int64_t split_idx = task_idx % num_splits;
+            const int64_t output_start = tile_idx * tile_size;
+            const int64_t num_tile_outputs =
+                    std::min(tile_size, num_outputs - output_start);
+            const int64_t reduced_start = split_idx * reduced_per_split;
+            const int64_t reduced_end =
+                    std::min(reduced_start + reduced_per_split, num_reduced);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+            int64_t src_offsets[kTileSize];
+            int64_t dst_offsets[kTileSize];
+            acc_t acc[kTileSize];
+            ReductionDimIterator keep_it(keep_dims, output_start);
+            for (int64_t i = 0; i < num_tile_outputs; ++i, keep_it.Next()) {
+                src_offsets[i] = keep_it.GetSrcOffset();
+                dst_offsets[i] = keep_it.GetDstOffset();
+                acc[i] = identity;
+            }
+
+            if (reduce_inner && reduce_contiguous) {
+                auto reduce_func = [&](acc_t acc, acc_t value) {
+                    return element_kernel(value, acc);
+                };
+                for (int64_t i = 0; i < num_tile_outputs; ++i) {
+                    const scalar_t* src_range =
+                            reinterpret_cast<const scalar_t*>(
+                                    src + src_offsets[i]) +
+                            reduced_start;
+                    acc[i] = VectorizedReduceLoop(src_range,
+                                                  reduced_end - reduced_start,
+                                                  identity, reduce_func);
+                }
+            } else if (reduce_inner) {
+                for (int64_t i = 0; i < num_tile_outputs; ++i) {
+                    const char* src_tile = src + src_offsets[i];
+                    acc_t value = identity;
+                    ReductionDimIterator reduce_it(reduce_dims, reduced_start);
+                    for (int64_t r = reduced_start; r < reduced_end;
+                         ++r, reduce_it.Next()) {
+                        value = element_kernel(
+                                static_cast<acc_t>(
+                                        *reinterpret_cast<const scalar_t*>(
+                                                src_tile +
+                                                reduce_it.GetSrcOffset())),
+                                value);
+                    }
+                    acc[i] = value;
+                }
+            } else {
+                ReductionDimIterator reduce_it(reduce_dims, reduced_start);
+                for (int64_t r = reduced_start; r < reduced_end;
+                     ++r, reduce_it.Next()) {
+                    const char* src_row = src + reduce_it.GetSrcOffset();
+                    for (int64_t i = 0; i < num_tile_outputs; ++i) {
+                        acc[i] = element_kernel(
+                                static_cast<acc_t>(
+                                        *reinterpret_cast<const scalar_t*>(
+                                                src_row + src_offsets[i])),
+                                acc[i]);
+                    }
+                }
+            }
+
+            if (num_splits == 1) {
+                for (int64_t i = 0; i < num_tile_outputs; ++i) {
+                    scalar_t* dst_ptr =
+                            reinterpret_cast<scalar_t*>(dst + dst_offsets[i]);
+                    *dst_ptr = static_cast<scalar_t>(element_kernel(
+                            acc[i], static_cast<acc_t>(*dst_ptr)));
+                }
+            } else {
+                acc_t* split_partials =
+                        partials.data() + split_idx * num_outputs;
+                for (int64_t i = 0; i < num_tile_outputs; ++i) {
+                    split_partials[output_start + i] = acc[i];
+                }
+            }
+        };
+        ParallelFor(num_tasks, 1, [&](int64_t start, int64_t end) {
+            for (int64_t task_idx = start; task_idx < end; ++task_idx) {
+                run_task(task_idx);
+            }
+        });
+
+        if (num_splits > 1) {
+            ReductionDimIterator keep_it(keep_dims, 0);
+            for (int64_t i = 0; i < num_outputs; ++i, keep_it.Next()) {
+                scalar_t* dst_ptr = reinterpret_cast<scalar_t*>(
+                        dst + keep_it.GetDstOffset());
+                acc_t result = static_cast<acc_t>(*dst_ptr);
+                for (int64_t split_idx = 0; split_idx < num_splits;
+                     ++split_idx) {
+                    result = element_kernel(
+                            partials[split_idx * num_outputs + i], result);
+                }
+                *dst_ptr = static_cast<scalar_t>(result);
+            }
         }
     }
 
-private:
+    /// Maximum number of outputs reduced together by one task.
+    static constexpr int64_t kTileSize = 256;
+
+    /// Minimum number of input elements per task, to amortize the scheduling
+    /// overhead.
+    static constexpr int64_t kMinWorkloadsPerTask = 32768;
+
     Indexer indexer_;
 };
 
@@ -208,24 +417,25 @@ public:
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static)
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+        ParallelFor(num_output_elements, 1, [&](int64_t start, int64_t end) {
+            for (int64_t output_idx = start; output_idx < end; output_idx++) {
+                // sub_indexer.NumWorkloads() == ipo.
+                // sub_indexer's workload_idx is indexer_'s ipo_idx.
+                Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
+                scalar_t dst_val = identity;
+                for (int64_t workload_idx = 0;
+                     workload_idx < sub_indexer.NumWorkloads();
+                     workload_idx++) {
+                    int64_t src_idx = workload_idx;
+                    scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                            sub_indexer.GetInputPtr(0, workload_idx));
+                    int64_t* dst_idx = reinterpret_cast<int64_t*>(
+                            sub_indexer.GetOutputPtr(0, workload_idx));
+                    std::tie(*dst_idx, dst_val) = reduce_func(
+                            src_idx, *src_val, *dst_idx, dst_val);
+                }
             }
-        }
+        });
     }
 
 private:
@@ -241,17 +451,26 @@ void ReductionCPU(const Tensor& src,
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            using acc_t = typename AccumulationType<scalar_t>::type;
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     identity = 0;
                     dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    re.Run<scalar_t>(
+                            [](acc_t a, acc_t b) {
+                                return CPUSumReductionKernel(a, b);
+                            },
+                            static_cast<acc_t>(identity));
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
                     dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    re.Run<scalar_t>(
+                            [](acc_t a, acc_t b) {
+                                return CPUProdReductionKernel(a, b);
+                            },
+                            static_cast<acc_t>(identity));
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
@@ -260,7 +479,11 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
                         dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        re.Run<scalar_t>(
+                                [](acc_t a, acc_t b) {
+                                    return CPUMinReductionKernel(a, b);
+                                },
+                                static_cast<acc_t>(identity));
                     }
                     break;
                 case ReductionOpCode::Max:
@@ -270,7 +493,11 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
                         dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        re.Run<scalar_t>(
+                                [](acc_t a, acc_t b) {
+                                    return CPUMaxReductionKernel(a, b);
+                                },
+                                static_cast<acc_t>(identity));
                     }
                     break;
                 default:
@@ -331,12 +558,14 @@ void ReductionCPU(const Tensor& src,
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
                 dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
+                re.Run<uint8_t>(CPUAllReductionKernel,
+                                static_cast<uint8_t>(true));
                 break;
             case ReductionOpCode::Any:
                 // Identity == false. 0-sized tensor, returns false.
                 dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
+                re.Run<uint8_t>(CPUAnyReductionKernel,
+                                static_cast<uint8_t>(false));
                 break;
             default:
                 utility::LogError("Unsupported op code.");
@@ -86,6 +86,25 @@ OPEN3D_DEVICE __forceinline__ T WARP_SHFL_DOWN(T value,
 #endif
 }
 
+// Shuffles the raw bits of 16-bit floating point types.
+OPEN3D_DEVICE __forceinline__ open3d::core::Float16 WARP_SHFL_DOWN(
+        open3d::core::Float16 value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    return open3d::core::Float16::FromBits(static_cast<uint16_t>(
+            WARP_SHFL_DOWN(static_cast<int>(value.bits_), delta, width, mask)));
+}
+
+OPEN3D_DEVICE __forceinline__ open3d::core::BFloat16 WARP_SHFL_DOWN(
+        open3d::core::BFloat16 value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    return open3d::core::BFloat16::FromBits(static_cast<uint16_t>(
+            WARP_SHFL_DOWN(static_cast<int>(value.bits_), delta, width, mask)));
+}
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -1008,6 +1027,21 @@ void ReductionCUDA(const Tensor& src,
                    const SizeVector& dims,
                    bool keepdim,
                    ReductionOpCode op_code) {
+    if ((src.GetDtype() == Dtype::Float16 ||
+         src.GetDtype() == Dtype::BFloat16) &&
+        s_boolean_reduce_ops.find(op_code) == s_boolean_reduce_ops.end()) {
+        // 16-bit floats are reduced in Float32 to avoid accumulating rounding
+        // errors, then the regular reduction results are converted back.
+        Tensor src_float = src.To(Dtype::Float32);
+        if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
+            Tensor dst_float = dst.To(Dtype::Float32);
+            ReductionCUDA(src_float, dst_float, dims, keepdim, op_code);
+            dst.AsRvalue() = dst_float.To(dst.GetDtype());
+        } else {
+            ReductionCUDA(src_float, dst, dims, keepdim, op_code);
+        }
+        return;
+    }
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CUDAReductionEngine re(indexer);
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/SegmentReduction.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void SegmentReduction(const Tensor& src,
+                      Tensor& dst,
+                      const Tensor& row_splits,
+                      ReductionOpCode op_code) {
+    if (op_code != ReductionOpCode::Sum && op_code != ReductionOpCode::Max) {
+        utility::LogError("SegmentReduction: Unsupported reduction op.");
+    }
+    dst.AssertDtype(src.GetDtype());
+    row_splits.AssertDtype(Dtype::Int64);
+    if (row_splits.NumDims() != 1 || row_splits.GetShape()[0] == 0) {
+        utility::LogError("row_splits must be a non-empty 1-D tensor.");
+    }
+    if (src.NumDims() == 0) {
+        utility::LogError("Cannot reduce segments of a 0-D tensor.");
+    }
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = row_splits.GetShape()[0] - 1;
+    if (dst.GetShape() != dst_shape) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          dst_shape.ToString(), dst.GetShape().ToString());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReductionCPU(src, dst, row_splits.To(src.GetDevice()),
+                            op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        // Reduced on the host.
+        Device host("CPU:0");
+        Tensor dst_host = dst.To(host);
+        SegmentReductionCPU(src.To(host), dst_host, row_splits.To(host),
+                            op_code);
+        dst.CopyFrom(dst_host);
+    } else {
+        utility::LogError("SegmentReduction: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
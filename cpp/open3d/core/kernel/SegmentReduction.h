@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Reduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Reduces the rows [row_splits[i], row_splits[i + 1]) of src into dst[i].
+/// row_splits is a 1-D Int64 tensor starting at 0 and ending at the number
+/// of rows of src, dst has shape {row_splits.shape[0] - 1, src.shape[1:]...}.
+/// Empty segments are set to 0. Supports ReductionOpCode::Sum and
+/// ReductionOpCode::Max.
+void SegmentReduction(const Tensor& src,
+                      Tensor& dst,
+                      const Tensor& row_splits,
+                      ReductionOpCode op_code);
+
+void SegmentReductionCPU(const Tensor& src,
+                         Tensor& dst,
+                         const Tensor& row_splits,
+                         ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+/// Approximate number of elements reduced by each task.
+constexpr int64_t kGrainSize = 1 << 15;
+
+template <typename scalar_t, typename func_t>
+void ReduceSegments(const scalar_t* src,
+                    scalar_t* dst,
+                    const int64_t* row_splits,
+                    int64_t num_segments,
+                    int64_t num_rows,
+                    int64_t row_size,
+                    func_t reduce) {
+    const int64_t grain_size = std::max<int64_t>(
+            1, kGrainSize * num_segments /
+                       std::max<int64_t>(1, num_rows * row_size));
+    ParallelFor(num_segments, grain_size, [&](int64_t start, int64_t end) {
+        for (int64_t segment = start; segment < end; ++segment) {
+            const int64_t begin = row_splits[segment];
+            const int64_t last = row_splits[segment + 1];
+            scalar_t* dst_row = dst + segment * row_size;
+            if (begin == last) {
+                std::fill(dst_row, dst_row + row_size, scalar_t(0));
+                continue;
+            }
+            std::copy(src + begin * row_size, src + (begin + 1) * row_size,
+                      dst_row);
+            for (int64_t row = begin + 1; row < last; ++row) {
+                const scalar_t* src_row = src + row * row_size;
+                for (int64_t j = 0; j < row_size; ++j) {
+                    dst_row[j] = reduce(dst_row[j], src_row[j]);
+                }
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void SegmentReductionCPU(const Tensor& src,
+                         Tensor& dst,
+                         const Tensor& row_splits,
+                         ReductionOpCode op_code) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor splits = row_splits.Contiguous();
+    const int64_t num_rows = src.GetShape()[0];
+    const int64_t num_segments = splits.GetShape()[0] - 1;
+    const int64_t* splits_ptr =
+            static_cast<const int64_t*>(splits.GetDataPtr());
+    if (splits_ptr[0] != 0 || splits_ptr[num_segments] != num_rows ||
+        !std::is_sorted(splits_ptr, splits_ptr + num_segments + 1)) {
+        utility::LogError(
+                "row_splits must be non-decreasing from 0 to the number of "
+                "rows {}.",
+                num_rows);
+    }
+    if (num_segments == 0) {
+        return;
+    }
+
+    Tensor dst_contiguous =
+            dst.IsContiguous() ? dst : Tensor(dst.GetShape(), dst.GetDtype(),
+                                              dst.GetDevice());
+    const int64_t row_size = dst.NumElements() / num_segments;
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src_contiguous.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_contiguous.GetDataPtr());
+        if (op_code == ReductionOpCode::Sum) {
+            ReduceSegments(src_ptr, dst_ptr, splits_ptr, num_segments,
+                           num_rows, row_size,
+                           [](scalar_t a, scalar_t b) { return a + b; });
+        } else if (op_code == ReductionOpCode::Max) {
+            ReduceSegments(src_ptr, dst_ptr, splits_ptr, num_segments,
+                           num_rows, row_size,
+                           [](scalar_t a, scalar_t b) {
+                               return a < b ? b : a;
+                           });
+        } else {
+            utility::LogError("SegmentReductionCPU: Unsupported reduction op.");
+        }
+    });
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void AssertSortable(const Tensor& src) {
+    if (src.NumDims() != 1) {
+        utility::LogError("Expected a 1-D tensor, but got shape {}.",
+                          src.GetShape().ToString());
+    }
+    const Dtype dtype = src.GetDtype();
+    if (dtype != Dtype::Int32 && dtype != Dtype::Int64 &&
+        dtype != Dtype::UInt8 && dtype != Dtype::UInt16 &&
+        dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError("Unsupported dtype {} for sorting.",
+                          dtype.ToString());
+    }
+}
+
+// The CUDA tensors are sorted on the host.
+
+Tensor Sort(const Tensor& src) {
+    AssertSortable(src);
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return SortCPU(src);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        return SortCPU(src.To(Device("CPU:0"))).To(src.GetDevice());
+    } else {
+        utility::LogError("Sort: Unimplemented device");
+    }
+}
+
+Tensor ArgSort(const Tensor& src) {
+    AssertSortable(src);
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return ArgSortCPU(src);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        return ArgSortCPU(src.To(Device("CPU:0"))).To(src.GetDevice());
+    } else {
+        utility::LogError("ArgSort: Unimplemented device");
+    }
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src) {
+    AssertSortable(src);
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return UniqueCPU(src);
+    } else if (device_type == Device::DeviceType::CUDA) {
+        Tensor values, inverse, counts;
+        std::tie(values, inverse, counts) =
+                UniqueCPU(src.To(Device("CPU:0")));
+        return std::make_tuple(values.To(src.GetDevice()),
+                               inverse.To(src.GetDevice()),
+                               counts.To(src.GetDevice()));
+    } else {
+        utility::LogError("Unique: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the values of the 1-D tensor src in ascending order. The sort is
+/// stable. Supports Int32, Int64, UInt8, UInt16, Float32 and Float64.
+Tensor Sort(const Tensor& src);
+
+/// Returns the Int64 indices that sort the 1-D tensor src in ascending
+/// order, equal values keep their original order.
+Tensor ArgSort(const Tensor& src);
+
+/// Returns the sorted unique values of the 1-D tensor src, the Int64 indices
+/// of each element of src into them and the Int64 counts of each unique
+/// value.
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src);
+
+Tensor SortCPU(const Tensor& src);
+
+Tensor ArgSortCPU(const Tensor& src);
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,310 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Console.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+/// Number of key bits sorted per pass of the radix sort.
+constexpr int kRadixBits = 8;
+constexpr int64_t kNumBuckets = 1 << kRadixBits;
+
+/// Number of keys per task of the radix sort.
+constexpr int64_t kChunkSize = 1 << 16;
+
+/// Number of elements per task of the element-wise loops.
+constexpr int64_t kGrainSize = 1 << 15;
+
+/// Maps values to unsigned keys with the same order.
+template <typename scalar_t>
+struct RadixKey {
+    typedef scalar_t type;
+    static type Encode(scalar_t value) { return value; }
+    static scalar_t Decode(type key) { return key; }
+};
+
+template <typename scalar_t, typename unsigned_t>
+struct SignedRadixKey {
+    typedef unsigned_t type;
+    static constexpr unsigned_t kSignBit = unsigned_t(1)
+                                           << (8 * sizeof(unsigned_t) - 1);
+    static type Encode(scalar_t value) {
+        return static_cast<unsigned_t>(value) ^ kSignBit;
+    }
+    static scalar_t Decode(type key) {
+        return static_cast<scalar_t>(key ^ kSignBit);
+    }
+};
+
+/// Negative floats have all bits flipped, positive ones the sign bit.
+template <typename scalar_t, typename unsigned_t>
+struct FloatRadixKey {
+    typedef unsigned_t type;
+    static constexpr unsigned_t kSignBit = unsigned_t(1)
+                                           << (8 * sizeof(unsigned_t) - 1);
+    static type Encode(scalar_t value) {
+        unsigned_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits & kSignBit ? ~bits : bits | kSignBit;
+    }
+    static scalar_t Decode(type key) {
+        unsigned_t bits = key & kSignBit ? key & ~kSignBit : ~key;
+        scalar_t value;
+        std::memcpy(&value, &bits, sizeof(bits));
+        return value;
+    }
+};
+
+template <>
+struct RadixKey<int32_t> : SignedRadixKey<int32_t, uint32_t> {};
+template <>
+struct RadixKey<int64_t> : SignedRadixKey<int64_t, uint64_t> {};
+template <>
+struct RadixKey<float> : FloatRadixKey<float, uint32_t> {};
+template <>
+struct RadixKey<double> : FloatRadixKey<double, uint64_t> {};
+
+/// Stable LSD radix sort of n keys, values are permuted along if not
+/// nullptr. Each pass counts the digits of each chunk in parallel, scans the
+/// counts in (digit, chunk) order and scatters each chunk to its offsets.
+/// Passes where all keys share the digit are skipped. The buffers hold n
+/// elements, the result is in keys and values.
+template <typename key_t>
+void RadixSort(key_t* keys,
+               int64_t* values,
+               key_t* key_buffer,
+               int64_t* value_buffer,
+               int64_t n) {
+    const int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+    std::vector<int64_t> offsets(num_chunks * kNumBuckets);
+    key_t* src_keys = keys;
+    key_t* dst_keys = key_buffer;
+    int64_t* src_values = values;
+    int64_t* dst_values = value_buffer;
+    for (int shift = 0; shift < int(8 * sizeof(key_t)); shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        ParallelFor(num_chunks, 1, [&](int64_t start, int64_t end) {
+            for (int64_t chunk = start; chunk < end; ++chunk) {
+                int64_t* counts = offsets.data() + chunk * kNumBuckets;
+                const int64_t last = std::min(n, (chunk + 1) * kChunkSize);
+                for (int64_t i = chunk * kChunkSize; i < last; ++i) {
+                    ++counts[(src_keys[i] >> shift) & (kNumBuckets - 1)];
+                }
+            }
+        });
+
+        const int64_t first_digit = (src_keys[0] >> shift) & (kNumBuckets - 1);
+        int64_t first_digit_count = 0;
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            first_digit_count += offsets[chunk * kNumBuckets + first_digit];
+        }
+        if (first_digit_count == n) {
+            continue;
+        }
+
+        int64_t offset = 0;
+        for (int64_t digit = 0; digit < kNumBuckets; ++digit) {
+            for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+                const int64_t count = offsets[chunk * kNumBuckets + digit];
+                offsets[chunk * kNumBuckets + digit] = offset;
+                offset += count;
+            }
+        }
+
+        ParallelFor(num_chunks, 1, [&](int64_t start, int64_t end) {
+            for (int64_t chunk = start; chunk < end; ++chunk) {
+                int64_t* chunk_offsets = offsets.data() + chunk * kNumBuckets;
+                const int64_t last = std::min(n, (chunk + 1) * kChunkSize);
+                for (int64_t i = chunk * kChunkSize; i < last; ++i) {
+                    const int64_t pos = chunk_offsets[(src_keys[i] >> shift) &
+                                                      (kNumBuckets - 1)]++;
+                    dst_keys[pos] = src_keys[i];
+                    if (values) {
+                        dst_values[pos] = src_values[i];
+                    }
+                }
+            }
+        });
+        std::swap(src_keys, dst_keys);
+        std::swap(src_values, dst_values);
+    }
+    if (src_keys != keys) {
+        std::copy(src_keys, src_keys + n, keys);
+        if (values) {
+            std::copy(src_values, src_values + n, values);
+        }
+    }
+}
+
+/// Sorts the n values of src into sorted and the sorting permutation into
+/// indices, each may be nullptr if not needed.
+template <typename scalar_t>
+void SortValues(const scalar_t* src,
+                int64_t n,
+                scalar_t* sorted,
+                int64_t* indices) {
+    if (n == 0) {
+        return;
+    }
+    typedef RadixKey<scalar_t> Key;
+    typedef typename Key::type key_t;
+    std::vector<key_t> keys(n);
+    std::vector<key_t> key_buffer(n);
+    std::vector<int64_t> value_buffer(indices ? n : 0);
+    ParallelFor(n, kGrainSize, [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            keys[i] = Key::Encode(src[i]);
+            if (indices) {
+                indices[i] = i;
+            }
+        }
+    });
+    RadixSort(keys.data(), indices, key_buffer.data(), value_buffer.data(), n);
+    if (sorted) {
+        ParallelFor(n, kGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                sorted[i] = Key::Decode(keys[i]);
+            }
+        });
+    }
+}
+
+}  // namespace
+
+/// Dispatches the dtypes supported by RadixKey.
+#define DISPATCH_SORT_DTYPE_TO_TEMPLATE(DTYPE, ...)            \
+    [&] {                                                      \
+        if (DTYPE == Dtype::Float32) {                         \
+            using scalar_t = float;                            \
+            return __VA_ARGS__();                              \
+        } else if (DTYPE == Dtype::Float64) {                  \
+            using scalar_t = double;                           \
+            return __VA_ARGS__();                              \
+        } else if (DTYPE == Dtype::Int32) {                    \
+            using scalar_t = int32_t;                          \
+            return __VA_ARGS__();                              \
+        } else if (DTYPE == Dtype::Int64) {                    \
+            using scalar_t = int64_t;                          \
+            return __VA_ARGS__();                              \
+        } else if (DTYPE == Dtype::UInt8) {                    \
+            using scalar_t = uint8_t;                          \
+            return __VA_ARGS__();                              \
+        } else if (DTYPE == Dtype::UInt16) {                   \
+            using scalar_t = uint16_t;                         \
+            return __VA_ARGS__();                              \
+        } else {                                               \
+            utility::LogError("Unsupported data type.");       \
+        }                                                      \
+    }()
+
+Tensor SortCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor dst(src.GetShape(), src.GetDtype(), src.GetDevice());
+    DISPATCH_SORT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        SortValues(static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                   src.NumElements(), static_cast<scalar_t*>(dst.GetDataPtr()),
+                   nullptr);
+    });
+    return dst;
+}
+
+Tensor ArgSortCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    Tensor indices(src.GetShape(), Dtype::Int64, src.GetDevice());
+    DISPATCH_SORT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        SortValues(static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                   src.NumElements(), static_cast<scalar_t*>(nullptr),
+                   static_cast<int64_t*>(indices.GetDataPtr()));
+    });
+    return indices;
+}
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t n = src.NumElements();
+    const Device device = src.GetDevice();
+    Tensor values, counts;
+    Tensor inverse({n}, Dtype::Int64, device);
+    DISPATCH_SORT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        std::vector<scalar_t> sorted(n);
+        std::vector<int64_t> order(n);
+        SortValues(static_cast<const scalar_t*>(src_contiguous.GetDataPtr()),
+                   n, sorted.data(), order.data());
+
+        // Index of the unique value of each sorted element, the prefix sum of
+        // the starts of the runs of equal values.
+        std::vector<int64_t> unique_index(n);
+        ParallelFor(n, kGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                unique_index[i] = i > 0 && sorted[i] != sorted[i - 1];
+            }
+        });
+        utility::InclusivePrefixSum(unique_index.data(),
+                                    unique_index.data() + n,
+                                    unique_index.data());
+        const int64_t num_unique = n > 0 ? unique_index[n - 1] + 1 : 0;
+
+        values = Tensor({num_unique}, src.GetDtype(), device);
+        counts = Tensor({num_unique}, Dtype::Int64, device);
+        scalar_t* values_ptr = static_cast<scalar_t*>(values.GetDataPtr());
+        int64_t* counts_ptr = static_cast<int64_t*>(counts.GetDataPtr());
+        int64_t* inverse_ptr = static_cast<int64_t*>(inverse.GetDataPtr());
+        std::vector<int64_t> starts(num_unique + 1, n);
+        ParallelFor(n, kGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                const int64_t u = unique_index[i];
+                if (i == 0 || u != unique_index[i - 1]) {
+                    values_ptr[u] = sorted[i];
+                    starts[u] = i;
+                }
+                inverse_ptr[order[i]] = u;
+            }
+        });
+        ParallelFor(num_unique, kGrainSize, [&](int64_t start, int64_t end) {
+            for (int64_t u = start; u < end; ++u) {
+                counts_ptr[u] = starts[u + 1] - starts[u];
+            }
+        });
+    });
+    return std::make_tuple(values, inverse, counts);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/UnaryEW.h"
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Console.h"
@@ -34,6 +35,34 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+static const char* UnaryEWOpName(UnaryEWOpCode op_code) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            return "Sqrt";
+        case UnaryEWOpCode::Sin:
+            return "Sin";
+        case UnaryEWOpCode::Cos:
+            return "Cos";
+        case UnaryEWOpCode::Neg:
+            return "Neg";
+        case UnaryEWOpCode::Exp:
+            return "Exp";
+        case UnaryEWOpCode::Abs:
+            return "Abs";
+        case UnaryEWOpCode::Floor:
+            return "Floor";
+        case UnaryEWOpCode::Ceil:
+            return "Ceil";
+        case UnaryEWOpCode::Round:
+            return "Round";
+        case UnaryEWOpCode::Trunc:
+            return "Trunc";
+        case UnaryEWOpCode::LogicalNot:
+            return "LogicalNot";
+    }
+    return "Unknown";
+}
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
@@ -49,6 +78,7 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    ProfilerScope scope("UnaryEW", UnaryEWOpName(op_code), {&dst, &src});
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
@@ -78,6 +108,7 @@ void Copy(const Tensor& src, Tensor& dst) {
          dst_device_type != Device::DeviceType::CUDA)) {
         utility::LogError("Copy: Unimplemented device");
     }
+    ProfilerScope scope("UnaryEW", "Copy", {&dst, &src});
     if (src_device_type == Device::DeviceType::CPU &&
         dst_device_type == Device::DeviceType::CPU) {
         CopyCPU(src, dst);
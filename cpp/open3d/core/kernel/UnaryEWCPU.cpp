@@ -189,8 +189,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUSqrtElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(std::sqrt(src));
+                            });
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
@@ -203,8 +206,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                             indexer, CPUCosElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Neg:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUNegElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(-src);
+                            });
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
@@ -212,24 +218,40 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                             indexer, CPUExpElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Abs:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUAbsElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(
+                                        std::abs(static_cast<double>(src)));
+                            });
                     break;
                 case UnaryEWOpCode::Floor:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUFloorElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUFloorElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(
+                                        std::floor(static_cast<double>(src)));
+                            });
                     break;
                 case UnaryEWOpCode::Ceil:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUCeilElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUCeilElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(
+                                        std::ceil(static_cast<double>(src)));
+                            });
                     break;
                 case UnaryEWOpCode::Round:
                     CPULauncher::LaunchUnaryEWKernel(
                             indexer, CPURoundElementKernel<scalar_t>);
                     break;
                 case UnaryEWOpCode::Trunc:
-                    CPULauncher::LaunchUnaryEWKernel(
-                            indexer, CPUTruncElementKernel<scalar_t>);
+                    CPULauncher::LaunchUnaryEWKernel<scalar_t>(
+                            indexer, CPUTruncElementKernel<scalar_t>,
+                            [](scalar_t src) {
+                                return static_cast<scalar_t>(
+                                        std::trunc(static_cast<double>(src)));
+                            });
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
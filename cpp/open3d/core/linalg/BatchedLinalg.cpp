@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include <string>
+
+namespace open3d {
+namespace core {
+
+static void AssertBatchedFloat(const Tensor& t,
+                               const std::string& name,
+                               const std::string& op) {
+    Dtype dtype = t.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "[{}] Only tensors with Float32 or Float64 are supported, but "
+                "{} has {}.",
+                op, name, dtype.ToString());
+    }
+    if (t.NumDims() != 3) {
+        utility::LogError("[{}] Tensor {} must be 3D, but got {}D.", op, name,
+                          t.NumDims());
+    }
+    if (t.GetShape()[1] == 0 || t.GetShape()[2] == 0) {
+        utility::LogError(
+                "[{}] Tensor shapes should not contain matrix dimensions with "
+                "zero.",
+                op);
+    }
+}
+
+static void AssertSquare(const Tensor& A, const std::string& op) {
+    if (A.GetShape()[1] != A.GetShape()[2]) {
+        utility::LogError("[{}] Tensor A must be square, but got {} x {}.", op,
+                          A.GetShape()[1], A.GetShape()[2]);
+    }
+}
+
+static void AssertCompatible(const Tensor& A,
+                             const Tensor& B,
+                             const std::string& op) {
+    if (A.GetDevice() != B.GetDevice()) {
+        utility::LogError("[{}] Tensor A device {} and Tensor B device {} "
+                          "mismatch.",
+                          op, A.GetDevice().ToString(),
+                          B.GetDevice().ToString());
+    }
+    if (A.GetDtype() != B.GetDtype()) {
+        utility::LogError(
+                "[{}] Tensor A dtype {} and Tensor B dtype {} mismatch.", op,
+                A.GetDtype().ToString(), B.GetDtype().ToString());
+    }
+    if (B.NumDims() != 2 && B.NumDims() != 3) {
+        utility::LogError("[{}] Tensor B must be 2D or 3D, but got {}D.", op,
+                          B.NumDims());
+    }
+    if (B.GetShape()[0] != A.GetShape()[0]) {
+        utility::LogError("[{}] Batch sizes {} and {} mismatch.", op,
+                          A.GetShape()[0], B.GetShape()[0]);
+    }
+}
+
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    const std::string op = "BatchedMatmul";
+    AssertBatchedFloat(A, "A", op);
+    AssertCompatible(A, B, op);
+
+    int64_t batch = A.GetShape()[0];
+    int64_t m = A.GetShape()[1];
+    int64_t k = A.GetShape()[2];
+    int64_t n = B.NumDims() == 3 ? B.GetShape()[2] : 1;
+    if (B.GetShape()[1] != k) {
+        utility::LogError(
+                "[{}] Tensor A columns {} mismatch with Tensor B rows {}.", op,
+                k, B.GetShape()[1]);
+    }
+    if (n == 0) {
+        utility::LogError(
+                "[{}] Tensor shapes should not contain matrix dimensions with "
+                "zero.",
+                op);
+    }
+
+    Device host("CPU:0");
+    Tensor A_host = A.To(host).Contiguous();
+    Tensor B_host = B.To(host).Contiguous();
+    SizeVector output_shape =
+            B.NumDims() == 3 ? SizeVector{batch, m, n} : SizeVector{batch, m};
+    output = Tensor::Empty(output_shape, A.GetDtype(), host);
+    BatchedMatmulCPU(A_host.GetDataPtr(), B_host.GetDataPtr(),
+                     output.GetDataPtr(), batch, m, k, n, A.GetDtype());
+    output = output.To(A.GetDevice());
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    const std::string op = "BatchedInverse";
+    AssertBatchedFloat(A, "A", op);
+    AssertSquare(A, op);
+
+    int64_t batch = A.GetShape()[0];
+    int64_t n = A.GetShape()[1];
+    Device host("CPU:0");
+    Tensor A_host = A.To(host).Contiguous();
+    output = Tensor::Empty(A.GetShape(), A.GetDtype(), host);
+    BatchedInverseCPU(A_host.GetDataPtr(), output.GetDataPtr(), batch, n,
+                      A.GetDtype());
+    output = output.To(A.GetDevice());
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    const std::string op = "BatchedSolve";
+    AssertBatchedFloat(A, "A", op);
+    AssertSquare(A, op);
+    AssertCompatible(A, B, op);
+
+    int64_t batch = A.GetShape()[0];
+    int64_t n = A.GetShape()[1];
+    int64_t k = B.NumDims() == 3 ? B.GetShape()[2] : 1;
+    if (B.GetShape()[1] != n) {
+        utility::LogError("[{}] Tensor A rows {} mismatch with Tensor B rows "
+                          "{}.",
+                          op, n, B.GetShape()[1]);
+    }
+    if (k == 0) {
+        utility::LogError(
+                "[{}] Tensor shapes should not contain matrix dimensions with "
+                "zero.",
+                op);
+    }
+
+    Device host("CPU:0");
+    Tensor A_host = A.To(host).Contiguous();
+    Tensor B_host = B.To(host).Contiguous();
+    X = Tensor::Empty(B.GetShape(), A.GetDtype(), host);
+    BatchedSolveCPU(A_host.GetDataPtr(), B_host.GetDataPtr(), X.GetDataPtr(),
+                    batch, n, k, A.GetDtype());
+    X = X.To(A.GetDevice());
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const std::string op = "BatchedSVD";
+    AssertBatchedFloat(A, "A", op);
+
+    int64_t batch = A.GetShape()[0];
+    int64_t m = A.GetShape()[1];
+    int64_t n = A.GetShape()[2];
+    if (m < n) {
+        utility::LogError("[{}] Only support m >= n, but got {} and {} matrix",
+                          op, m, n);
+    }
+
+    Device host("CPU:0");
+    Dtype dtype = A.GetDtype();
+    Tensor A_host = A.To(host).Contiguous();
+    U = Tensor::Empty({batch, m, m}, dtype, host);
+    S = Tensor::Empty({batch, n}, dtype, host);
+    VT = Tensor::Empty({batch, n, n}, dtype, host);
+    BatchedSVDCPU(A_host.GetDataPtr(), U.GetDataPtr(), S.GetDataPtr(),
+                  VT.GetDataPtr(), batch, m, n, dtype);
+    U = U.To(A.GetDevice());
+    S = S.To(A.GetDevice());
+    VT = VT.To(A.GetDevice());
+}
+
+void BatchedSymmetricEigen(const Tensor& A,
+                           Tensor& eigenvalues,
+                           Tensor& eigenvectors) {
+    const std::string op = "BatchedSymmetricEigen";
+    AssertBatchedFloat(A, "A", op);
+    AssertSquare(A, op);
+
+    int64_t batch = A.GetShape()[0];
+    int64_t n = A.GetShape()[1];
+    Device host("CPU:0");
+    Dtype dtype = A.GetDtype();
+    Tensor A_host = A.To(host).Contiguous();
+    eigenvalues = Tensor::Empty({batch, n}, dtype, host);
+    eigenvectors = Tensor::Empty({batch, n, n}, dtype, host);
+    BatchedSymmetricEigenCPU(A_host.GetDataPtr(), eigenvalues.GetDataPtr(),
+                             eigenvectors.GetDataPtr(), batch, n, dtype);
+    eigenvalues = eigenvalues.To(A.GetDevice());
+    eigenvectors = eigenvectors.To(A.GetDevice());
+}
+
+}  // namespace core
+}  // namespace open3d
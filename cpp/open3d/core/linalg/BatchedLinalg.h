@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Batched linear algebra on small matrices, e.g. the 3x3 and 6x6 systems of
+/// normal estimation and ICP. Each function operates on {batch, m, n}
+/// tensors of Float32 or Float64 and runs in parallel over the batch, with
+/// unrolled kernels for 3x3, 4x4 and 6x6 matrices. CUDA tensors are
+/// processed on the host.
+
+/// Computes C[i] = A[i] B[i]. A has shape {batch, m, k}, B has shape
+/// {batch, k, n} or {batch, k}, the output {batch, m, n} or {batch, m}.
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& output);
+
+/// Computes A[i]^{-1} with Gauss-Jordan elimination and partial pivoting.
+/// A has shape {batch, n, n}.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Solves A[i] X[i] = B[i] with Gaussian elimination and partial pivoting.
+/// A has shape {batch, n, n}, B has shape {batch, n, k} or {batch, n}.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Computes A[i] = U[i] diag(S[i]) VT[i] with one-sided Jacobi rotations. A
+/// has shape {batch, m, n} with m >= n, U {batch, m, m}, S {batch, n} in
+/// descending order and VT {batch, n, n}.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+/// Computes the eigen decomposition of symmetric matrices, A[i] = V[i]
+/// diag(eigenvalues[i]) V[i]^T. A has shape {batch, n, n}, only its lower
+/// triangle is read. Eigenvalues {batch, n} are in ascending order, the
+/// eigenvectors {batch, n, n} are the columns of V. 3x3 matrices are solved
+/// in closed form, others with cyclic Jacobi rotations.
+void BatchedSymmetricEigen(const Tensor& A,
+                           Tensor& eigenvalues,
+                           Tensor& eigenvectors);
+
+void BatchedMatmulCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype);
+
+void BatchedInverseCPU(const void* A_data,
+                       void* output_data,
+                       int64_t batch,
+                       int64_t n,
+                       Dtype dtype);
+
+void BatchedSolveCPU(const void* A_data,
+                     const void* B_data,
+                     void* X_data,
+                     int64_t batch,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype);
+
+void BatchedSVDCPU(const void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   int64_t batch,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype);
+
+void BatchedSymmetricEigenCPU(const void* A_data,
+                              void* eigenvalues_data,
+                              void* eigenvectors_data,
+                              int64_t batch,
+                              int64_t n,
+                              Dtype dtype);
+
+}  // namespace core
+}  // namespace open3d
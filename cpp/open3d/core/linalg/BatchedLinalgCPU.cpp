@@ -0,0 +1,838 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/CPUExecutor.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/BlasWrapper.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+// The kernels take the matrix sizes as template arguments, 0 for sizes only
+// known at runtime, so that the loops over the common 3x3, 4x4 and 6x6 sizes
+// are unrolled by the compiler.
+
+/// Approximate number of flops per task of the batch loops.
+constexpr int64_t kGrainFlops = 1 << 14;
+
+/// Matmuls with at least this many multiply-adds per matrix use BLAS.
+constexpr int64_t kBlasFlops = 32 * 32 * 32;
+
+/// Maximum number of Jacobi sweeps, they converge quadratically.
+constexpr int kMaxSweeps = 32;
+
+inline int64_t GrainSize(int64_t flops_per_matrix) {
+    return std::max<int64_t>(1, kGrainFlops / std::max<int64_t>(
+                                                      1, flops_per_matrix));
+}
+
+template <typename scalar_t, int kM, int kK, int kN>
+void MatmulKernel(const scalar_t* A,
+                  const scalar_t* B,
+                  scalar_t* C,
+                  int64_t batch,
+                  int64_t m_,
+                  int64_t k_,
+                  int64_t n_) {
+    const int64_t m = kM > 0 ? kM : m_;
+    const int64_t k = kK > 0 ? kK : k_;
+    const int64_t n = kN > 0 ? kN : n_;
+    ParallelFor(batch, GrainSize(m * k * n), [&](int64_t start, int64_t end) {
+        for (int64_t b = start; b < end; ++b) {
+            const scalar_t* a = A + b * m * k;
+            const scalar_t* x = B + b * k * n;
+            scalar_t* c = C + b * m * n;
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < n; ++j) {
+                    scalar_t sum = 0;
+                    for (int64_t l = 0; l < k; ++l) {
+                        sum += a[i * k + l] * x[l * n + j];
+                    }
+                    c[i * n + j] = sum;
+                }
+            }
+        }
+    });
+}
+
+/// Inverts a with Gauss-Jordan elimination on [a | I], stored in work with
+/// n x 2n values. Returns false if a is singular.
+template <typename scalar_t, int kN>
+bool InverseMatrix(const scalar_t* a,
+                   scalar_t* inverse,
+                   int64_t n_,
+                   scalar_t* work) {
+    const int64_t n = kN > 0 ? kN : n_;
+    const int64_t w = 2 * n;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            work[i * w + j] = a[i * n + j];
+            work[i * w + n + j] = i == j ? 1 : 0;
+        }
+    }
+    for (int64_t col = 0; col < n; ++col) {
+        int64_t pivot = col;
+        for (int64_t r = col + 1; r < n; ++r) {
+            if (std::abs(work[r * w + col]) > std::abs(work[pivot * w + col])) {
+                pivot = r;
+            }
+        }
+        if (work[pivot * w + col] == 0) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int64_t j = 0; j < w; ++j) {
+                std::swap(work[pivot * w + j], work[col * w + j]);
+            }
+        }
+        const scalar_t inv_pivot = 1 / work[col * w + col];
+        for (int64_t j = 0; j < w; ++j) {
+            work[col * w + j] *= inv_pivot;
+        }
+        for (int64_t r = 0; r < n; ++r) {
+            const scalar_t f = work[r * w + col];
+            if (r == col || f == 0) {
+                continue;
+            }
+            for (int64_t j = 0; j < w; ++j) {
+                work[r * w + j] -= f * work[col * w + j];
+            }
+        }
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            inverse[i * n + j] = work[i * w + n + j];
+        }
+    }
+    return true;
+}
+
+template <typename scalar_t, int kN>
+void InverseKernel(const scalar_t* A,
+                   scalar_t* output,
+                   int64_t batch,
+                   int64_t n_) {
+    const int64_t n = kN > 0 ? kN : n_;
+    std::atomic<int64_t> singular(-1);
+    ParallelFor(batch, GrainSize(2 * n * n * n),
+                [&](int64_t start, int64_t end) {
+                    std::vector<scalar_t> work(2 * n * n);
+                    for (int64_t b = start; b < end; ++b) {
+                        if (!InverseMatrix<scalar_t, kN>(A + b * n * n,
+                                                         output + b * n * n, n,
+                                                         work.data())) {
+                            singular = b;
+                        }
+                    }
+                });
+    if (singular >= 0) {
+        utility::LogError(
+                "[BatchedInverse] Singular condition detected in matrix {}.",
+                singular.load());
+    }
+}
+
+/// Solves a x = b with Gaussian elimination on [a | b], stored in work with
+/// n x (n + k) values. Returns false if a is singular.
+template <typename scalar_t, int kN, int kK>
+bool SolveMatrix(const scalar_t* a,
+                 const scalar_t* b,
+                 scalar_t* x,
+                 int64_t n_,
+                 int64_t k_,
+                 scalar_t* work) {
+    const int64_t n = kN > 0 ? kN : n_;
+    const int64_t k = kK > 0 ? kK : k_;
+    const int64_t w = n + k;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            work[i * w + j] = a[i * n + j];
+        }
+        for (int64_t j = 0; j < k; ++j) {
+            work[i * w + n + j] = b[i * k + j];
+        }
+    }
+    for (int64_t col = 0; col < n; ++col) {
+        int64_t pivot = col;
+        for (int64_t r = col + 1; r < n; ++r) {
+            if (std::abs(work[r * w + col]) > std::abs(work[pivot * w + col])) {
+                pivot = r;
+            }
+        }
+        if (work[pivot * w + col] == 0) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int64_t j = col; j < w; ++j) {
+                std::swap(work[pivot * w + j], work[col * w + j]);
+            }
+        }
+        for (int64_t r = col + 1; r < n; ++r) {
+            const scalar_t f = work[r * w + col] / work[col * w + col];
+            for (int64_t j = col; j < w; ++j) {
+                work[r * w + j] -= f * work[col * w + j];
+            }
+        }
+    }
+    for (int64_t row = n - 1; row >= 0; --row) {
+        for (int64_t j = 0; j < k; ++j) {
+            scalar_t sum = work[row * w + n + j];
+            for (int64_t c = row + 1; c < n; ++c) {
+                sum -= work[row * w + c] * x[c * k + j];
+            }
+            x[row * k + j] = sum / work[row * w + row];
+        }
+    }
+    return true;
+}
+
+template <typename scalar_t, int kN, int kK>
+void SolveKernel(const scalar_t* A,
+                 const scalar_t* B,
+                 scalar_t* X,
+                 int64_t batch,
+                 int64_t n_,
+                 int64_t k_) {
+    const int64_t n = kN > 0 ? kN : n_;
+    const int64_t k = kK > 0 ? kK : k_;
+    std::atomic<int64_t> singular(-1);
+    ParallelFor(batch, GrainSize(n * n * (n + k)),
+                [&](int64_t start, int64_t end) {
+                    std::vector<scalar_t> work(n * (n + k));
+                    for (int64_t b = start; b < end; ++b) {
+                        if (!SolveMatrix<scalar_t, kN, kK>(
+                                    A + b * n * n, B + b * n * k, X + b * n * k,
+                                    n, k, work.data())) {
+                            singular = b;
+                        }
+                    }
+                });
+    if (singular >= 0) {
+        utility::LogError(
+                "[BatchedSolve] Singular condition detected in matrix {}.",
+                singular.load());
+    }
+}
+
+/// Sets column j of the m x m matrix u to a unit vector orthogonal to its
+/// first j columns, using the unit axis that is least covered by them.
+template <typename scalar_t>
+void CompleteBasis(scalar_t* u, int64_t m, int64_t j, scalar_t* residual) {
+    scalar_t best_norm = -1;
+    for (int64_t e = 0; e < m; ++e) {
+        // |e - sum_c u_c u_c[e]|^2 = 1 - sum_c u_c[e]^2.
+        scalar_t norm = 1;
+        for (int64_t c = 0; c < j; ++c) {
+            norm -= u[e * m + c] * u[e * m + c];
+        }
+        if (norm > best_norm) {
+            best_norm = norm;
+            for (int64_t i = 0; i < m; ++i) {
+                residual[i] = i == e ? 1 : 0;
+            }
+        }
+    }
+    // Two rounds of Gram-Schmidt keep the result orthogonal.
+    for (int round = 0; round < 2; ++round) {
+        for (int64_t c = 0; c < j; ++c) {
+            scalar_t dot = 0;
+            for (int64_t i = 0; i < m; ++i) {
+                dot += u[i * m + c] * residual[i];
+            }
+            for (int64_t i = 0; i < m; ++i) {
+                residual[i] -= dot * u[i * m + c];
+            }
+        }
+    }
+    scalar_t norm = 0;
+    for (int64_t i = 0; i < m; ++i) {
+        norm += residual[i] * residual[i];
+    }
+    norm = std::sqrt(norm);
+    for (int64_t i = 0; i < m; ++i) {
+        u[i * m + j] = residual[i] / norm;
+    }
+}
+
+/// SVD with one-sided Jacobi rotations, which orthogonalize the columns of
+/// a copy of a. work holds m * n + n * n + m + n values, order n values.
+template <typename scalar_t, int kM, int kN>
+void SVDMatrix(const scalar_t* a,
+               scalar_t* u,
+               scalar_t* s,
+               scalar_t* vt,
+               int64_t m_,
+               int64_t n_,
+               scalar_t* work,
+               int64_t* order) {
+    const int64_t m = kM > 0 ? kM : m_;
+    const int64_t n = kN > 0 ? kN : n_;
+    const scalar_t eps = std::numeric_limits<scalar_t>::epsilon();
+    scalar_t* w = work;
+    scalar_t* v = w + m * n;
+    scalar_t* residual = v + n * n;
+    scalar_t* sigma = residual + m;
+
+    std::copy(a, a + m * n, w);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            v[i * n + j] = i == j ? 1 : 0;
+        }
+    }
+
+    for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+        bool rotated = false;
+        for (int64_t p = 0; p < n - 1; ++p) {
+            for (int64_t q = p + 1; q < n; ++q) {
+                scalar_t alpha = 0, beta = 0, gamma = 0;
+                for (int64_t i = 0; i < m; ++i) {
+                    const scalar_t wp = w[i * n + p];
+                    const scalar_t wq = w[i * n + q];
+                    alpha += wp * wp;
+                    beta += wq * wq;
+                    gamma += wp * wq;
+                }
+                if (std::abs(gamma) <= eps * std::sqrt(alpha * beta)) {
+                    continue;
+                }
+                rotated = true;
+                const scalar_t zeta = (beta - alpha) / (2 * gamma);
+                const scalar_t t =
+                        (zeta >= 0 ? 1 : -1) /
+                        (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+                const scalar_t c = 1 / std::sqrt(1 + t * t);
+                const scalar_t sn = c * t;
+                for (int64_t i = 0; i < m; ++i) {
+                    const scalar_t wp = w[i * n + p];
+                    const scalar_t wq = w[i * n + q];
+                    w[i * n + p] = c * wp - sn * wq;
+                    w[i * n + q] = sn * wp + c * wq;
+                }
+                for (int64_t i = 0; i < n; ++i) {
+                    const scalar_t vp = v[i * n + p];
+                    const scalar_t vq = v[i * n + q];
+                    v[i * n + p] = c * vp - sn * vq;
+                    v[i * n + q] = sn * vp + c * vq;
+                }
+            }
+        }
+        if (!rotated) {
+            break;
+        }
+    }
+
+    // The column norms are the singular values.
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t norm = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            norm += w[i * n + j] * w[i * n + j];
+        }
+        sigma[j] = std::sqrt(norm);
+        order[j] = j;
+    }
+    std::sort(order, order + n,
+              [&](int64_t i, int64_t j) { return sigma[i] > sigma[j]; });
+
+    // Columns of (numerically) zero singular values and the columns beyond n
+    // are completed to an orthonormal basis.
+    const scalar_t tolerance = sigma[order[0]] * m * eps;
+    for (int64_t j = 0; j < m; ++j) {
+        if (j < n && sigma[order[j]] > tolerance) {
+            const scalar_t inv_sigma = 1 / sigma[order[j]];
+            for (int64_t i = 0; i < m; ++i) {
+                u[i * m + j] = w[i * n + order[j]] * inv_sigma;
+            }
+        } else {
+            CompleteBasis(u, m, j, residual);
+        }
+    }
+    for (int64_t j = 0; j < n; ++j) {
+        s[j] = sigma[order[j]];
+        for (int64_t i = 0; i < n; ++i) {
+            vt[j * n + i] = v[i * n + order[j]];
+        }
+    }
+}
+
+template <typename scalar_t, int kM, int kN>
+void SVDKernel(const scalar_t* A,
+               scalar_t* U,
+               scalar_t* S,
+               scalar_t* VT,
+               int64_t batch,
+               int64_t m_,
+               int64_t n_) {
+    const int64_t m = kM > 0 ? kM : m_;
+    const int64_t n = kN > 0 ? kN : n_;
+    ParallelFor(batch, GrainSize(8 * m * n * n),
+                [&](int64_t start, int64_t end) {
+                    std::vector<scalar_t> work(m * n + n * n + m + n);
+                    std::vector<int64_t> order(n);
+                    for (int64_t b = start; b < end; ++b) {
+                        SVDMatrix<scalar_t, kM, kN>(
+                                A + b * m * n, U + b * m * m, S + b * n,
+                                VT + b * n * n, m, n, work.data(),
+                                order.data());
+                    }
+                });
+}
+
+/// Eigenvector of the simple eigenvalue eval of the symmetric 3x3 matrix a,
+/// the normalized largest cross product of two rows of a - eval I.
+template <typename scalar_t>
+void ComputeEigenvector0(const scalar_t* a, scalar_t eval, scalar_t* evec) {
+    const scalar_t row0[3] = {a[0] - eval, a[1], a[2]};
+    const scalar_t row1[3] = {a[3], a[4] - eval, a[5]};
+    const scalar_t row2[3] = {a[6], a[7], a[8] - eval};
+    scalar_t crosses[3][3];
+    const scalar_t* pairs[3][2] = {{row0, row1}, {row0, row2}, {row1, row2}};
+    int best = 0;
+    scalar_t best_norm = -1;
+    for (int i = 0; i < 3; ++i) {
+        const scalar_t* r = pairs[i][0];
+        const scalar_t* t = pairs[i][1];
+        crosses[i][0] = r[1] * t[2] - r[2] * t[1];
+        crosses[i][1] = r[2] * t[0] - r[0] * t[2];
+        crosses[i][2] = r[0] * t[1] - r[1] * t[0];
+        scalar_t norm = crosses[i][0] * crosses[i][0] +
+                        crosses[i][1] * crosses[i][1] +
+                        crosses[i][2] * crosses[i][2];
+        if (norm > best_norm) {
+            best_norm = norm;
+            best = i;
+        }
+    }
+    const scalar_t inv_norm = 1 / std::sqrt(best_norm);
+    for (int i = 0; i < 3; ++i) {
+        evec[i] = crosses[best][i] * inv_norm;
+    }
+}
+
+/// Eigenvector of eval orthogonal to the eigenvector evec0, found in the
+/// plane orthogonal to evec0.
+template <typename scalar_t>
+void ComputeEigenvector1(const scalar_t* a,
+                         const scalar_t* evec0,
+                         scalar_t eval,
+                         scalar_t* evec) {
+    scalar_t u[3], v[3];
+    if (std::abs(evec0[0]) > std::abs(evec0[1])) {
+        const scalar_t inv_length =
+                1 / std::sqrt(evec0[0] * evec0[0] + evec0[2] * evec0[2]);
+        u[0] = -evec0[2] * inv_length;
+        u[1] = 0;
+        u[2] = evec0[0] * inv_length;
+    } else {
+        const scalar_t inv_length =
+                1 / std::sqrt(evec0[1] * evec0[1] + evec0[2] * evec0[2]);
+        u[0] = 0;
+        u[1] = evec0[2] * inv_length;
+        u[2] = -evec0[1] * inv_length;
+    }
+    v[0] = evec0[1] * u[2] - evec0[2] * u[1];
+    v[1] = evec0[2] * u[0] - evec0[0] * u[2];
+    v[2] = evec0[0] * u[1] - evec0[1] * u[0];
+
+    scalar_t au[3], av[3];
+    for (int i = 0; i < 3; ++i) {
+        au[i] = a[i * 3] * u[0] + a[i * 3 + 1] * u[1] + a[i * 3 + 2] * u[2];
+        av[i] = a[i * 3] * v[0] + a[i * 3 + 1] * v[1] + a[i * 3 + 2] * v[2];
+    }
+    scalar_t m00 = u[0] * au[0] + u[1] * au[1] + u[2] * au[2] - eval;
+    scalar_t m01 = u[0] * av[0] + u[1] * av[1] + u[2] * av[2];
+    scalar_t m11 = v[0] * av[0] + v[1] * av[1] + v[2] * av[2] - eval;
+
+    // Null vector (x, y) of the 2x2 matrix [m00 m01; m01 m11], the
+    // eigenvector is x u + y v.
+    scalar_t x = 1, y = 0;
+    const scalar_t abs_m00 = std::abs(m00);
+    const scalar_t abs_m01 = std::abs(m01);
+    const scalar_t abs_m11 = std::abs(m11);
+    if (abs_m00 >= abs_m11) {
+        if (std::max(abs_m00, abs_m01) > 0) {
+            if (abs_m00 >= abs_m01) {
+                m01 /= m00;
+                m00 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / std::sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            x = m01;
+            y = -m00;
+        }
+    } else {
+        if (std::max(abs_m11, abs_m01) > 0) {
+            if (abs_m11 >= abs_m01) {
+                m01 /= m11;
+                m11 = 1 / std::sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / std::sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            x = m11;
+            y = -m01;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        evec[i] = x * u[i] + y * v[i];
+    }
+}
+
+template <typename scalar_t>
+void Cross(const scalar_t* a, const scalar_t* b, scalar_t* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+/// Closed form eigen decomposition of a symmetric 3x3 matrix, following
+/// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+/// as geometry::EstimateNormals does for the smallest eigenvector.
+template <typename scalar_t>
+void SymmetricEigen3x3(const scalar_t* a_in, scalar_t* evals, scalar_t* evecs) {
+    // Lower triangle, scaled to avoid over- and underflow.
+    scalar_t a[9];
+    scalar_t max_abs = 0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            a[i * 3 + j] = a_in[std::max(i, j) * 3 + std::min(i, j)];
+            max_abs = std::max(max_abs, std::abs(a[i * 3 + j]));
+        }
+    }
+    scalar_t vecs[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    scalar_t vals[3] = {0, 0, 0};
+    if (max_abs > 0) {
+        for (int i = 0; i < 9; ++i) {
+            a[i] /= max_abs;
+        }
+        const scalar_t norm = a[1] * a[1] + a[2] * a[2] + a[5] * a[5];
+        if (norm > 0) {
+            const scalar_t q = (a[0] + a[4] + a[8]) / 3;
+            const scalar_t b00 = a[0] - q;
+            const scalar_t b11 = a[4] - q;
+            const scalar_t b22 = a[8] - q;
+            const scalar_t p = std::sqrt(
+                    (b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+            const scalar_t c00 = b11 * b22 - a[5] * a[5];
+            const scalar_t c01 = a[1] * b22 - a[5] * a[2];
+            const scalar_t c02 = a[1] * a[5] - b11 * a[2];
+            const scalar_t det =
+                    (b00 * c00 - a[1] * c01 + a[2] * c02) / (p * p * p);
+            const scalar_t half_det =
+                    std::min(std::max(det / 2, scalar_t(-1)), scalar_t(1));
+            const scalar_t angle = std::acos(half_det) / 3;
+            const scalar_t two_thirds_pi = scalar_t(2.09439510239319549);
+            const scalar_t beta2 = std::cos(angle) * 2;
+            const scalar_t beta0 = std::cos(angle + two_thirds_pi) * 2;
+            const scalar_t beta1 = -(beta0 + beta2);
+            vals[0] = q + p * beta0;
+            vals[1] = q + p * beta1;
+            vals[2] = q + p * beta2;
+
+            // Start from the eigenvalue that is best separated.
+            if (half_det >= 0) {
+                ComputeEigenvector0(a, vals[2], vecs[2]);
+                ComputeEigenvector1(a, vecs[2], vals[1], vecs[1]);
+                Cross(vecs[1], vecs[2], vecs[0]);
+            } else {
+                ComputeEigenvector0(a, vals[0], vecs[0]);
+                ComputeEigenvector1(a, vecs[0], vals[1], vecs[1]);
+                Cross(vecs[0], vecs[1], vecs[2]);
+            }
+        } else {
+            // Diagonal.
+            for (int i = 0; i < 3; ++i) {
+                vals[i] = a[i * 4];
+            }
+            for (int i = 1; i < 3; ++i) {
+                for (int j = i; j > 0 && vals[j - 1] > vals[j]; --j) {
+                    std::swap(vals[j - 1], vals[j]);
+                    std::swap(vecs[j - 1], vecs[j]);
+                }
+            }
+        }
+    }
+    for (int j = 0; j < 3; ++j) {
+        evals[j] = vals[j] * max_abs;
+        for (int i = 0; i < 3; ++i) {
+            evecs[i * 3 + j] = vecs[j][i];
+        }
+    }
+}
+
+/// Eigen decomposition of a symmetric matrix with cyclic Jacobi rotations.
+/// work holds 2 * n * n values, order n values.
+template <typename scalar_t, int kN>
+void SymmetricEigenJacobi(const scalar_t* a_in,
+                          scalar_t* evals,
+                          scalar_t* evecs,
+                          int64_t n_,
+                          scalar_t* work,
+                          int64_t* order) {
+    const int64_t n = kN > 0 ? kN : n_;
+    const scalar_t eps = std::numeric_limits<scalar_t>::epsilon();
+    scalar_t* a = work;
+    scalar_t* v = work + n * n;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            a[i * n + j] = a_in[std::max(i, j) * n + std::min(i, j)];
+            v[i * n + j] = i == j ? 1 : 0;
+        }
+    }
+
+    for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+        bool rotated = false;
+        for (int64_t p = 0; p < n - 1; ++p) {
+            for (int64_t q = p + 1; q < n; ++q) {
+                const scalar_t apq = a[p * n + q];
+                const scalar_t app = a[p * n + p];
+                const scalar_t aqq = a[q * n + q];
+                if (std::abs(apq) <= eps * std::sqrt(std::abs(app * aqq))) {
+                    continue;
+                }
+                rotated = true;
+                const scalar_t theta = (aqq - app) / (2 * apq);
+                const scalar_t t =
+                        (theta >= 0 ? 1 : -1) /
+                        (std::abs(theta) + std::sqrt(theta * theta + 1));
+                const scalar_t c = 1 / std::sqrt(t * t + 1);
+                const scalar_t s = t * c;
+                for (int64_t k = 0; k < n; ++k) {
+                    const scalar_t akp = a[k * n + p];
+                    const scalar_t akq = a[k * n + q];
+                    a[k * n + p] = c * akp - s * akq;
+                    a[k * n + q] = s * akp + c * akq;
+                }
+                for (int64_t k = 0; k < n; ++k) {
+                    const scalar_t apk = a[p * n + k];
+                    const scalar_t aqk = a[q * n + k];
+                    a[p * n + k] = c * apk - s * aqk;
+                    a[q * n + k] = s * apk + c * aqk;
+                }
+                for (int64_t k = 0; k < n; ++k) {
+                    const scalar_t vkp = v[k * n + p];
+                    const scalar_t vkq = v[k * n + q];
+                    v[k * n + p] = c * vkp - s * vkq;
+                    v[k * n + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+        if (!rotated) {
+            break;
+        }
+    }
+
+    for (int64_t j = 0; j < n; ++j) {
+        order[j] = j;
+    }
+    std::sort(order, order + n, [&](int64_t i, int64_t j) {
+        return a[i * n + i] < a[j * n + j];
+    });
+    for (int64_t j = 0; j < n; ++j) {
+        evals[j] = a[order[j] * n + order[j]];
+        for (int64_t i = 0; i < n; ++i) {
+            evecs[i * n + j] = v[i * n + order[j]];
+        }
+    }
+}
+
+template <typename scalar_t, int kN>
+void SymmetricEigenKernel(const scalar_t* A,
+                          scalar_t* eigenvalues,
+                          scalar_t* eigenvectors,
+                          int64_t batch,
+                          int64_t n_) {
+    const int64_t n = kN > 0 ? kN : n_;
+    if (n == 3) {
+        ParallelFor(batch, GrainSize(200), [&](int64_t start, int64_t end) {
+            for (int64_t b = start; b < end; ++b) {
+                SymmetricEigen3x3(A + b * 9, eigenvalues + b * 3,
+                                  eigenvectors + b * 9);
+            }
+        });
+        return;
+    }
+    ParallelFor(batch, GrainSize(16 * n * n * n),
+                [&](int64_t start, int64_t end) {
+                    std::vector<scalar_t> work(2 * n * n);
+                    std::vector<int64_t> order(n);
+                    for (int64_t b = start; b < end; ++b) {
+                        SymmetricEigenJacobi<scalar_t, kN>(
+                                A + b * n * n, eigenvalues + b * n,
+                                eigenvectors + b * n * n, n, work.data(),
+                                order.data());
+                    }
+                });
+}
+
+}  // namespace
+
+void BatchedMatmulCPU(const void* A_data,
+                      const void* B_data,
+                      void* C_data,
+                      int64_t batch,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B = static_cast<const scalar_t*>(B_data);
+        scalar_t* C = static_cast<scalar_t*>(C_data);
+        if (m * k * n >= kBlasFlops) {
+            for (int64_t b = 0; b < batch; ++b) {
+                gemm_cpu<scalar_t>(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                   m, n, k, 1, A + b * m * k, k, B + b * k * n,
+                                   n, 0, C + b * m * n, n);
+            }
+        } else if (m == 3 && k == 3 && n == 3) {
+            MatmulKernel<scalar_t, 3, 3, 3>(A, B, C, batch, m, k, n);
+        } else if (m == 3 && k == 3 && n == 1) {
+            MatmulKernel<scalar_t, 3, 3, 1>(A, B, C, batch, m, k, n);
+        } else if (m == 4 && k == 4 && n == 4) {
+            MatmulKernel<scalar_t, 4, 4, 4>(A, B, C, batch, m, k, n);
+        } else if (m == 4 && k == 4 && n == 1) {
+            MatmulKernel<scalar_t, 4, 4, 1>(A, B, C, batch, m, k, n);
+        } else if (m == 6 && k == 6 && n == 6) {
+            MatmulKernel<scalar_t, 6, 6, 6>(A, B, C, batch, m, k, n);
+        } else if (m == 6 && k == 6 && n == 1) {
+            MatmulKernel<scalar_t, 6, 6, 1>(A, B, C, batch, m, k, n);
+        } else {
+            MatmulKernel<scalar_t, 0, 0, 0>(A, B, C, batch, m, k, n);
+        }
+    });
+}
+
+void BatchedInverseCPU(const void* A_data,
+                       void* output_data,
+                       int64_t batch,
+                       int64_t n,
+                       Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* output = static_cast<scalar_t*>(output_data);
+        if (n == 3) {
+            InverseKernel<scalar_t, 3>(A, output, batch, n);
+        } else if (n == 4) {
+            InverseKernel<scalar_t, 4>(A, output, batch, n);
+        } else if (n == 6) {
+            InverseKernel<scalar_t, 6>(A, output, batch, n);
+        } else {
+            InverseKernel<scalar_t, 0>(A, output, batch, n);
+        }
+    });
+}
+
+void BatchedSolveCPU(const void* A_data,
+                     const void* B_data,
+                     void* X_data,
+                     int64_t batch,
+                     int64_t n,
+                     int64_t k,
+                     Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B = static_cast<const scalar_t*>(B_data);
+        scalar_t* X = static_cast<scalar_t*>(X_data);
+        if (n == 3 && k == 1) {
+            SolveKernel<scalar_t, 3, 1>(A, B, X, batch, n, k);
+        } else if (n == 4 && k == 1) {
+            SolveKernel<scalar_t, 4, 1>(A, B, X, batch, n, k);
+        } else if (n == 6 && k == 1) {
+            SolveKernel<scalar_t, 6, 1>(A, B, X, batch, n, k);
+        } else {
+            SolveKernel<scalar_t, 0, 0>(A, B, X, batch, n, k);
+        }
+    });
+}
+
+void BatchedSVDCPU(const void* A_data,
+                   void* U_data,
+                   void* S_data,
+                   void* VT_data,
+                   int64_t batch,
+                   int64_t m,
+                   int64_t n,
+                   Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* U = static_cast<scalar_t*>(U_data);
+        scalar_t* S = static_cast<scalar_t*>(S_data);
+        scalar_t* VT = static_cast<scalar_t*>(VT_data);
+        if (m == 3 && n == 3) {
+            SVDKernel<scalar_t, 3, 3>(A, U, S, VT, batch, m, n);
+        } else if (m == 4 && n == 4) {
+            SVDKernel<scalar_t, 4, 4>(A, U, S, VT, batch, m, n);
+        } else if (m == 6 && n == 6) {
+            SVDKernel<scalar_t, 6, 6>(A, U, S, VT, batch, m, n);
+        } else {
+            SVDKernel<scalar_t, 0, 0>(A, U, S, VT, batch, m, n);
+        }
+    });
+}
+
+void BatchedSymmetricEigenCPU(const void* A_data,
+                              void* eigenvalues_data,
+                              void* eigenvectors_data,
+                              int64_t batch,
+                              int64_t n,
+                              Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A = static_cast<const scalar_t*>(A_data);
+        scalar_t* eigenvalues = static_cast<scalar_t*>(eigenvalues_data);
+        scalar_t* eigenvectors = static_cast<scalar_t*>(eigenvectors_data);
+        if (n == 3) {
+            SymmetricEigenKernel<scalar_t, 3>(A, eigenvalues, eigenvectors,
+                                              batch, n);
+        } else if (n == 4) {
+            SymmetricEigenKernel<scalar_t, 4>(A, eigenvalues, eigenvectors,
+                                              batch, n);
+        } else if (n == 6) {
+            SymmetricEigenKernel<scalar_t, 6>(A, eigenvalues, eigenvectors,
+                                              batch, n);
+        } else {
+            SymmetricEigenKernel<scalar_t, 0>(A, eigenvalues, eigenvectors,
+                                              batch, n);
+        }
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
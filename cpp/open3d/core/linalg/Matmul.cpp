@@ -28,6 +28,8 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
+
 namespace open3d {
 namespace core {
 
@@ -87,6 +89,8 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     output = Tensor::Empty({n, m}, dtype, device);
     void* C_data = output.GetDataPtr();
 
+    ProfilerScope scope("Linalg", "Matmul", {&output, &A_T, &B_T});
+
     if (device.GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         MatmulCUDA(A_data, B_data, C_data, m, k, n, dtype);
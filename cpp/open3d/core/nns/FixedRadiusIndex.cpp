@@ -26,11 +26,11 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
+#include <algorithm>
+#include <limits>
 
 #include "open3d/core/CoreUtil.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Console.h"
 
 namespace open3d {
@@ -48,40 +48,70 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
-    }
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
+    dataset_points.AssertShapeCompatible({utility::nullopt, 3});
+    if (dataset_points.GetShape()[0] >
+        std::numeric_limits<uint32_t>::max()) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetTensorData] too many dataset points.");
+    }
+    Device device = dataset_points.GetDevice();
+#ifndef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        utility::LogError(
+                "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. "
+                "Please compile Open3d with BUILD_CUDA_MODULE=ON.");
+    }
+#endif
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
     int64_t num_points = GetDatasetSize();
-    int64_t hash_table_size = std::min<int64_t>(
-            std::max<int64_t>(hash_table_size_factor * num_points, 1),
-            max_hash_tabls_size);
+    int64_t hash_table_size =
+            std::max<int64_t>(hash_table_size_factor * num_points, 1);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        hash_table_size =
+                std::min<int64_t>(hash_table_size, max_hash_tabls_size);
+    }
     points_row_splits_ = std::vector<int64_t>({0, num_points});
     hash_table_splits_ = std::vector<uint32_t>({0, (uint32_t)hash_table_size});
 
-    hash_table_index_ =
-            Tensor::Empty({dataset_points_.GetShape()[0]}, Dtype::Int32,
-                          dataset_points_.GetDevice());
-    hash_table_cell_splits_ =
-            Tensor::Empty({hash_table_splits_.back() + 1}, Dtype::Int32,
-                          dataset_points_.GetDevice());
+    hash_table_index_ = Tensor::Empty({dataset_points_.GetShape()[0]},
+                                      Dtype::Int32, device);
+    hash_table_cell_splits_ = Tensor::Empty(
+            {hash_table_splits_.back() + 1}, Dtype::Int32, device);
 
     out_hash_table_splits_ = std::vector<uint32_t>(2, 0);
     for (size_t i = 0; i < hash_table_splits_.size(); ++i) {
         out_hash_table_splits_[i] = hash_table_splits_[i];
     }
 
+    Dtype dtype = GetDtype();
+    if (device.GetType() == Device::DeviceType::CPU) {
+        hash_table_points_ = Tensor::Empty(dataset_points_.GetShape(), dtype,
+                                           device);
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            BuildSpatialHashTableCPU(
+                    dataset_points_.GetShape()[0],
+                    static_cast<scalar_t *>(dataset_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    static_cast<scalar_t *>(hash_table_points_.GetDataPtr()));
+        });
+        return true;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
-    Dtype dtype = GetDtype();
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
         BuildSpatialHashTableCUDA(
                 temp_ptr, temp_size, dataset_points_.GetShape()[1],
@@ -108,17 +138,12 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                 (uint32_t *)static_cast<int32_t *>(
                         hash_table_index_.GetDataPtr()));
     });
-    return true;
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
+    return true;
 };
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius) const {
-#ifdef BUILD_CUDA_MODULE
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -136,69 +161,104 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
 
-    void *temp_ptr = nullptr;
-    size_t temp_size = 0;
-
     Dtype dtype = GetDtype();
     Tensor neighbors_index;
     Tensor neighbors_distance;
     Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Dtype::Int64,
                                          dataset_points_.GetDevice());
 
-    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        NeighborSearchAllocator<scalar_t> output_allocator(
-                dataset_points_.GetDevice());
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size,
-                static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
-                GetDatasetSize(),
-                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
-                num_query_points,
-                static_cast<scalar_t *>(query_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_cell_splits_.GetDataPtr()),
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_index_.GetDataPtr()),
-                output_allocator);
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        // The cells only cover the neighborhood of the radius they were
+        // built for.
+        if (radius > radius_) {
+            utility::LogError(
+                    "[FixedRadiusIndex::SearchRadius] radius {} is larger than "
+                    "the radius {} of the index.",
+                    radius, radius_);
+        }
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCPU(
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(
+                            hash_table_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius),
+                    static_cast<scalar_t>(radius_), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
 
-        Tensor temp_tensor = Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
-                                           dataset_points_.GetDevice());
-        temp_ptr = temp_tensor.GetDataPtr();
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+    } else {
+#ifdef BUILD_CUDA_MODULE
+        void *temp_ptr = nullptr;
+        size_t temp_size = 0;
 
-        FixedRadiusSearchCUDA(
-                temp_ptr, temp_size,
-                static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
-                GetDatasetSize(),
-                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
-                num_query_points,
-                static_cast<scalar_t *>(query_points_.GetDataPtr()),
-                static_cast<scalar_t>(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_cell_splits_.GetDataPtr()),
-                (uint32_t *)static_cast<const int32_t *>(
-                        hash_table_index_.GetDataPtr()),
-                output_allocator);
+        DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(
+                    dataset_points_.GetDevice());
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
 
-        neighbors_index = output_allocator.NeighborsIndex().To(Dtype::Int64);
-        neighbors_distance = output_allocator.NeighborsDistance();
-    });
+            Tensor temp_tensor =
+                    Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8,
+                                  dataset_points_.GetDevice());
+            temp_ptr = temp_tensor.GetDataPtr();
+
+            FixedRadiusSearchCUDA(
+                    temp_ptr, temp_size,
+                    static_cast<int64_t *>(neighbors_row_splits.GetDataPtr()),
+                    GetDatasetSize(),
+                    static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                    num_query_points,
+                    static_cast<scalar_t *>(query_points_.GetDataPtr()),
+                    static_cast<scalar_t>(radius), points_row_splits_.size(),
+                    points_row_splits_.data(), queries_row_splits.size(),
+                    queries_row_splits.data(), hash_table_splits_.data(),
+                    hash_table_cell_splits_.GetShape()[0],
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_cell_splits_.GetDataPtr()),
+                    (uint32_t *)static_cast<const int32_t *>(
+                            hash_table_index_.GetDataPtr()),
+                    output_allocator);
+
+            neighbors_index =
+                    output_allocator.NeighborsIndex().To(Dtype::Int64);
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+#endif
+    }
 
     Tensor num_neighbors =
             neighbors_row_splits.Slice(0, 1, num_query_points + 1)
                     .Sub(neighbors_row_splits.Slice(0, 0, num_query_points));
     return std::make_tuple(neighbors_index, neighbors_distance, num_neighbors);
-#else
-    utility::LogError(
-            "FixedRadiusIndex::SearchRadius BUILD_CUDA_MODULE is OFF. Please "
-            "compile Open3d with BUILD_CUDA_MODULE=ON.");
-#endif
 };
 
 }  // namespace nns
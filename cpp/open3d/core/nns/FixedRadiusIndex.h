@@ -39,6 +39,10 @@ namespace nns {
 /// \class FixedRadiusIndex
 ///
 /// \brief FixedRadiusIndex for nearest neighbor range search.
+///
+/// Builds a spatial hash grid of 3D points with a cell size of twice the
+/// radius, so that each query visits at most 8 cells. Supports CPU and CUDA
+/// tensors.
 class FixedRadiusIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -77,7 +81,8 @@ public:
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
     /// dtype with dataset_points.
-    /// \param radius Radius.
+    /// \param radius Radius. For CPU indices it must not be larger than the
+    /// radius of the index.
     /// \return Tuple of Tensors, (indices, distances, num_neighbors):
     /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int64.
     /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
@@ -92,15 +97,22 @@ public:
         utility::LogError("FixedRadiusIndex::SearchHybrid not implemented.");
     }
 
-    const double hash_table_size_factor = 1 / 32;
+    /// Number of hash table cells per dataset point.
+    const double hash_table_size_factor = 1.0 / 32;
+    /// Maximum number of hash table cells of CUDA indices. CPU indices are
+    /// only sized by hash_table_size_factor, so that queries in dense regions
+    /// do not scan colliding cells.
     const int64_t max_hash_tabls_size = 10000;
 
 protected:
+    double radius_ = 0;
     std::vector<int64_t> points_row_splits_;
     std::vector<uint32_t> hash_table_splits_;
     std::vector<uint32_t> out_hash_table_splits_;
     Tensor hash_table_cell_splits_;
     Tensor hash_table_index_;
+    /// Dataset points in the order of hash_table_index_, CPU only.
+    Tensor hash_table_points_;
 };
 
 template <class T>
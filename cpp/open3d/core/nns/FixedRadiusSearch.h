@@ -202,6 +202,54 @@ void FixedRadiusSearchCUDA(void* temp,
                            const uint32_t* const hash_table_index,
                            NeighborSearchAllocator<T>& output_allocator);
 
+/// Builds a spatial hash table for a fixed radius search of 3D points on the
+/// CPU. The arguments are the same as for BuildSpatialHashTableCUDA without
+/// the temporary memory, all pointers point to host memory. Each cell lists
+/// its points in ascending order.
+///
+/// \param hash_table_points    Output array of size 3 * \p num_points with
+///        the point positions in the order of \p hash_table_index, so that
+///        searches scan each cell contiguously.
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index,
+                              TReal* hash_table_points);
+
+/// Fixed radius search on the CPU with the L2 metric. The arguments are the
+/// same as for FixedRadiusSearchCUDA without the temporary memory, all
+/// pointers point to host memory. The neighbors of each query point are
+/// sorted by their squared distance.
+///
+/// \param hash_table_points    The point positions written by
+///        BuildSpatialHashTableCPU, which replace the points argument.
+///
+/// \param hash_table_radius    The radius passed to BuildSpatialHashTableCPU.
+///        Must not be smaller than \p radius.
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const hash_table_points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T hash_table_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
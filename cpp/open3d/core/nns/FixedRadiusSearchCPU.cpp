@@ -0,0 +1,409 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/CPUExecutor.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/MiniVec.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Number of query points per task of the parallel search.
+constexpr int64_t kQueryGrainSize = 256;
+
+/// Collects the hash cells overlapping the axis aligned box around a query
+/// point. The box is covered by the cells of its 8 corners as long as the
+/// radius is not larger than half the voxel size.
+///
+/// \return The number of distinct cells written to \p bins_to_visit.
+template <class T>
+int FindBinsToVisit(const Vec3<T>& query_pos,
+                    const T radius,
+                    const T inv_voxel_size,
+                    const size_t hash_table_size,
+                    size_t* bins_to_visit) {
+    int num_bins = 0;
+    bins_to_visit[num_bins++] =
+            SpatialHash(ComputeVoxelIndex(query_pos, inv_voxel_size)) %
+            hash_table_size;
+
+    for (int dz = -1; dz <= 1; dz += 2)
+        for (int dy = -1; dy <= 1; dy += 2)
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3<T> p = query_pos + radius * Vec3<T>(T(dx), T(dy), T(dz));
+                size_t hash =
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                        hash_table_size;
+
+                // insert without duplicates
+                if (std::find(bins_to_visit, bins_to_visit + num_bins, hash) ==
+                    bins_to_visit + num_bins) {
+                    bins_to_visit[num_bins++] = hash;
+                }
+            }
+    return num_bins;
+}
+
+/// Calls func(point_idx, squared_distance) for every point within radius of
+/// the query point. The points are read in cell order from
+/// \p hash_table_points, so that each cell is a contiguous scan.
+template <class T, class F>
+void ForEachNeighbor(const Vec3<T>& query_pos,
+                     const T* const hash_table_points,
+                     const T radius,
+                     const T inv_voxel_size,
+                     const size_t hash_table_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     F func) {
+    const T threshold = radius * radius;
+    size_t bins_to_visit[9];
+    const int num_bins = FindBinsToVisit(query_pos, radius, inv_voxel_size,
+                                         hash_table_size, bins_to_visit);
+    const T z_min = query_pos[2] - radius;
+    const T z_max = query_pos[2] + radius;
+    for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+        const size_t bin = bins_to_visit[bin_i];
+        // The cells are sorted by z, only the slab around the query is
+        // scanned.
+        uint32_t begin_idx = hash_table_cell_splits[bin];
+        uint32_t end_idx = hash_table_cell_splits[bin + 1];
+        while (begin_idx < end_idx) {
+            uint32_t mid = begin_idx + (end_idx - begin_idx) / 2;
+            if (hash_table_points[3 * mid + 2] < z_min) {
+                begin_idx = mid + 1;
+            } else {
+                end_idx = mid;
+            }
+        }
+        for (uint32_t j = begin_idx; j < hash_table_cell_splits[bin + 1]; ++j) {
+            const T* const p = hash_table_points + 3 * j;
+            if (p[2] > z_max) {
+                break;
+            }
+            // Plain scalars, MiniVec temporaries are not optimized away in
+            // this loop.
+            const T dx = p[0] - query_pos[0];
+            const T dy = p[1] - query_pos[1];
+            const T dz = p[2] - query_pos[2];
+            const T dist = dx * dx + dy * dy + dz * dz;
+            if (dist <= threshold) {
+                func(hash_table_index[j], dist);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+template <class TReal, class TIndex>
+void BuildSpatialHashTableCPU(const size_t num_points,
+                              const TReal* const points,
+                              const TReal radius,
+                              const size_t points_row_splits_size,
+                              const int64_t* points_row_splits,
+                              const TIndex* hash_table_splits,
+                              const size_t hash_table_cell_splits_size,
+                              TIndex* hash_table_cell_splits,
+                              TIndex* hash_table_index,
+                              TReal* hash_table_points) {
+    const int batch_size = points_row_splits_size - 1;
+    const TReal voxel_size = 2 * radius;
+    const TReal inv_voxel_size = 1 / voxel_size;
+
+    // The hash of each point is computed in parallel. Counting and placing
+    // the points is a serial pass, so that the table does not depend on the
+    // thread count.
+    std::vector<TIndex> point_cells(num_points);
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        ParallelFor(points_row_splits[i + 1] - points_row_splits[i], 4096,
+                    [&](int64_t start, int64_t end) {
+                        for (int64_t j = points_row_splits[i] + start;
+                             j < points_row_splits[i] + end; ++j) {
+                            Vec3<TReal> pos(points + 3 * j);
+                            size_t hash = SpatialHash(ComputeVoxelIndex(
+                                                  pos, inv_voxel_size)) %
+                                          hash_table_size;
+                            point_cells[j] = first_cell_idx + hash;
+                        }
+                    });
+    }
+
+    // note the +1 because we want the first element to be 0
+    std::fill(hash_table_cell_splits,
+              hash_table_cell_splits + hash_table_cell_splits_size, 0);
+    for (size_t j = 0; j < num_points; ++j) {
+        ++hash_table_cell_splits[point_cells[j] + 1];
+    }
+    utility::InclusivePrefixSum(
+            hash_table_cell_splits,
+            hash_table_cell_splits + hash_table_cell_splits_size,
+            hash_table_cell_splits);
+
+    std::vector<TIndex> count_tmp(hash_table_cell_splits_size - 1, 0);
+    for (size_t j = 0; j < num_points; ++j) {
+        const TIndex cell = point_cells[j];
+        hash_table_index[hash_table_cell_splits[cell] + count_tmp[cell]++] =
+                static_cast<TIndex>(j);
+    }
+
+    // Sorting each cell by z lets the search skip the points outside of the
+    // slab of the query.
+    ParallelFor(hash_table_cell_splits_size - 1, 64,
+                [&](int64_t start, int64_t end) {
+                    for (int64_t cell = start; cell < end; ++cell) {
+                        std::sort(hash_table_index +
+                                          hash_table_cell_splits[cell],
+                                  hash_table_index +
+                                          hash_table_cell_splits[cell + 1],
+                                  [&](TIndex a, TIndex b) {
+                                      return points[3 * a + 2] <
+                                                     points[3 * b + 2] ||
+                                             (points[3 * a + 2] ==
+                                                      points[3 * b + 2] &&
+                                              a < b);
+                                  });
+                    }
+                });
+
+    ParallelFor(num_points, 4096, [&](int64_t start, int64_t end) {
+        for (int64_t j = start; j < end; ++j) {
+            std::copy(points + 3 * hash_table_index[j],
+                      points + 3 * hash_table_index[j] + 3,
+                      hash_table_points + 3 * j);
+        }
+    });
+}
+
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const hash_table_points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T hash_table_radius,
+                          const size_t points_row_splits_size,
+                          const int64_t* const points_row_splits,
+                          const size_t queries_row_splits_size,
+                          const int64_t* const queries_row_splits,
+                          const uint32_t* const hash_table_splits,
+                          size_t hash_table_cell_splits_size,
+                          const uint32_t* const hash_table_cell_splits,
+                          const uint32_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator) {
+    // return empty output arrays if there are no points
+    if (0 == num_points || 0 == num_queries) {
+        std::fill(query_neighbors_row_splits,
+                  query_neighbors_row_splits + num_queries + 1, 0);
+        int32_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+        return;
+    }
+
+    const int batch_size = points_row_splits_size - 1;
+    const T voxel_size = 2 * hash_table_radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    // Queries are visited in the order of their cells, so that consecutive
+    // queries scan the same cells while they are in cache.
+    std::vector<int64_t> query_order(num_queries);
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const int64_t queries_begin = queries_row_splits[i];
+        const int64_t num_queries_i = queries_row_splits[i + 1] - queries_begin;
+
+        std::vector<uint32_t> query_cells(num_queries_i);
+        ParallelFor(num_queries_i, 4096, [&](int64_t start, int64_t end) {
+            for (int64_t q = start; q < end; ++q) {
+                Vec3<T> pos(queries + 3 * (queries_begin + q));
+                query_cells[q] =
+                        SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                        hash_table_size;
+            }
+        });
+        std::vector<int64_t> cell_offsets(hash_table_size + 1, 0);
+        for (uint32_t cell : query_cells) {
+            ++cell_offsets[cell + 1];
+        }
+        std::partial_sum(cell_offsets.begin(), cell_offsets.end(),
+                         cell_offsets.begin());
+        for (int64_t q = 0; q < num_queries_i; ++q) {
+            query_order[queries_begin + cell_offsets[query_cells[q]]++] =
+                    queries_begin + q;
+        }
+    }
+
+    // Calls func(query_idx, hash_table_size, cell_splits) for the queries in
+    // cell order.
+    auto for_each_query = [&](const auto& func) {
+        for (int i = 0; i < batch_size; ++i) {
+            const size_t hash_table_size =
+                    hash_table_splits[i + 1] - hash_table_splits[i];
+            const uint32_t* const cell_splits_i =
+                    hash_table_cell_splits + hash_table_splits[i];
+            const int64_t queries_begin = queries_row_splits[i];
+            ParallelFor(queries_row_splits[i + 1] - queries_begin,
+                        kQueryGrainSize, [&](int64_t start, int64_t end) {
+                            for (int64_t pos = queries_begin + start;
+                                 pos < queries_begin + end; ++pos) {
+                                func(query_order[pos], hash_table_size,
+                                     cell_splits_i);
+                            }
+                        });
+        }
+    };
+
+    // count the neighbors of each query point, note the +1
+    query_neighbors_row_splits[0] = 0;
+    for_each_query([&](int64_t q, size_t hash_table_size,
+                       const uint32_t* cell_splits) {
+        int64_t count = 0;
+        ForEachNeighbor(Vec3<T>(queries + 3 * q), hash_table_points, radius,
+                        inv_voxel_size, hash_table_size, cell_splits,
+                        hash_table_index, [&](uint32_t, T) { ++count; });
+        query_neighbors_row_splits[q + 1] = count;
+    });
+    utility::InclusivePrefixSum(query_neighbors_row_splits + 1,
+                                query_neighbors_row_splits + num_queries + 1,
+                                query_neighbors_row_splits + 1);
+
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+
+    // Write the neighbors of each query sorted by distance, which is the
+    // order of the KDTree radius search.
+    for_each_query([&](int64_t q, size_t hash_table_size,
+                       const uint32_t* cell_splits) {
+        T* const distances_q = distances_ptr + query_neighbors_row_splits[q];
+        int32_t* const indices_q = indices_ptr + query_neighbors_row_splits[q];
+        int64_t count = 0;
+        ForEachNeighbor(Vec3<T>(queries + 3 * q), hash_table_points, radius,
+                        inv_voxel_size, hash_table_size, cell_splits,
+                        hash_table_index, [&](uint32_t idx, T dist) {
+                            // insertion sort, the lists are short
+                            int64_t k = count++;
+                            while (k > 0 &&
+                                   (distances_q[k - 1] > dist ||
+                                    (distances_q[k - 1] == dist &&
+                                     indices_q[k - 1] > int32_t(idx)))) {
+                                distances_q[k] = distances_q[k - 1];
+                                indices_q[k] = indices_q[k - 1];
+                                --k;
+                            }
+                            distances_q[k] = dist;
+                            indices_q[k] = int32_t(idx);
+                        });
+    });
+}
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const float* const points,
+        const float radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const uint32_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        uint32_t* hash_table_cell_splits,
+        uint32_t* hash_table_index,
+        float* hash_table_points);
+
+template void BuildSpatialHashTableCPU(
+        const size_t num_points,
+        const double* const points,
+        const double radius,
+        const size_t points_row_splits_size,
+        const int64_t* points_row_splits,
+        const uint32_t* hash_table_splits,
+        const size_t hash_table_cell_splits_size,
+        uint32_t* hash_table_cell_splits,
+        uint32_t* hash_table_index,
+        double* hash_table_points);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const float* const hash_table_points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const float hash_table_radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const uint32_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const uint32_t* const hash_table_cell_splits,
+        const uint32_t* const hash_table_index,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const double* const hash_table_points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const double hash_table_radius,
+        const size_t points_row_splits_size,
+        const int64_t* const points_row_splits,
+        const size_t queries_row_splits_size,
+        const int64_t* const queries_row_splits,
+        const uint32_t* const hash_table_splits,
+        size_t hash_table_cell_splits_size,
+        const uint32_t* const hash_table_cell_splits,
+        const uint32_t* const hash_table_index,
+        NeighborSearchAllocator<double>& output_allocator);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,544 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/HNSWIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include "open3d/core/CPUExecutor.h"
+#include "open3d/core/CoreUtil.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Links of the graph. The bottom layer links of all points are stored in
+/// one array, upper layer links per point, since only few points have them.
+/// Each list starts with the number of links.
+struct HNSWGraph {
+    int max_degree = 0;
+    int max_degree0 = 0;
+    std::vector<int> levels;
+    std::vector<uint32_t> links0;
+    std::vector<std::vector<uint32_t>> upper_links;
+    uint32_t entry_point = 0;
+    int max_level = 0;
+
+    int MaxDegree(int level) const {
+        return level == 0 ? max_degree0 : max_degree;
+    }
+
+    uint32_t *Links(uint32_t point, int level) {
+        return level == 0
+                       ? &links0[int64_t(point) * (max_degree0 + 1)]
+                       : &upper_links[point][(level - 1) * (max_degree + 1)];
+    }
+};
+
+namespace {
+
+constexpr int64_t kBuildGrainSize = 64;
+constexpr int64_t kQueryGrainSize = 64;
+
+/// Visited marks of the points, cleared by bumping the tag.
+class VisitedList {
+public:
+    explicit VisitedList(int64_t size) : tags_(size, 0) {}
+
+    void Reset() {
+        if (++tag_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            tag_ = 1;
+        }
+    }
+
+    /// Marks the point and returns true if it was marked before.
+    bool Visit(uint32_t point) {
+        if (tags_[point] == tag_) {
+            return true;
+        }
+        tags_[point] = tag_;
+        return false;
+    }
+
+private:
+    std::vector<uint32_t> tags_;
+    uint32_t tag_ = 0;
+};
+
+/// Reuses visited lists across the ranges of a parallel loop.
+class VisitedListPool {
+public:
+    explicit VisitedListPool(int64_t size) : size_(size) {}
+
+    std::unique_ptr<VisitedList> Get() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (lists_.empty()) {
+            return std::unique_ptr<VisitedList>(new VisitedList(size_));
+        }
+        std::unique_ptr<VisitedList> list = std::move(lists_.back());
+        lists_.pop_back();
+        return list;
+    }
+
+    void Release(std::unique_ptr<VisitedList> list) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lists_.push_back(std::move(list));
+    }
+
+private:
+    int64_t size_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<VisitedList>> lists_;
+};
+
+template <class T>
+inline T SquaredDistance(const T *a, const T *b, int dimension) {
+    // Independent sums, so that the loop is not bound by the add latency.
+    T sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    int i = 0;
+    for (; i + 4 <= dimension; i += 4) {
+        T d0 = a[i] - b[i];
+        T d1 = a[i + 1] - b[i + 1];
+        T d2 = a[i + 2] - b[i + 2];
+        T d3 = a[i + 3] - b[i + 3];
+        sum0 += d0 * d0;
+        sum1 += d1 * d1;
+        sum2 += d2 * d2;
+        sum3 += d3 * d3;
+    }
+    for (; i < dimension; ++i) {
+        T d = a[i] - b[i];
+        sum0 += d * d;
+    }
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+/// Search and insertion on the graph. While building, the link lists are
+/// guarded by per point locks.
+template <class T>
+class GraphSearch {
+public:
+    typedef std::pair<T, uint32_t> Candidate;
+    typedef std::priority_queue<Candidate> MaxHeap;
+    typedef std::priority_queue<Candidate,
+                                std::vector<Candidate>,
+                                std::greater<Candidate>>
+            MinHeap;
+
+    GraphSearch(HNSWGraph &graph,
+                const T *data,
+                int dimension,
+                std::vector<std::mutex> *locks = nullptr)
+        : graph_(graph), data_(data), dimension_(dimension), locks_(locks) {}
+
+    const T *Point(uint32_t point) const {
+        return data_ + int64_t(point) * dimension_;
+    }
+
+    /// Walks to the closest point of a layer, starting at \p entry.
+    uint32_t GreedyClosest(const T *query,
+                           uint32_t entry,
+                           int level,
+                           std::vector<uint32_t> &buffer) const {
+        T best = SquaredDistance(query, Point(entry), dimension_);
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            int count = CopyLinks(entry, level, buffer);
+            for (int i = 0; i < count; ++i) {
+                T dist = SquaredDistance(query, Point(buffer[i]), dimension_);
+                if (dist < best) {
+                    best = dist;
+                    entry = buffer[i];
+                    changed = true;
+                }
+            }
+        }
+        return entry;
+    }
+
+    /// Best first search of a layer. Returns the ef closest points found.
+    MaxHeap SearchLayer(const T *query,
+                        uint32_t entry,
+                        int ef,
+                        int level,
+                        VisitedList &visited,
+                        std::vector<uint32_t> &buffer) const {
+        visited.Reset();
+        MaxHeap top;
+        MinHeap candidates;
+        T dist = SquaredDistance(query, Point(entry), dimension_);
+        top.emplace(dist, entry);
+        candidates.emplace(dist, entry);
+        visited.Visit(entry);
+        while (!candidates.empty()) {
+            Candidate closest = candidates.top();
+            if (closest.first > top.top().first && int(top.size()) >= ef) {
+                break;
+            }
+            candidates.pop();
+            int count = CopyLinks(closest.second, level, buffer);
+            for (int i = 0; i < count; ++i) {
+                uint32_t neighbor = buffer[i];
+                if (visited.Visit(neighbor)) {
+                    continue;
+                }
+                dist = SquaredDistance(query, Point(neighbor), dimension_);
+                if (int(top.size()) < ef || dist < top.top().first) {
+                    candidates.emplace(dist, neighbor);
+                    top.emplace(dist, neighbor);
+                    if (int(top.size()) > ef) {
+                        top.pop();
+                    }
+                }
+            }
+        }
+        return top;
+    }
+
+    /// Inserts a point whose level is set and whose links are empty.
+    void Insert(uint32_t point,
+                int ef_construction,
+                std::mutex &entry_lock,
+                VisitedList &visited,
+                std::vector<uint32_t> &buffer) {
+        const T *query = Point(point);
+        int level = graph_.levels[point];
+
+        // Points above the current top layer become the new entry point, the
+        // entry stays locked until they are linked.
+        std::unique_lock<std::mutex> lock(entry_lock);
+        uint32_t entry = graph_.entry_point;
+        int max_level = graph_.max_level;
+        if (level <= max_level) {
+            lock.unlock();
+        }
+
+        for (int l = max_level; l > level; --l) {
+            entry = GreedyClosest(query, entry, l, buffer);
+        }
+        for (int l = std::min(level, max_level); l >= 0; --l) {
+            MaxHeap top = SearchLayer(query, entry, ef_construction, l,
+                                      visited, buffer);
+            std::vector<Candidate> neighbors(top.size());
+            for (size_t i = neighbors.size(); i > 0; --i) {
+                neighbors[i - 1] = top.top();
+                top.pop();
+            }
+            entry = neighbors[0].second;
+            SelectNeighbors(neighbors, graph_.max_degree);
+            {
+                std::lock_guard<std::mutex> point_lock((*locks_)[point]);
+                uint32_t *links = graph_.Links(point, l);
+                links[0] = uint32_t(neighbors.size());
+                for (size_t i = 0; i < neighbors.size(); ++i) {
+                    links[i + 1] = neighbors[i].second;
+                }
+            }
+            for (const Candidate &neighbor : neighbors) {
+                Connect(neighbor.second, point, neighbor.first, l);
+            }
+        }
+
+        if (level > max_level) {
+            graph_.entry_point = point;
+            graph_.max_level = level;
+        }
+    }
+
+private:
+    int CopyLinks(uint32_t point,
+                  int level,
+                  std::vector<uint32_t> &buffer) const {
+        std::unique_lock<std::mutex> lock;
+        if (locks_) {
+            lock = std::unique_lock<std::mutex>((*locks_)[point]);
+        }
+        const uint32_t *links = graph_.Links(point, level);
+        std::copy(links + 1, links + 1 + links[0], buffer.begin());
+        return int(links[0]);
+    }
+
+    /// Keeps up to max_degree of the candidates, sorted by distance, that
+    /// are closer to the point than to any kept candidate. This keeps links
+    /// towards separate clusters instead of only the closest one.
+    void SelectNeighbors(std::vector<Candidate> &candidates,
+                         int max_degree) const {
+        std::vector<Candidate> selected;
+        for (const Candidate &candidate : candidates) {
+            if (int(selected.size()) >= max_degree) {
+                break;
+            }
+            const T *p = Point(candidate.second);
+            bool keep = true;
+            for (const Candidate &s : selected) {
+                if (SquaredDistance(p, Point(s.second), dimension_) <
+                    candidate.first) {
+                    keep = false;
+                    break;
+                }
+            }
+            if (keep) {
+                selected.push_back(candidate);
+            }
+        }
+        candidates.swap(selected);
+    }
+
+    /// Adds a link from \p point to \p new_neighbor, pruning the links of
+    /// \p point if they are full.
+    void Connect(uint32_t point, uint32_t new_neighbor, T dist, int level) {
+        std::lock_guard<std::mutex> lock((*locks_)[point]);
+        uint32_t *links = graph_.Links(point, level);
+        int max_degree = graph_.MaxDegree(level);
+        int count = int(links[0]);
+        if (count < max_degree) {
+            links[count + 1] = new_neighbor;
+            links[0] = uint32_t(count + 1);
+            return;
+        }
+
+        std::vector<Candidate> candidates;
+        candidates.reserve(count + 1);
+        candidates.emplace_back(dist, new_neighbor);
+        for (int i = 0; i < count; ++i) {
+            candidates.emplace_back(SquaredDistance(Point(point),
+                                                    Point(links[i + 1]),
+                                                    dimension_),
+                                    links[i + 1]);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        SelectNeighbors(candidates, max_degree);
+        links[0] = uint32_t(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            links[i + 1] = candidates[i].second;
+        }
+    }
+
+    HNSWGraph &graph_;
+    const T *data_;
+    int dimension_;
+    std::vector<std::mutex> *locks_;
+};
+
+}  // namespace
+
+HNSWIndex::HNSWIndex(int max_degree, int ef_construction)
+    : max_degree_(max_degree),
+      ef_construction_(std::max(ef_construction, max_degree)) {
+    if (max_degree < 2) {
+        utility::LogError(
+                "[HNSWIndex] max_degree should be at least 2, but got {}.",
+                max_degree);
+    }
+}
+
+HNSWIndex::HNSWIndex(const Tensor &dataset_points,
+                     int max_degree,
+                     int ef_construction)
+    : HNSWIndex(max_degree, ef_construction) {
+    SetTensorData(dataset_points);
+}
+
+HNSWIndex::~HNSWIndex() {}
+
+bool HNSWIndex::SetTensorData(const Tensor &dataset_points) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[HNSWIndex::SetTensorData] dataset_points must be 2D matrix, "
+                "with shape {n_dataset_points, d}.");
+    }
+    dataset_points.AssertDevice(Device("CPU:0"));
+    int64_t num_points = dataset_points.GetShape()[0];
+    if (num_points > std::numeric_limits<uint32_t>::max()) {
+        utility::LogError(
+                "[HNSWIndex::SetTensorData] Too many points ({}), at most {} "
+                "are supported.",
+                num_points, std::numeric_limits<uint32_t>::max());
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    int dimension = GetDimension();
+
+    graph_.reset(new HNSWGraph());
+    graph_->max_degree = max_degree_;
+    graph_->max_degree0 = 2 * max_degree_;
+    graph_->levels.resize(num_points);
+    graph_->upper_links.resize(num_points);
+    graph_->links0.assign(num_points * (graph_->max_degree0 + 1), 0);
+
+    // Levels are drawn serially so that they do not depend on the threads.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double level_mult = 1.0 / std::log(double(max_degree_));
+    for (int64_t i = 0; i < num_points; ++i) {
+        int level = int(-std::log(1.0 - uniform(rng)) * level_mult);
+        graph_->levels[i] = level;
+        graph_->upper_links[i].assign(level * (max_degree_ + 1), 0);
+    }
+    if (num_points == 0) {
+        return true;
+    }
+    graph_->entry_point = 0;
+    graph_->max_level = graph_->levels[0];
+
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(GetDtype(), [&]() {
+        std::vector<std::mutex> locks(num_points);
+        std::mutex entry_lock;
+        GraphSearch<scalar_t> search(
+                *graph_,
+                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                dimension, &locks);
+        VisitedListPool pool(num_points);
+        ParallelFor(num_points - 1, kBuildGrainSize,
+                    [&](int64_t start, int64_t end) {
+                        std::unique_ptr<VisitedList> visited = pool.Get();
+                        std::vector<uint32_t> buffer(graph_->max_degree0);
+                        for (int64_t i = start; i < end; ++i) {
+                            search.Insert(uint32_t(i + 1), ef_construction_,
+                                          entry_lock, *visited, buffer);
+                        }
+                        pool.Release(std::move(visited));
+                    });
+    });
+    return true;
+}
+
+std::pair<Tensor, Tensor> HNSWIndex::SearchKnn(const Tensor &query_points,
+                                               int knn) const {
+    // Check dtype.
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+
+    // Check shapes.
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    if (knn <= 0) {
+        utility::LogError(
+                "[HNSWIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    int64_t num_query_points = query_points.GetShape()[0];
+    int64_t num_neighbors =
+            std::min(int64_t(knn), int64_t(GetDatasetSize()));
+    int dimension = GetDimension();
+    Dtype dtype = GetDtype();
+    Tensor indices =
+            Tensor::Full({num_query_points, num_neighbors}, -1, Dtype::Int64);
+    Tensor distances =
+            Tensor::Full({num_query_points, num_neighbors}, -1, dtype);
+    if (num_query_points == 0 || num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+
+    Tensor queries = query_points.Contiguous();
+    int ef = std::max(ef_search_, int(num_neighbors));
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
+        GraphSearch<scalar_t> search(
+                *graph_,
+                static_cast<const scalar_t *>(dataset_points_.GetDataPtr()),
+                dimension);
+        const scalar_t *query_ptr =
+                static_cast<const scalar_t *>(queries.GetDataPtr());
+        int64_t *indices_ptr = static_cast<int64_t *>(indices.GetDataPtr());
+        scalar_t *distances_ptr =
+                static_cast<scalar_t *>(distances.GetDataPtr());
+        VisitedListPool pool(GetDatasetSize());
+
+        ParallelFor(num_query_points, kQueryGrainSize, [&](int64_t start,
+                                                           int64_t end) {
+            std::unique_ptr<VisitedList> visited = pool.Get();
+            std::vector<uint32_t> buffer(graph_->max_degree0);
+            for (int64_t i = start; i < end; ++i) {
+                const scalar_t *query = query_ptr + i * dimension;
+                uint32_t entry = graph_->entry_point;
+                for (int l = graph_->max_level; l > 0; --l) {
+                    entry = search.GreedyClosest(query, entry, l, buffer);
+                }
+                auto top = search.SearchLayer(query, entry, ef, 0, *visited,
+                                              buffer);
+                while (int64_t(top.size()) > num_neighbors) {
+                    top.pop();
+                }
+                for (int64_t j = int64_t(top.size()) - 1; j >= 0; --j) {
+                    indices_ptr[i * num_neighbors + j] = top.top().second;
+                    distances_ptr[i * num_neighbors + j] = top.top().first;
+                    top.pop();
+                }
+            }
+            pool.Release(std::move(visited));
+        });
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::pair<Tensor, Tensor> HNSWIndex::SearchHybrid(const Tensor &query_points,
+                                                  float radius,
+                                                  int max_knn) const {
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[HNSWIndex::SearchHybrid] max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[HNSWIndex::SearchHybrid] radius should be larger than 0.");
+    }
+
+    Tensor indices;
+    Tensor distances;
+    std::tie(indices, distances) = SearchKnn(query_points, max_knn);
+
+    // Distances are squared.
+    DISPATCH_FLOAT32_FLOAT64_DTYPE(GetDtype(), [&]() {
+        Tensor invalid = distances.Gt(double(radius) * radius);
+        indices.SetItem(TensorKey::IndexTensor(invalid),
+                        Tensor(std::vector<int64_t>({-1}), {1}, Dtype::Int64));
+        distances.SetItem(TensorKey::IndexTensor(invalid),
+                          Tensor(std::vector<scalar_t>({-1}), {1}, GetDtype()));
+    });
+    return std::make_pair(indices, distances);
+}
+
+void HNSWIndex::SetEfSearch(int ef_search) {
+    if (ef_search <= 0) {
+        utility::LogError(
+                "[HNSWIndex::SetEfSearch] ef_search should be larger than 0.");
+    }
+    ef_search_ = ef_search;
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+struct HNSWGraph;
+
+/// \class HNSWIndex
+///
+/// \brief Approximate nearest neighbor search with a hierarchical navigable
+/// small world graph (Malkov and Yashunin, 2018) on CPU.
+///
+/// Unlike KDTrees, the search cost grows slowly with the dimension, which
+/// makes it suitable for matching high dimensional features like FPFH. The
+/// graph is built in parallel, queries are searched in parallel. The recall
+/// is traded against speed with SetEfSearch(). Distances are squared L2.
+class HNSWIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param max_degree Number of neighbors of a point on the upper layers
+    /// of the graph, twice that on the bottom layer. Larger values increase
+    /// recall and memory use.
+    /// \param ef_construction Size of the candidate list while building the
+    /// graph. Larger values give a better graph but a slower build.
+    HNSWIndex(int max_degree = 16, int ef_construction = 200);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Dataset points with shape {n, d}, Float32 or
+    /// Float64 on CPU.
+    /// \param max_degree See HNSWIndex().
+    /// \param ef_construction See HNSWIndex().
+    HNSWIndex(const Tensor &dataset_points,
+              int max_degree = 16,
+              int ef_construction = 200);
+    ~HNSWIndex();
+    HNSWIndex(const HNSWIndex &) = delete;
+    HNSWIndex &operator=(const HNSWIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        utility::LogError(
+                "HNSWIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Approximate knn search. Returns {n, min(knn, dataset size)} tensors,
+    /// sorted by distance. Entries the search could not fill are -1.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points, const Tensor &radii) const override {
+        utility::LogError("HNSWIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points, double radius) const override {
+        utility::LogError("HNSWIndex::SearchRadius not implemented.");
+    }
+
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                           float radius,
+                                           int max_knn) const override;
+
+    /// Sets the size of the candidate list of searches. Searches use at
+    /// least knn candidates. Larger values increase recall and search time.
+    void SetEfSearch(int ef_search);
+
+    int GetEfSearch() const { return ef_search_; }
+
+protected:
+    int max_degree_;
+    int ef_construction_;
+    int ef_search_ = 64;
+    std::unique_ptr<HNSWGraph> graph_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -27,7 +27,10 @@
 #include "open3d/core/nns/NanoFlannIndex.h"
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
+#include <algorithm>
+#include <limits>
 #include <nanoflann.hpp>
 
 #include "open3d/core/CoreUtil.h"
@@ -37,6 +40,70 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Number of consecutive queries in Z-order searched by one task.
+constexpr size_t kKnnGrainSize = 256;
+
+/// Spreads the lower 21 bits of x to every third bit.
+inline uint64_t SpreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Order of the points along a Z-order curve through the bounding box of
+/// their first three coordinates.
+template <class T>
+std::vector<int64_t> ZOrder(const T *points,
+                            int64_t num_points,
+                            int dimension) {
+    const int num_axes = std::min(dimension, 3);
+    T min_bound[3] = {0, 0, 0};
+    T scale[3] = {0, 0, 0};
+    for (int d = 0; d < num_axes; ++d) {
+        T lo = std::numeric_limits<T>::max();
+        T hi = std::numeric_limits<T>::lowest();
+        for (int64_t i = 0; i < num_points; ++i) {
+            lo = std::min(lo, points[i * dimension + d]);
+            hi = std::max(hi, points[i * dimension + d]);
+        }
+        min_bound[d] = lo;
+        scale[d] = hi > lo ? T(0x1fffff) / (hi - lo) : T(0);
+    }
+
+    std::vector<std::pair<uint64_t, int64_t>> codes(num_points);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_points),
+                      [&](const tbb::blocked_range<int64_t> &r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              uint64_t code = 0;
+                              for (int d = 0; d < num_axes; ++d) {
+                                  T p = points[i * dimension + d];
+                                  uint64_t q = std::min<uint64_t>(
+                                          static_cast<uint64_t>(
+                                                  (p - min_bound[d]) *
+                                                  scale[d]),
+                                          0x1fffff);
+                                  code |= SpreadBits(q) << d;
+                              }
+                              codes[i] = std::make_pair(code, i);
+                          }
+                      });
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    std::vector<int64_t> order(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        order[i] = codes[i].second;
+    }
+    return order;
+}
+
+}  // namespace
+
 NanoFlannIndex::NanoFlannIndex(){};
 
 NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
@@ -68,6 +135,35 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
 
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
+    Tensor batch_indices;
+    Tensor batch_distances;
+    SearchKnn(query_points, knn, batch_indices, batch_distances);
+
+    int64_t num_query_points = query_points.GetShape()[0];
+    if (num_query_points == 0) {
+        return std::make_pair(batch_indices, batch_distances);
+    }
+
+    // Check if the number of neighbors are same.
+    Tensor check_valid = batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
+    int64_t num_neighbors = check_valid[0].Item<int64_t>();
+    if (check_valid.Ne(num_neighbors).Any()) {
+        utility::LogError(
+                "[NanoFlannIndex::SearchKnn] The number of neighbors are "
+                "different. Something went wrong.");
+    }
+    // Slice non-zero items.
+    Tensor indices = batch_indices.Slice(1, 0, num_neighbors)
+                             .View({num_query_points, num_neighbors});
+    Tensor distances = batch_distances.Slice(1, 0, num_neighbors)
+                               .View({num_query_points, num_neighbors});
+    return std::make_pair(indices, distances);
+};
+
+void NanoFlannIndex::SearchKnn(const Tensor &query_points,
+                               int knn,
+                               Tensor &indices,
+                               Tensor &distances) const {
     // Check dtype.
     query_points.AssertDtype(GetDtype());
 
@@ -80,53 +176,56 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     }
 
     int64_t num_query_points = query_points.GetShape()[0];
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
+    Device host("CPU:0");
+    SizeVector output_shape{num_query_points, knn};
+    auto reusable = [&](const Tensor &t, const Dtype &t_dtype) {
+        return t.GetShape() == output_shape && t.GetDtype() == t_dtype &&
+               t.GetDevice() == host && t.IsContiguous();
+    };
+    if (!reusable(indices, Dtype::Int64)) {
+        indices = Tensor::Empty(output_shape, Dtype::Int64, host);
+    }
+    if (!reusable(distances, dtype)) {
+        distances = Tensor::Empty(output_shape, dtype, host);
+    }
+    if (num_query_points == 0) {
+        return;
+    }
 
-    Tensor indices;
-    Tensor distances;
+    Tensor queries = query_points.Contiguous();
     DISPATCH_FLOAT32_FLOAT64_DTYPE(dtype, [&]() {
-        Tensor batch_indices =
-                Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
-        Tensor batch_distances =
-                Tensor::Full({num_query_points, knn}, -1, dtype);
-
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
-
-        // Parallel search.
+        const scalar_t *query_ptr =
+                static_cast<const scalar_t *>(queries.GetDataPtr());
+        int64_t *indices_ptr = static_cast<int64_t *>(indices.GetDataPtr());
+        scalar_t *distances_ptr =
+                static_cast<scalar_t *>(distances.GetDataPtr());
+        std::vector<int64_t> order =
+                ZOrder(query_ptr, num_query_points, dimension);
+
+        // Parallel search over runs of consecutive queries in Z-order, which
+        // share most of their tree traversal and thus stay in cache.
         tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
+                tbb::blocked_range<size_t>(0, num_query_points, kKnnGrainSize),
                 [&](const tbb::blocked_range<size_t> &r) {
                     for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
-                        holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
+                        int64_t q = order[i];
+                        int64_t *single_indices = indices_ptr + q * knn;
+                        scalar_t *single_distances = distances_ptr + q * knn;
+                        size_t num_results = holder->index_->knnSearch(
+                                query_ptr + q * dimension,
                                 static_cast<size_t>(knn), single_indices,
                                 single_distances);
+                        std::fill(single_indices + num_results,
+                                  single_indices + knn, -1);
+                        std::fill(single_distances + num_results,
+                                  single_distances + knn, scalar_t(-1));
                     }
                 });
-        // Check if the number of neighbors are same.
-        Tensor check_valid =
-                batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
-        int64_t num_neighbors = check_valid[0].Item<int64_t>();
-        if (check_valid.Ne(num_neighbors).Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchKnn] The number of neighbors are "
-                    "different. Something went wrong.");
-        }
-        // Slice non-zero items.
-        indices = batch_indices.Slice(1, 0, num_neighbors)
-                          .View({num_query_points, num_neighbors});
-        distances = batch_distances.Slice(1, 0, num_neighbors)
-                            .View({num_query_points, num_neighbors});
     });
-    return std::make_pair(indices, distances);
 };
 
 std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
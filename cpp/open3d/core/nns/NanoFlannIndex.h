@@ -147,6 +147,25 @@ public:
     std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
                                         int knn) const override;
 
+    /// \brief Batched knn search into preallocated output tensors.
+    ///
+    /// Queries are searched in Z-order, so that consecutive searches of a
+    /// thread visit mostly the same tree nodes and points. The outputs are
+    /// reused if they already are contiguous CPU tensors of shape {n, knn}
+    /// with dtype Int64 and the dataset dtype, otherwise they are allocated.
+    /// Repeated searches, e.g. ICP iterations, thus do not allocate.
+    ///
+    /// \param query_points Query points with shape {n, d}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \param indices Output indices, -1 where the dataset has fewer than knn
+    /// points.
+    /// \param distances Output squared distances, -1 where the dataset has
+    /// fewer than knn points.
+    void SearchKnn(const Tensor &query_points,
+                   int knn,
+                   Tensor &indices,
+                   Tensor &distances) const;
+
     std::tuple<Tensor, Tensor, Tensor> SearchRadius(
             const Tensor &query_points, const Tensor &radii) const override;
 
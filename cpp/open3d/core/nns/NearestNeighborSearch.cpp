@@ -75,6 +75,15 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 #endif
 
     } else {
+        // The spatial hash only supports 3D points, other datasets and
+        // indices without radius use the KDTree.
+        if (radius.has_value() && dataset_points_.GetShape().size() == 2 &&
+            dataset_points_.GetShape()[1] == 3) {
+            fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+            return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                      radius.value());
+        }
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 }
@@ -109,6 +118,25 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
     }
 }
 
+void NearestNeighborSearch::KnnSearch(const Tensor& query_points,
+                                      int knn,
+                                      Tensor& indices,
+                                      Tensor& distances) {
+#ifdef WITH_FAISS
+    if (faiss_index_) {
+        std::tie(indices, distances) =
+                faiss_index_->SearchKnn(query_points, knn);
+        return;
+    }
+#endif
+    if (nanoflann_index_) {
+        nanoflann_index_->SearchKnn(query_points, knn, indices, distances);
+    } else {
+        utility::LogError(
+                "[NearestNeighborSearch::KnnSearch] Index is not set.");
+    }
+}
+
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius) {
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -120,7 +148,9 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
                     "set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(query_points, radius);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError(
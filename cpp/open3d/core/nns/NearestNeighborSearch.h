@@ -68,7 +68,9 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. If given for a CPU dataset of 3D points, a spatial hash index is
+    /// built instead of a KDTree and searches must not use a larger radius.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
@@ -85,6 +87,21 @@ public:
     /// - distainces: Tensor of shape {n, knn}, same dtype with query_points.
     std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points, int knn);
 
+    /// Perform knn search into preallocated output tensors, see
+    /// NanoFlannIndex::SearchKnn. The outputs are reused across calls when
+    /// their shape, dtype and device match, so that repeated searches on the
+    /// same dataset do not allocate.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \param indices Output Tensor of shape {n, knn}, with dtype Int64.
+    /// \param distances Output Tensor of shape {n, knn}, same dtype with
+    /// query_points.
+    void KnnSearch(const Tensor &query_points,
+                   int knn,
+                   Tensor &indices,
+                   Tensor &distances);
+
     /// Perform fixed radius search. All query points share the same radius.
     ///
     /// \param query_points Data points for querying. Must be 2D, with shape {n,
@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "open3d/Open3D.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
@@ -55,41 +58,31 @@ TSDFVoxelGrid::TSDFVoxelGrid(
                 "missing.");
     }
 
-    int64_t total_bytes = 0;
-    if (attr_dtype_map_.count("tsdf") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected TSDF dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for dispatching.");
-        }
-        total_bytes += dtype.ByteSize();
-    }
-
-    if (attr_dtype_map_.count("weight") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("weight");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected weight dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for "
-                    "dispatching.");
-        }
-        total_bytes += dtype.ByteSize();
-    }
-
+    // Voxel layouts implemented in kernel/TSDFVoxelGridShared.h, where they
+    // are dispatched by byte size. Users can add other layouts here for
+    // potential extensions.
+    using Layout = std::vector<core::Dtype>;  // tsdf, weight[, color]
+    static const std::vector<Layout> kLayouts = {
+            {core::Dtype::Float32, core::Dtype::Float32},
+            {core::Dtype::Float32, core::Dtype::UInt16, core::Dtype::UInt16},
+            {core::Dtype::Float32, core::Dtype::Float32, core::Dtype::Float32},
+            {core::Dtype::UInt16, core::Dtype::UInt16},
+            {core::Dtype::UInt8, core::Dtype::UInt8},
+            {core::Dtype::UInt16, core::Dtype::UInt8, core::Dtype::UInt8}};
+    Layout layout{attr_dtype_map_.at("tsdf"), attr_dtype_map_.at("weight")};
     if (attr_dtype_map_.count("color") != 0) {
-        core::Dtype dtype = attr_dtype_map_.at("color");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
-            utility::LogWarning(
-                    "[TSDFVoxelGrid] unexpected color dtype, please "
-                    "implement your own Voxel structure in "
-                    "core/kernel/GeneralEWSharedImpl.h for dispatching.");
-        }
-        total_bytes += dtype.ByteSize() * 3;
+        layout.push_back(attr_dtype_map_.at("color"));
+    }
+    if (std::find(kLayouts.begin(), kLayouts.end(), layout) ==
+        kLayouts.end()) {
+        utility::LogError(
+                "[TSDFVoxelGrid] unsupported voxel layout (tsdf: {}, weight: "
+                "{}, color: {}).",
+                layout[0].ToString(), layout[1].ToString(),
+                layout.size() > 2 ? layout[2].ToString() : "none");
     }
-    // Users can add other key/dtype checkers here for potential extensions.
+    int64_t total_bytes = layout[0].ByteSize() + layout[1].ByteSize() +
+                          (layout.size() > 2 ? layout[2].ByteSize() * 3 : 0);
 
     // SDF trunc check, critical for TSDF touch operation that allocates TSDF
     // volumes.
@@ -105,6 +98,7 @@ TSDFVoxelGrid::TSDFVoxelGrid(
             core::SizeVector{block_resolution_, block_resolution_,
                              block_resolution_, total_bytes},
             device);
+    block_table_ = std::make_shared<BlockTable>();
 }
 
 void TSDFVoxelGrid::Integrate(const Image &depth,
@@ -128,34 +122,12 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "[TSDFVoxelGrid] input depth is empty for integration.");
     }
 
-    // Create a point cloud from a low-resolution depth input to roughly
-    // estimate surfaces.
-    PointCloud pcd = PointCloud::CreateFromDepthImage(
-            depth, intrinsics, extrinsics, depth_scale, depth_max, 4);
-
-    core::Tensor block_coords;
-    kernel::tsdf::Touch(pcd.GetPoints().Contiguous(), block_coords,
-                        block_resolution_, voxel_size_, sdf_trunc_);
-
-    // Active voxel blocks in the block hashmap.
-    core::Tensor addrs, masks;
-    int64_t n = block_hashmap_->Size();
-    try {
-        block_hashmap_->Activate(block_coords, addrs, masks);
-    } catch (const std::runtime_error &) {
-        utility::LogError(
-                "[TSDFIntegrate] Unable to allocate volume during rehashing. "
-                "Consider using a "
-                "larger block_count at initialization to avoid rehashing "
-                "(currently {}), or choosing a larger voxel_size "
-                "(currently {})",
-                n, voxel_size_);
-    }
-
-    // Collect voxel blocks in the viewing frustum. Note we cannot directly
-    // reuse addrs from Activate, since some blocks might have been activated in
-    // previous launches and return false.
-    block_hashmap_->Find(block_coords, addrs, masks);
+    core::Tensor block_addrs =
+            incremental_ ? SelectIncrementalBlocks(depth, intrinsics,
+                                                   extrinsics, depth_scale,
+                                                   depth_max)
+                         : TouchBlocks(depth, intrinsics, extrinsics,
+                                       depth_scale, depth_max);
 
     core::Tensor depth_tensor = depth.AsTensor().Contiguous();
     core::Tensor color_tensor;
@@ -179,12 +151,352 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                 "shape.");
     }
 
+    MarkDirtyBlocks(block_addrs);
+
     core::Tensor dst = block_hashmap_->GetValueTensor();
-    kernel::tsdf::Integrate(depth_tensor, color_tensor,
-                            addrs.To(core::Dtype::Int64).IndexGet({masks}),
+    kernel::tsdf::Integrate(depth_tensor, color_tensor, block_addrs,
                             block_hashmap_->GetKeyTensor(), dst, intrinsics,
                             extrinsics, block_resolution_, voxel_size_,
                             sdf_trunc_, depth_scale, depth_max);
+
+    if (block_store_) {
+        StreamBlocks(extrinsics);
+    }
+}
+
+void TSDFVoxelGrid::SetIncrementalIntegration(bool enable,
+                                              int64_t history,
+                                              float max_translation,
+                                              float max_rotation) {
+    if (history < 1) {
+        utility::LogError("History must be at least 1 frame, but got {}.",
+                          history);
+    }
+    incremental_ = enable;
+    history_ = history;
+    max_translation_ = max_translation;
+    max_rotation_ = max_rotation;
+    recent_block_addrs_.clear();
+    touch_extrinsics_ = core::Tensor();
+    num_reused_frames_ = 0;
+}
+
+/// Concatenate tensors of the same dtype and element shape along the first
+/// dimension.
+static core::Tensor Concatenate(const std::vector<core::Tensor> &tensors,
+                                const core::Device &device) {
+    int64_t total = 0;
+    for (const core::Tensor &tensor : tensors) {
+        total += tensor.GetLength();
+    }
+    core::SizeVector shape = tensors[0].GetShape();
+    shape[0] = total;
+    core::Tensor dst(shape, tensors[0].GetDtype(), device);
+    int64_t offset = 0;
+    for (const core::Tensor &tensor : tensors) {
+        dst.Slice(0, offset, offset + tensor.GetLength()) = tensor;
+        offset += tensor.GetLength();
+    }
+    return dst;
+}
+
+core::Tensor TSDFVoxelGrid::TouchBlocks(const Image &depth,
+                                        const core::Tensor &intrinsics,
+                                        const core::Tensor &extrinsics,
+                                        float depth_scale,
+                                        float depth_max) {
+    // Create a point cloud from a low-resolution depth input to roughly
+    // estimate surfaces.
+    PointCloud pcd = PointCloud::CreateFromDepthImage(
+            depth, intrinsics, extrinsics, depth_scale, depth_max, 4);
+
+    core::Tensor block_coords;
+    kernel::tsdf::Touch(pcd.GetPoints().Contiguous(), block_coords,
+                        block_resolution_, voxel_size_, sdf_trunc_);
+    if (block_store_) {
+        PageInBlocks(block_coords);
+    }
+
+    // Most blocks are already allocated after the first frames, so look them
+    // up first and only activate the missing ones.
+    core::Tensor addrs, masks;
+    block_hashmap_->Find(block_coords, addrs, masks);
+    core::Tensor found_addrs = addrs.To(core::Dtype::Int64).IndexGet({masks});
+    core::Tensor missing_coords = block_coords.IndexGet({masks.LogicalNot()});
+    if (missing_coords.GetLength() == 0) {
+        return found_addrs;
+    }
+
+    int64_t n = block_hashmap_->Size();
+    int64_t capacity = block_hashmap_->GetCapacity();
+    try {
+        block_hashmap_->Activate(missing_coords, addrs, masks);
+    } catch (const std::runtime_error &) {
+        utility::LogError(
+                "[TSDFIntegrate] Unable to allocate volume during rehashing. "
+                "Consider using a "
+                "larger block_count at initialization to avoid rehashing "
+                "(currently {}), or choosing a larger voxel_size "
+                "(currently {})",
+                n, voxel_size_);
+    }
+    block_table_->valid = false;
+
+    // Rehashing moves the blocks in the buffer, so the found addresses are
+    // stale.
+    if (block_hashmap_->GetCapacity() != capacity) {
+        block_hashmap_->Find(block_coords, addrs, masks);
+        return addrs.To(core::Dtype::Int64).IndexGet({masks});
+    }
+    return Concatenate({found_addrs,
+                        addrs.To(core::Dtype::Int64).IndexGet({masks})},
+                       device_);
+}
+
+void TSDFVoxelGrid::EnableStreaming(const std::string &directory,
+                                    float radius,
+                                    int64_t cell_size) {
+    if (radius <= 0) {
+        utility::LogError("Streaming radius must be positive, but got {}.",
+                          radius);
+    }
+    if (block_store_) {
+        DisableStreaming();
+    }
+    block_store_ = std::make_shared<VoxelBlockStore>(directory, cell_size);
+    stream_radius_ = radius;
+}
+
+void TSDFVoxelGrid::DisableStreaming() {
+    if (!block_store_) {
+        return;
+    }
+    PageInCells(block_store_->GetCells());
+    block_store_.reset();
+}
+
+void TSDFVoxelGrid::PageInCells(const std::vector<Eigen::Vector3i> &cells) {
+    if (cells.empty()) {
+        return;
+    }
+    core::Device host("CPU:0");
+    std::vector<core::Tensor> keys, values;
+    auto InsertReadCells = [&]() {
+        if (keys.empty()) {
+            return;
+        }
+        // A stored cell has no resident blocks, so all the keys are new.
+        core::Tensor addrs, masks;
+        block_hashmap_->Insert(Concatenate(keys, host).To(device_),
+                               Concatenate(values, host).To(device_), addrs,
+                               masks);
+        block_table_->valid = false;
+        // Patches next to the paged in blocks were extracted without them.
+        MarkDirtyBlocks(addrs.To(core::Dtype::Int64).IndexGet({masks}));
+        recent_block_addrs_.clear();
+    };
+    try {
+        for (const Eigen::Vector3i &cell : cells) {
+            core::Tensor cell_keys, cell_values;
+            std::tie(cell_keys, cell_values) = block_store_->Read(cell);
+            keys.push_back(cell_keys);
+            values.push_back(cell_values);
+        }
+    } catch (const std::runtime_error &) {
+        // The cells read so far are no longer stored, the failed one still is.
+        InsertReadCells();
+        throw;
+    }
+    InsertReadCells();
+}
+
+void TSDFVoxelGrid::PageInBlocks(const core::Tensor &block_coords) {
+    std::vector<int> coords =
+            block_coords.To(core::Device("CPU:0")).ToFlatVector<int>();
+    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
+            cells;
+    for (size_t i = 0; i < coords.size(); i += 3) {
+        Eigen::Vector3i cell = block_store_->GetCell(coords[i], coords[i + 1],
+                                                     coords[i + 2]);
+        if (cells.count(cell) == 0 && block_store_->Contains(cell)) {
+            cells.insert(cell);
+        }
+    }
+    PageInCells({cells.begin(), cells.end()});
+}
+
+/// Camera center in the world of a world to camera transform.
+static Eigen::Vector3d CameraCenter(const core::Tensor &extrinsics) {
+    core::Tensor pose =
+            extrinsics.To(core::Device("CPU:0"), core::Dtype::Float64)
+                    .Contiguous();
+    using Matrix4d = Eigen::Matrix<double, 4, 4, Eigen::RowMajor>;
+    Eigen::Map<const Matrix4d> T(
+            static_cast<const double *>(pose.GetDataPtr()));
+    return -T.block<3, 3>(0, 0).transpose() * T.block<3, 1>(0, 3);
+}
+
+void TSDFVoxelGrid::StreamBlocks(const core::Tensor &extrinsics) {
+    Eigen::Vector3d center = CameraCenter(extrinsics);
+    int64_t cell_size = block_store_->GetCellSize();
+    double cell_extent = voxel_size_ * block_resolution_ * cell_size;
+    auto CellDistance = [&](const Eigen::Vector3i &cell) {
+        Eigen::Vector3d lo = cell.cast<double>() * cell_extent;
+        Eigen::Vector3d hi = lo + Eigen::Vector3d::Constant(cell_extent);
+        return (center.cwiseMax(lo).cwiseMin(hi) - center).norm();
+    };
+
+    // Group the resident blocks by cell, and evict whole cells beyond the
+    // radius plus one cell, so that a camera moving back and forth does not
+    // page the same cells in and out.
+    core::Device host("CPU:0");
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(core::Dtype::Int64);
+    std::vector<int> coords = block_hashmap_->GetKeyTensor()
+                                      .IndexGet({active_addrs})
+                                      .To(host)
+                                      .ToFlatVector<int>();
+    std::unordered_map<Eigen::Vector3i, std::vector<int64_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            resident_cells;
+    for (size_t i = 0; i < coords.size(); i += 3) {
+        resident_cells[block_store_->GetCell(coords[i], coords[i + 1],
+                                             coords[i + 2])]
+                .push_back(static_cast<int64_t>(i / 3));
+    }
+    std::vector<Eigen::Vector3i> evicted_cells;
+    std::vector<int64_t> evicted, evicted_splits{0};
+    for (const auto &it : resident_cells) {
+        if (CellDistance(it.first) > stream_radius_ + cell_extent) {
+            evicted_cells.push_back(it.first);
+            evicted.insert(evicted.end(), it.second.begin(), it.second.end());
+            evicted_splits.push_back(static_cast<int64_t>(evicted.size()));
+        }
+    }
+    if (!evicted.empty()) {
+        core::Tensor addrs = active_addrs.IndexGet(
+                {core::Tensor(evicted, {static_cast<int64_t>(evicted.size())},
+                              core::Dtype::Int64, device_)});
+        core::Tensor keys = block_hashmap_->GetKeyTensor().IndexGet({addrs});
+        core::Tensor values =
+                block_hashmap_->GetValueTensor().IndexGet({addrs});
+        core::Tensor keys_host = keys.To(host);
+        core::Tensor values_host = values.To(host);
+        for (size_t i = 0; i < evicted_cells.size(); ++i) {
+            block_store_->Write(
+                    evicted_cells[i],
+                    keys_host.Slice(0, evicted_splits[i],
+                                    evicted_splits[i + 1]),
+                    values_host.Slice(0, evicted_splits[i],
+                                      evicted_splits[i + 1]));
+        }
+        core::Tensor masks;
+        block_hashmap_->Erase(keys, masks);
+        block_table_->valid = false;
+        if (block_dirty_.NumElements() == block_hashmap_->GetCapacity()) {
+            block_dirty_.IndexSet(
+                    {addrs}, core::Tensor::Zeros({addrs.GetLength()},
+                                                 core::Dtype::Bool, device_));
+        }
+        recent_block_addrs_.clear();
+    }
+
+    // Page in the stored cells within the radius, and prefetch the ones that
+    // the camera is approaching.
+    std::vector<Eigen::Vector3i> paged_cells;
+    double reach = stream_radius_ + cell_extent;
+    Eigen::Vector3i lo = ((center.array() - reach) / cell_extent)
+                                 .floor()
+                                 .cast<int>();
+    Eigen::Vector3i hi = ((center.array() + reach) / cell_extent)
+                                 .floor()
+                                 .cast<int>();
+    for (int z = lo(2); z <= hi(2); ++z) {
+        for (int y = lo(1); y <= hi(1); ++y) {
+            for (int x = lo(0); x <= hi(0); ++x) {
+                Eigen::Vector3i cell(x, y, z);
+                if (!block_store_->Contains(cell)) {
+                    continue;
+                }
+                double distance = CellDistance(cell);
+                if (distance <= stream_radius_) {
+                    paged_cells.push_back(cell);
+                } else if (distance <= reach) {
+                    block_store_->Prefetch(cell);
+                }
+            }
+        }
+    }
+    PageInCells(paged_cells);
+}
+
+/// Whether two world to camera transforms are within the given translation
+/// of camera centers and rotation angle.
+static bool IsSmallMotion(const core::Tensor &extrinsics0,
+                          const core::Tensor &extrinsics1,
+                          float max_translation,
+                          float max_rotation) {
+    using Matrix4d = Eigen::Matrix<double, 4, 4, Eigen::RowMajor>;
+    Eigen::Map<const Matrix4d> T0(
+            static_cast<const double *>(extrinsics0.GetDataPtr()));
+    Eigen::Map<const Matrix4d> T1(
+            static_cast<const double *>(extrinsics1.GetDataPtr()));
+    Eigen::Matrix3d R0 = T0.block<3, 3>(0, 0), R1 = T1.block<3, 3>(0, 0);
+    Eigen::Vector3d c0 = -R0.transpose() * T0.block<3, 1>(0, 3);
+    Eigen::Vector3d c1 = -R1.transpose() * T1.block<3, 1>(0, 3);
+    double cos_angle = ((R0 * R1.transpose()).trace() - 1.0) / 2.0;
+    double angle = std::acos(std::max(-1.0, std::min(1.0, cos_angle)));
+    return (c1 - c0).norm() <= max_translation && angle <= max_rotation;
+}
+
+core::Tensor TSDFVoxelGrid::SelectIncrementalBlocks(
+        const Image &depth,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max) {
+    core::Tensor pose =
+            extrinsics.To(core::Device("CPU:0"), core::Dtype::Float64)
+                    .Contiguous();
+    bool reuse = !recent_block_addrs_.empty() &&
+                 num_reused_frames_ + 1 < history_ &&
+                 IsSmallMotion(touch_extrinsics_, pose, max_translation_,
+                               max_rotation_);
+    if (reuse) {
+        ++num_reused_frames_;
+    } else {
+        int64_t capacity = block_hashmap_->GetCapacity();
+        core::Tensor addrs = TouchBlocks(depth, intrinsics, extrinsics,
+                                         depth_scale, depth_max);
+        // Rehashing moves the blocks in the buffer.
+        if (block_hashmap_->GetCapacity() != capacity) {
+            recent_block_addrs_.clear();
+        }
+        recent_block_addrs_.push_back(addrs);
+        while (static_cast<int64_t>(recent_block_addrs_.size()) > history_) {
+            recent_block_addrs_.pop_front();
+        }
+        touch_extrinsics_ = pose;
+        num_reused_frames_ = 0;
+    }
+
+    // Union of the recently touched blocks.
+    core::Tensor candidates = recent_block_addrs_.back();
+    if (recent_block_addrs_.size() > 1) {
+        candidates = std::get<0>(
+                Concatenate({recent_block_addrs_.begin(),
+                             recent_block_addrs_.end()},
+                            device_)
+                        .Unique());
+    }
+
+    core::Tensor mask;
+    kernel::tsdf::CullBlocks(depth.AsTensor(), candidates,
+                             block_hashmap_->GetKeyTensor(), mask, intrinsics,
+                             extrinsics, block_resolution_, voxel_size_,
+                             sdf_trunc_, depth_scale, depth_max);
+    return candidates.IndexGet({mask});
 }
 
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints(float weight_threshold) {
@@ -246,6 +558,182 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(float weight_threshold) {
     return mesh;
 }
 
+TSDFVoxelGrid::MeshPatchMap TSDFVoxelGrid::ExtractSurfaceMeshPatches(
+        float weight_threshold) {
+    if (weight_threshold != patch_weight_threshold_) {
+        mesh_patches_.clear();
+        block_dirty_ = core::Tensor();
+        patch_weight_threshold_ = weight_threshold;
+    }
+    MarkDirtyBlocks(core::Tensor({0}, core::Dtype::Int64, device_));
+
+    MeshPatchMap patches;
+    core::Tensor dirty_addrs = block_dirty_.NonZero()[0];
+    if (dirty_addrs.GetLength() == 0) {
+        return patches;
+    }
+    block_dirty_.Fill(false);
+
+    // Cubes on the far faces of a block read the voxels of the next blocks,
+    // and normals the voxels around, so the patches of all the neighbors of
+    // the changed blocks are extracted again.
+    core::Tensor nb_addrs, nb_masks;
+    std::tie(nb_addrs, nb_masks) = BufferRadiusNeighbors(dirty_addrs);
+    core::Tensor addrs = std::get<0>(
+            nb_addrs.IndexGet({nb_masks}).To(core::Dtype::Int64).Unique());
+    std::tie(nb_addrs, nb_masks) = BufferRadiusNeighbors(addrs);
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors,
+            vertex_keys, vertex_offsets, triangle_offsets;
+    kernel::tsdf::ExtractSurfaceMeshPatches(
+            addrs, nb_addrs.To(core::Dtype::Int64), nb_masks,
+            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
+            vertices, triangles, vertex_normals, vertex_colors, vertex_keys,
+            vertex_offsets, triangle_offsets, block_resolution_, voxel_size_,
+            weight_threshold);
+
+    core::Device host("CPU:0");
+    std::vector<int> block_keys = block_hashmap_->GetKeyTensor()
+                                          .IndexGet({addrs})
+                                          .To(host)
+                                          .ToFlatVector<int>();
+    std::vector<int64_t> vtx_offsets =
+            vertex_offsets.To(host).ToFlatVector<int64_t>();
+    std::vector<int64_t> tri_offsets =
+            triangle_offsets.To(host).ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < addrs.GetLength(); ++i) {
+        Eigen::Vector3i block_key(block_keys[3 * i], block_keys[3 * i + 1],
+                                  block_keys[3 * i + 2]);
+        int64_t v0 = vtx_offsets[i], v1 = vtx_offsets[i + 1];
+        if (v0 == v1) {
+            if (mesh_patches_.erase(block_key) != 0) {
+                patches.emplace(block_key, TriangleMesh(device_));
+            }
+            continue;
+        }
+
+        // Copies, so that the cache does not hold the buffers of the whole
+        // extraction.
+        TriangleMesh mesh(
+                vertices.Slice(0, v0, v1).Clone(),
+                triangles.Slice(0, tri_offsets[i], tri_offsets[i + 1])
+                        .Clone());
+        mesh.SetVertexNormals(vertex_normals.Slice(0, v0, v1).Clone());
+        if (vertex_colors.NumElements() != 0) {
+            mesh.SetVertexColors(vertex_colors.Slice(0, v0, v1).Clone());
+        }
+        mesh_patches_[block_key] =
+                std::make_pair(mesh, vertex_keys.Slice(0, v0, v1).Clone());
+        patches.emplace(block_key, mesh);
+    }
+    return patches;
+}
+
+TriangleMesh TSDFVoxelGrid::StitchSurfaceMeshPatches() const {
+    if (mesh_patches_.empty()) {
+        return TriangleMesh(device_);
+    }
+
+    std::vector<core::Tensor> vertices, vertex_normals, vertex_colors,
+            vertex_keys, triangles;
+    int64_t num_vertices = 0;
+    for (const auto &it : mesh_patches_) {
+        const TriangleMesh &mesh = it.second.first;
+        vertices.push_back(mesh.GetVertices());
+        vertex_normals.push_back(mesh.GetVertexNormals());
+        if (mesh.HasVertexColors()) {
+            vertex_colors.push_back(mesh.GetVertexColors());
+        }
+        vertex_keys.push_back(it.second.second);
+        triangles.push_back(mesh.GetTriangles().Add(num_vertices));
+        num_vertices += mesh.GetVertices().GetLength();
+    }
+
+    // Merge the copies of the vertices on the same edge, which are equal.
+    core::Tensor unique_keys, inverse, counts;
+    std::tie(unique_keys, inverse, counts) =
+            Concatenate(vertex_keys, device_).Unique();
+    core::Tensor selected = core::Tensor::Zeros(
+            {unique_keys.GetLength()}, core::Dtype::Int64, device_);
+    selected.IndexMax_(0, inverse,
+                       core::Tensor::Arange(0, num_vertices, 1,
+                                            core::Dtype::Int64, device_));
+
+    core::Tensor corners = Concatenate(triangles, device_);
+    int64_t num_triangles = corners.GetLength();
+    corners = inverse.IndexGet({corners.View({num_triangles * 3})});
+    TriangleMesh mesh(Concatenate(vertices, device_).IndexGet({selected}),
+                      corners.View({num_triangles, 3}));
+    mesh.SetVertexNormals(
+            Concatenate(vertex_normals, device_).IndexGet({selected}));
+    if (!vertex_colors.empty()) {
+        mesh.SetVertexColors(
+                Concatenate(vertex_colors, device_).IndexGet({selected}));
+    }
+    return mesh;
+}
+
+std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
+                       const core::Tensor &extrinsics,
+                       int width,
+                       int height,
+                       float depth_scale,
+                       float depth_min,
+                       float depth_max,
+                       float weight_threshold,
+                       int ray_cast_mask) {
+    if (width <= 0 || height <= 0) {
+        utility::LogError("Invalid ray casting size {}x{}.", width, height);
+    }
+    if ((ray_cast_mask & SurfaceMaskCode::ColorMap) &&
+        attr_dtype_map_.count("color") == 0) {
+        utility::LogError("Color map requested on a grid without color.");
+    }
+
+    // Requested maps are zero initialized, the others stay empty and are
+    // skipped by the kernel.
+    std::unordered_map<SurfaceMaskCode, core::Tensor> results;
+    core::Tensor vertex_map, depth_map, color_map, normal_map;
+    auto Allocate = [&](SurfaceMaskCode code, int64_t channels,
+                        core::Tensor &map) {
+        if (ray_cast_mask & code) {
+            map = core::Tensor::Zeros({height, width, channels},
+                                      core::Dtype::Float32, device_);
+            results.emplace(code, map);
+        }
+    };
+    Allocate(SurfaceMaskCode::VertexMap, 3, vertex_map);
+    Allocate(SurfaceMaskCode::DepthMap, 1, depth_map);
+    Allocate(SurfaceMaskCode::ColorMap, 3, color_map);
+    Allocate(SurfaceMaskCode::NormalMap, 3, normal_map);
+    if (results.empty()) {
+        return results;
+    }
+
+    if (block_hashmap_->Size() == 0) {
+        return results;
+    }
+
+    if (!block_table_->valid) {
+        core::Tensor active_addrs;
+        block_hashmap_->GetActiveIndices(active_addrs);
+        kernel::tsdf::BuildBlockTable(active_addrs.To(core::Dtype::Int64),
+                                      block_hashmap_->GetKeyTensor(),
+                                      block_table_->keys, block_table_->indices,
+                                      block_table_->bounds);
+        block_table_->valid = true;
+    }
+    kernel::tsdf::RayCast(block_table_->keys, block_table_->indices,
+                          block_table_->bounds,
+                          block_hashmap_->GetValueTensor(), vertex_map,
+                          depth_map, color_map, normal_map, intrinsics,
+                          extrinsics, height, width, block_resolution_,
+                          voxel_size_, sdf_trunc_, depth_scale, depth_min,
+                          depth_max, weight_threshold);
+    return results;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -259,6 +747,23 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     return device_tsdf_voxelgrid;
 }
 
+void TSDFVoxelGrid::MarkDirtyBlocks(const core::Tensor &block_addrs) {
+    int64_t capacity = block_hashmap_->GetCapacity();
+    if (block_dirty_.NumElements() != capacity) {
+        block_dirty_ =
+                core::Tensor::Zeros({capacity}, core::Dtype::Bool, device_);
+        core::Tensor active_addrs;
+        block_hashmap_->GetActiveIndices(active_addrs);
+        MarkDirtyBlocks(active_addrs.To(core::Dtype::Int64));
+    }
+    int64_t n = block_addrs.GetLength();
+    if (n > 0) {
+        block_dirty_.IndexSet({block_addrs},
+                              core::Tensor::Ones({n}, core::Dtype::Bool,
+                                                 device_));
+    }
+}
+
 std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
         const core::Tensor &active_addrs) {
     // Fixed radius search for spatially hashed voxel blocks.
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <deque>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -39,6 +40,8 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockStore.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
@@ -56,7 +59,31 @@ namespace geometry {
 /// internal Tensor.
 class TSDFVoxelGrid {
 public:
+    /// Bit masks of the maps rendered by RayCast.
+    enum SurfaceMaskCode {
+        None = 0,
+        VertexMap = (1 << 0),
+        DepthMap = (1 << 1),
+        ColorMap = (1 << 2),
+        NormalMap = (1 << 3)
+    };
+
+    /// Mesh patches keyed by voxel block coordinate.
+    typedef std::unordered_map<Eigen::Vector3i,
+                               TriangleMesh,
+                               utility::hash_eigen<Eigen::Vector3i>>
+            MeshPatchMap;
+
     /// \brief Default Constructor.
+    /// Supported voxel layouts as tsdf, weight[, color] dtypes, in bytes:
+    /// - Float32, Float32: 8
+    /// - Float32, UInt16, UInt16: 12
+    /// - Float32, Float32, Float32: 20
+    /// - UInt16, UInt16: 4
+    /// - UInt8, UInt8: 2
+    /// - UInt16, UInt8, UInt8: 6
+    /// Integer TSDFs are quantized over [-1, 1], UInt8 weights saturate at
+    /// 255, and UInt8 colors hold the average of 8-bit color images.
     TSDFVoxelGrid(std::unordered_map<std::string, core::Dtype> attr_dtype_map =
                           {{"tsdf", core::Dtype::Float32},
                            {"weight", core::Dtype::UInt16},
@@ -84,6 +111,45 @@ public:
                    float depth_scale = 1000.0f,
                    float depth_max = 3.0f);
 
+    /// Enable or disable incremental integration, for a camera moving
+    /// smoothly through the scene. The blocks touched by the last \p history
+    /// frames are kept, and each frame integrates only those that overlap the
+    /// viewing frustum and are not entirely behind the truncation band of the
+    /// observed surface. When the camera moved less than \p max_translation
+    /// (in meter) and \p max_rotation (in radian) since the last frame that
+    /// touched blocks, the kept blocks are reused without unprojecting the
+    /// depth and querying the hashmap, for at most history - 1 frames in a
+    /// row. Surfaces that appear in front of a still camera are hence
+    /// allocated up to history - 1 frames late.
+    void SetIncrementalIntegration(bool enable,
+                                   int64_t history = 3,
+                                   float max_translation = 0.01f,
+                                   float max_rotation = 0.02f);
+
+    /// Stream the blocks through a disk store in \p directory, for scans that
+    /// do not fit in memory. After each integration, the blocks of the cells
+    /// of cell_size^3 blocks farther than \p radius (in meter) plus one cell
+    /// from the camera are evicted to the store, and the stored cells within
+    /// \p radius are paged back in. Cells just outside \p radius are
+    /// prefetched in the background, and the cells of the blocks touched by a
+    /// depth image are paged in before integration. Resident memory is hence
+    /// bounded by the blocks around the camera. \p radius should exceed the
+    /// depth_max of Integrate, otherwise blocks are paged in and out on every
+    /// frame. Extraction, ray casting and To() only see the resident blocks,
+    /// except for StitchSurfaceMeshPatches which keeps the patches of evicted
+    /// blocks.
+    void EnableStreaming(const std::string &directory,
+                         float radius,
+                         int64_t cell_size = 4);
+
+    /// Page all the stored blocks back in and stop streaming.
+    void DisableStreaming();
+
+    /// Number of blocks evicted to the disk store.
+    int64_t GetNumStoredBlocks() const {
+        return block_store_ ? block_store_->GetNumBlocks() : 0;
+    }
+
     /// Extract point cloud near iso-surfaces.
     /// Weight threshold is used to filter outliers. By default we use 3.0,
     /// where we assume a reliable surface point comes from the fusion of at
@@ -98,6 +164,53 @@ public:
     /// observations.
     TriangleMesh ExtractSurfaceMesh(float weight_threshold = 3.0f);
 
+    /// Extract the mesh patches of the blocks that may have changed since the
+    /// last call, for maps that are meshed repeatedly while they grow. A block
+    /// changes when it or one of its 26 neighbors is integrated into, so the
+    /// cost is proportional to the integrated area rather than to the map.
+    /// The patch of a block holds the Marching Cubes triangles of the cubes
+    /// starting in the block, with copies of the vertices it shares with the
+    /// next blocks. Blocks whose surface vanished are returned with an empty
+    /// mesh. All the blocks are extracted again when \p weight_threshold
+    /// differs from the last call, see ExtractSurfaceMesh.
+    MeshPatchMap ExtractSurfaceMeshPatches(float weight_threshold = 3.0f);
+
+    /// Stitch the patches extracted by ExtractSurfaceMeshPatches so far into
+    /// one mesh, merging the vertices shared by adjacent patches. The result
+    /// equals ExtractSurfaceMesh up to the order of vertices and triangles if
+    /// no integration happened after the last extraction.
+    TriangleMesh StitchSurfaceMeshPatches() const;
+
+    /// Render the surface seen from a camera by marching a ray per pixel
+    /// through the voxel blocks. Steps are bounded by the TSDF, unallocated
+    /// blocks are crossed in one step, and zero crossings are refined by
+    /// trilinear interpolation. The table the rays look the blocks up in is
+    /// kept until blocks are added or removed, so that rendering several views
+    /// between integrations builds it once.
+    /// \param intrinsics 3x3 pinhole camera matrix.
+    /// \param extrinsics 4x4 world to camera transform.
+    /// \param width, height Size of the rendered maps.
+    /// \param depth_scale Scale of the rendered depth, e.g. 1000 for mm.
+    /// \param depth_min, depth_max Range of the camera depth of the rays.
+    /// \param weight_threshold Voxels with no larger weight are treated as
+    /// unobserved, as in ExtractSurfacePoints.
+    /// \param ray_cast_mask Bitwise or of SurfaceMaskCode for the maps to
+    /// render.
+    /// \return Float32 maps of shape (height, width, channels) keyed by
+    /// SurfaceMaskCode: vertex (3) and normal (3) in the camera frame, depth
+    /// (1) and color (3, in [0, 1]). Pixels that miss the surface are 0.
+    std::unordered_map<SurfaceMaskCode, core::Tensor> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f,
+            int ray_cast_mask = SurfaceMaskCode::DepthMap |
+                                SurfaceMaskCode::NormalMap);
+
     /// Convert TSDFVoxelGrid to the target device.
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new TSDFVoxelGrid is always created; if false,
@@ -132,6 +245,38 @@ protected:
     std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
             const core::Tensor &active_addrs);
 
+    /// Activate the blocks around the surface of a depth image in the
+    /// hashmap, and return their Int64 addresses.
+    core::Tensor TouchBlocks(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             float depth_scale,
+                             float depth_max);
+
+    /// Flag the blocks at Int64 \p block_addrs as changed for
+    /// ExtractSurfaceMeshPatches. Rehashing moves the blocks in the hashmap,
+    /// after which all the active blocks are flagged.
+    void MarkDirtyBlocks(const core::Tensor &block_addrs);
+
+    /// Insert the blocks of stored \p cells into the hashmap.
+    void PageInCells(const std::vector<Eigen::Vector3i> &cells);
+
+    /// Page in the stored cells of the Int32 block coordinates \p block_coords
+    /// of shape (N, 3).
+    void PageInBlocks(const core::Tensor &block_coords);
+
+    /// Evict the cells far from the camera of \p extrinsics, page in and
+    /// prefetch the cells around it, see EnableStreaming().
+    void StreamBlocks(const core::Tensor &extrinsics);
+
+    /// Return the Int64 addresses of the blocks to integrate a depth image
+    /// into in the incremental mode, see SetIncrementalIntegration().
+    core::Tensor SelectIncrementalBlocks(const Image &depth,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max);
+
     float voxel_size_;
     float sdf_trunc_;
 
@@ -142,7 +287,45 @@ protected:
 
     std::shared_ptr<core::Hashmap> block_hashmap_;
 
+    /// Lookup table of the active blocks for RayCast, see
+    /// kernel::tsdf::BuildBlockTable(). Shared by the copies that share the
+    /// hashmap, and invalidated whenever blocks are activated, inserted or
+    /// erased, which may also move the other blocks.
+    struct BlockTable {
+        bool valid = false;
+        core::Tensor keys;
+        core::Tensor indices;
+        core::Tensor bounds;
+    };
+    std::shared_ptr<BlockTable> block_table_;
+
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
+
+    // Incremental integration, see SetIncrementalIntegration().
+    bool incremental_ = false;
+    int64_t history_ = 3;
+    float max_translation_ = 0.01f;
+    float max_rotation_ = 0.02f;
+    /// Addresses of the blocks touched by the recent frames, oldest first.
+    std::deque<core::Tensor> recent_block_addrs_;
+    /// Float64 extrinsics on host of the last frame that touched blocks.
+    core::Tensor touch_extrinsics_;
+    int64_t num_reused_frames_ = 0;
+
+    // Incremental mesh extraction, see ExtractSurfaceMeshPatches().
+    /// Bool flags of the changed blocks, indexed by hashmap address.
+    core::Tensor block_dirty_;
+    float patch_weight_threshold_ = 0.0f;
+    /// Extracted patches with the Int64 keys of the edges of their vertices,
+    /// that identify the vertices shared by adjacent patches.
+    std::unordered_map<Eigen::Vector3i,
+                       std::pair<TriangleMesh, core::Tensor>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            mesh_patches_;
+
+    // Streaming, see EnableStreaming().
+    std::shared_ptr<VoxelBlockStore> block_store_;
+    float stream_radius_ = 0.0f;
 };
 }  // namespace geometry
 }  // namespace t
@@ -0,0 +1,263 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/VoxelBlockStore.h"
+
+#include "open3d/utility/Console.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+VoxelBlockStore::VoxelBlockStore(const std::string &directory,
+                                 int64_t cell_size)
+    : directory_(directory), cell_size_(cell_size) {
+    if (cell_size_ < 1) {
+        utility::LogError("Cell size must be positive, but got {}.",
+                          cell_size_);
+    }
+    if (!utility::filesystem::DirectoryExists(directory_) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory_)) {
+        utility::LogError("Unable to create block store directory {}.",
+                          directory_);
+    }
+    io_thread_ = std::thread(&VoxelBlockStore::IOLoop, this);
+}
+
+VoxelBlockStore::~VoxelBlockStore() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_cv_.notify_all();
+    io_thread_.join();
+}
+
+Eigen::Vector3i VoxelBlockStore::GetCell(int x, int y, int z) const {
+    int size = static_cast<int>(cell_size_);
+    auto FloorDiv = [size](int v) {
+        return v >= 0 ? v / size : -((-v + size - 1) / size);
+    };
+    return Eigen::Vector3i(FloorDiv(x), FloorDiv(y), FloorDiv(z));
+}
+
+void VoxelBlockStore::Write(const Eigen::Vector3i &cell,
+                            const core::Tensor &keys,
+                            const core::Tensor &values) {
+    int64_t version;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cells_.count(cell) != 0) {
+            utility::LogError("Cell ({}, {}, {}) is already stored.", cell(0),
+                              cell(1), cell(2));
+        }
+        version = next_version_++;
+        cells_[cell] = Cell{CellState::Writing, version, keys.GetLength(),
+                            keys, values};
+    }
+    Enqueue([this, cell, version, keys, values]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = cells_.find(cell);
+            if (it == cells_.end() || it->second.version != version) {
+                return;
+            }
+        }
+        try {
+            core::Tensor::SaveNpz(GetFileName(cell),
+                                  {{"keys", keys}, {"values", values}});
+        } catch (const std::runtime_error &e) {
+            // Keep the blocks in memory.
+            utility::LogWarning("Unable to write cell ({}, {}, {}): {}",
+                                cell(0), cell(1), cell(2), e.what());
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cells_.find(cell);
+        if (it != cells_.end() && it->second.version == version) {
+            it->second.state = CellState::OnDisk;
+            it->second.keys = core::Tensor();
+            it->second.values = core::Tensor();
+        }
+    });
+}
+
+bool VoxelBlockStore::Contains(const Eigen::Vector3i &cell) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cells_.count(cell) != 0;
+}
+
+void VoxelBlockStore::Prefetch(const Eigen::Vector3i &cell) {
+    int64_t version;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cells_.find(cell);
+        if (it == cells_.end() || it->second.state != CellState::OnDisk) {
+            return;
+        }
+        version = next_version_++;
+        it->second.state = CellState::Prefetching;
+        it->second.version = version;
+    }
+    Enqueue([this, cell, version]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = cells_.find(cell);
+            if (it == cells_.end() || it->second.version != version) {
+                return;
+            }
+        }
+        std::unordered_map<std::string, core::Tensor> arrays;
+        try {
+            arrays = core::Tensor::LoadNpz(GetFileName(cell));
+        } catch (const std::runtime_error &) {
+            arrays.clear();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cells_.find(cell);
+        if (it == cells_.end() || it->second.version != version) {
+            return;
+        }
+        if (arrays.count("keys") == 0 || arrays.count("values") == 0) {
+            // Read() reports the error.
+            it->second.state = CellState::OnDisk;
+            return;
+        }
+        it->second.state = CellState::Prefetched;
+        it->second.keys = arrays.at("keys");
+        it->second.values = arrays.at("values");
+    });
+}
+
+std::pair<core::Tensor, core::Tensor> VoxelBlockStore::Read(
+        const Eigen::Vector3i &cell) {
+    Cell entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cells_.find(cell);
+        if (it == cells_.end()) {
+            utility::LogError("Cell ({}, {}, {}) is not stored.", cell(0),
+                              cell(1), cell(2));
+        }
+        entry = it->second;
+    }
+
+    // The cell stays stored until its blocks are read, so that a failed read
+    // loses none of them.
+    std::string file_name = GetFileName(cell);
+    if (entry.state == CellState::OnDisk ||
+        entry.state == CellState::Prefetching) {
+        std::unordered_map<std::string, core::Tensor> arrays =
+                core::Tensor::LoadNpz(file_name);
+        if (arrays.count("keys") == 0 || arrays.count("values") == 0) {
+            utility::LogError("{} is not a voxel block cell.", file_name);
+        }
+        entry.keys = arrays.at("keys");
+        entry.values = arrays.at("values");
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cells_.erase(cell);
+    }
+
+    // Queued after a write in flight, if any.
+    Enqueue([file_name]() {
+        if (utility::filesystem::FileExists(file_name)) {
+            utility::filesystem::RemoveFile(file_name);
+        }
+    });
+    return std::make_pair(entry.keys, entry.values);
+}
+
+std::vector<Eigen::Vector3i> VoxelBlockStore::GetCells() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Eigen::Vector3i> cells;
+    cells.reserve(cells_.size());
+    for (const auto &it : cells_) {
+        cells.push_back(it.first);
+    }
+    return cells;
+}
+
+int64_t VoxelBlockStore::GetNumBlocks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t num_blocks = 0;
+    for (const auto &it : cells_) {
+        num_blocks += it.second.num_blocks;
+    }
+    return num_blocks;
+}
+
+void VoxelBlockStore::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this]() { return tasks_.empty() && !busy_; });
+}
+
+std::string VoxelBlockStore::GetFileName(const Eigen::Vector3i &cell) const {
+    return fmt::format("{}/cell_{}_{}_{}.npz", directory_, cell(0), cell(1),
+                       cell(2));
+}
+
+void VoxelBlockStore::Enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    task_cv_.notify_one();
+}
+
+void VoxelBlockStore::IOLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            // Pending tasks are drained before stopping.
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            busy_ = true;
+        }
+        try {
+            task();
+        } catch (const std::exception &e) {
+            utility::LogWarning("[VoxelBlockStore] I/O failed: {}", e.what());
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+        }
+        idle_cv_.notify_all();
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelBlockStore
+/// \brief Disk store of the voxel blocks evicted from a TSDFVoxelGrid.
+///
+/// Blocks are grouped into cells of cell_size^3 blocks, each cell holding the
+/// keys and values of its blocks in one npz file in the store directory.
+/// Writes and prefetched reads run on a background I/O thread, so evicting
+/// and paging blocks does not wait for the disk unless a cell is read before
+/// its prefetch completed. All keys and values are host tensors.
+class VoxelBlockStore {
+public:
+    /// \param directory Directory of the cell files, created if missing.
+    /// \param cell_size Number of blocks along each axis of a cell.
+    VoxelBlockStore(const std::string &directory, int64_t cell_size);
+
+    VoxelBlockStore(const VoxelBlockStore &) = delete;
+    VoxelBlockStore &operator=(const VoxelBlockStore &) = delete;
+
+    /// Waits for the pending writes and stops the I/O thread. The cell files
+    /// are kept.
+    ~VoxelBlockStore();
+
+    /// Cell of a block coordinate.
+    Eigen::Vector3i GetCell(int x, int y, int z) const;
+
+    int64_t GetCellSize() const { return cell_size_; }
+
+    /// Queue writing the Int32 \p keys of shape (N, 3) and the \p values of
+    /// the blocks of \p cell. The cell must not be stored already.
+    void Write(const Eigen::Vector3i &cell,
+               const core::Tensor &keys,
+               const core::Tensor &values);
+
+    /// Whether the blocks of \p cell are in the store.
+    bool Contains(const Eigen::Vector3i &cell) const;
+
+    /// Queue reading \p cell in the background, if stored and not in memory.
+    void Prefetch(const Eigen::Vector3i &cell);
+
+    /// Remove \p cell from the store and return its keys and values, reading
+    /// the file unless it is still being written or was prefetched. If the
+    /// file cannot be read, the cell is kept and an exception is thrown.
+    std::pair<core::Tensor, core::Tensor> Read(const Eigen::Vector3i &cell);
+
+    /// Stored cells.
+    std::vector<Eigen::Vector3i> GetCells() const;
+
+    /// Number of stored blocks.
+    int64_t GetNumBlocks() const;
+
+    /// Wait until the queued I/O is done.
+    void Flush();
+
+private:
+    enum class CellState { Writing, OnDisk, Prefetching, Prefetched };
+
+    struct Cell {
+        CellState state;
+        /// Incremented on every change of the state, so that outdated I/O
+        /// results are dropped.
+        int64_t version;
+        int64_t num_blocks;
+        /// Keys and values while being written or once prefetched.
+        core::Tensor keys;
+        core::Tensor values;
+    };
+
+    std::string GetFileName(const Eigen::Vector3i &cell) const;
+
+    /// Queue \p task on the I/O thread.
+    void Enqueue(std::function<void()> task);
+
+    void IOLoop();
+
+    std::string directory_;
+    int64_t cell_size_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable idle_cv_;
+    std::unordered_map<Eigen::Vector3i,
+                       Cell,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            cells_;
+    int64_t next_version_ = 0;
+    std::deque<std::function<void()>> tasks_;
+    bool busy_ = false;
+    bool stop_ = false;
+    std::thread io_thread_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -74,7 +74,8 @@ void Integrate(const core::Tensor& depth,
                float depth_max) {
     core::Device device = depth.GetDevice();
 
-    if (color.GetDevice() != device) {
+    // Color is empty for depth-only integration.
+    if (color.NumElements() != 0 && color.GetDevice() != device) {
         utility::LogError("Incompatible color device type for depth and color");
     }
     if (block_indices.GetDevice() != device ||
@@ -85,7 +86,8 @@ void Integrate(const core::Tensor& depth,
     }
 
     core::Tensor depthf32 = depth.To(core::Dtype::Float32);
-    core::Tensor colorf32 = color.To(core::Dtype::Float32);
+    core::Tensor colorf32 =
+            color.NumElements() != 0 ? color.To(core::Dtype::Float32) : color;
     core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
     core::Tensor extrinsicsf32 = extrinsics.To(device, core::Dtype::Float32);
 
@@ -176,6 +178,158 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
         utility::LogError("Unimplemented device");
     }
 }
+
+void ExtractSurfaceMeshPatches(const core::Tensor& block_indices,
+                               const core::Tensor& nb_block_indices,
+                               const core::Tensor& nb_block_masks,
+                               const core::Tensor& block_keys,
+                               const core::Tensor& block_values,
+                               core::Tensor& vertices,
+                               core::Tensor& triangles,
+                               core::Tensor& vertex_normals,
+                               core::Tensor& vertex_colors,
+                               core::Tensor& vertex_keys,
+                               core::Tensor& vertex_offsets,
+                               core::Tensor& triangle_offsets,
+                               int64_t block_resolution,
+                               float voxel_size,
+                               float weight_threshold) {
+    core::Device device = block_keys.GetDevice();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ExtractSurfaceMeshPatchesCPU(
+                block_indices, nb_block_indices, nb_block_masks, block_keys,
+                block_values, vertices, triangles, vertex_normals,
+                vertex_colors, vertex_keys, vertex_offsets, triangle_offsets,
+                block_resolution, voxel_size, weight_threshold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ExtractSurfaceMeshPatchesCUDA(
+                block_indices, nb_block_indices, nb_block_masks, block_keys,
+                block_values, vertices, triangles, vertex_normals,
+                vertex_colors, vertex_keys, vertex_offsets, triangle_offsets,
+                block_resolution, voxel_size, weight_threshold);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CullBlocks(const core::Tensor& depth,
+                const core::Tensor& block_indices,
+                const core::Tensor& block_keys,
+                core::Tensor& mask,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_max) {
+    core::Device device = block_keys.GetDevice();
+    if (depth.GetDevice() != device || block_indices.GetDevice() != device) {
+        utility::LogError(
+                "Incompatible device type for depth and TSDF voxel grid");
+    }
+
+    core::Tensor depthf32 = depth.To(core::Dtype::Float32).Contiguous();
+    core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
+    core::Tensor extrinsicsf32 = extrinsics.To(device, core::Dtype::Float32);
+    mask = core::Tensor({block_indices.GetLength()}, core::Dtype::Bool, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CullBlocksCPU(depthf32, block_indices, block_keys, mask, intrinsicsf32,
+                      extrinsicsf32, resolution, voxel_size, sdf_trunc,
+                      depth_scale, depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CullBlocksCUDA(depthf32, block_indices, block_keys, mask,
+                       intrinsicsf32, extrinsicsf32, resolution, voxel_size,
+                       sdf_trunc, depth_scale, depth_max);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void BuildBlockTable(const core::Tensor& block_indices,
+                     const core::Tensor& block_keys,
+                     core::Tensor& table_keys,
+                     core::Tensor& table_indices,
+                     core::Tensor& block_bounds) {
+    core::Device device = block_keys.GetDevice();
+    if (block_indices.GetDevice() != device) {
+        utility::LogError(
+                "Incompatible device type for block indices and keys");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        BuildBlockTableCPU(block_indices, block_keys, table_keys, table_indices,
+                           block_bounds);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BuildBlockTableCUDA(block_indices, block_keys, table_keys,
+                            table_indices, block_bounds);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RayCast(const core::Tensor& table_keys,
+             const core::Tensor& table_indices,
+             const core::Tensor& block_bounds,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& color_map,
+             core::Tensor& normal_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold) {
+    core::Device device = block_values.GetDevice();
+
+    core::Tensor intrinsicsf32 = intrinsics.To(device, core::Dtype::Float32);
+    core::Tensor extrinsicsf32 = extrinsics.To(device, core::Dtype::Float32);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RayCastCPU(table_keys, table_indices, block_bounds, block_values,
+                   vertex_map, depth_map, color_map, normal_map, intrinsicsf32,
+                   extrinsicsf32, h, w, block_resolution, voxel_size,
+                   sdf_trunc, depth_scale, depth_min, depth_max,
+                   weight_threshold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RayCastCUDA(table_keys, table_indices, block_bounds, block_values,
+                    vertex_map, depth_map, color_map, normal_map,
+                    intrinsicsf32, extrinsicsf32, h, w, block_resolution,
+                    voxel_size, sdf_trunc, depth_scale, depth_min, depth_max,
+                    weight_threshold);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
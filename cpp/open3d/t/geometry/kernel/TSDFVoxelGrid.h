@@ -80,6 +80,74 @@ void ExtractSurfaceMesh(const core::Tensor& block_indices,
                         float voxel_size,
                         float weight_threshold);
 
+/// Marching cubes on each of \p block_indices separately. The vertices and
+/// triangles of the i-th block are the rows [offsets[i], offsets[i + 1]) of
+/// the outputs, with the triangles indexing the vertices of the block. The
+/// vertices on block boundaries are duplicated in the adjacent blocks, with
+/// equal Int64 \p vertex_keys identifying the voxel edge they lie on.
+void ExtractSurfaceMeshPatches(const core::Tensor& block_indices,
+                               const core::Tensor& nb_block_indices,
+                               const core::Tensor& nb_block_masks,
+                               const core::Tensor& block_keys,
+                               const core::Tensor& block_values,
+                               core::Tensor& vertices,
+                               core::Tensor& triangles,
+                               core::Tensor& vertex_normals,
+                               core::Tensor& vertex_colors,
+                               core::Tensor& vertex_keys,
+                               core::Tensor& vertex_offsets,
+                               core::Tensor& triangle_offsets,
+                               int64_t block_resolution,
+                               float voxel_size,
+                               float weight_threshold);
+
+/// Writes to the Bool \p mask whether each block of \p block_indices may be
+/// updated by integrating \p depth, i.e. overlaps the viewing frustum and
+/// is not entirely beyond the truncation band behind the observed surface.
+/// Blocks that fail the test are left unchanged by Integrate.
+void CullBlocks(const core::Tensor& depth,
+                const core::Tensor& block_indices,
+                const core::Tensor& block_keys,
+                core::Tensor& mask,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_max);
+
+/// Build the linear probing table from the coordinates of the blocks of
+/// \p block_indices to their indices in the voxel block buffer, that RayCast
+/// looks the blocks up in. Also returns the Int32 bounding box of the block
+/// coordinates on host, with the minimum and maximum as rows of shape (2, 3).
+void BuildBlockTable(const core::Tensor& block_indices,
+                     const core::Tensor& block_keys,
+                     core::Tensor& table_keys,
+                     core::Tensor& table_indices,
+                     core::Tensor& block_bounds);
+
+/// Ray casts the blocks of the table built by BuildBlockTable.
+void RayCast(const core::Tensor& table_keys,
+             const core::Tensor& table_indices,
+             const core::Tensor& block_bounds,
+             const core::Tensor& block_values,
+             core::Tensor& vertex_map,
+             core::Tensor& depth_map,
+             core::Tensor& color_map,
+             core::Tensor& normal_map,
+             const core::Tensor& intrinsics,
+             const core::Tensor& extrinsics,
+             int64_t h,
+             int64_t w,
+             int64_t block_resolution,
+             float voxel_size,
+             float sdf_trunc,
+             float depth_scale,
+             float depth_min,
+             float depth_max,
+             float weight_threshold);
+
 void TouchCPU(const core::Tensor& points,
               core::Tensor& voxel_block_coords,
               int64_t voxel_grid_resolution,
@@ -125,6 +193,60 @@ void ExtractSurfaceMeshCPU(const core::Tensor& block_indices,
                            float voxel_size,
                            float weight_threshold);
 
+void ExtractSurfaceMeshPatchesCPU(const core::Tensor& block_indices,
+                                  const core::Tensor& nb_block_indices,
+                                  const core::Tensor& nb_block_masks,
+                                  const core::Tensor& block_keys,
+                                  const core::Tensor& block_values,
+                                  core::Tensor& vertices,
+                                  core::Tensor& triangles,
+                                  core::Tensor& vertex_normals,
+                                  core::Tensor& vertex_colors,
+                                  core::Tensor& vertex_keys,
+                                  core::Tensor& vertex_offsets,
+                                  core::Tensor& triangle_offsets,
+                                  int64_t block_resolution,
+                                  float voxel_size,
+                                  float weight_threshold);
+
+void CullBlocksCPU(const core::Tensor& depth,
+                   const core::Tensor& block_indices,
+                   const core::Tensor& block_keys,
+                   core::Tensor& mask,
+                   const core::Tensor& intrinsics,
+                   const core::Tensor& extrinsics,
+                   int64_t resolution,
+                   float voxel_size,
+                   float sdf_trunc,
+                   float depth_scale,
+                   float depth_max);
+
+void BuildBlockTableCPU(const core::Tensor& block_indices,
+                        const core::Tensor& block_keys,
+                        core::Tensor& table_keys,
+                        core::Tensor& table_indices,
+                        core::Tensor& block_bounds);
+
+void RayCastCPU(const core::Tensor& table_keys,
+                const core::Tensor& table_indices,
+                const core::Tensor& block_bounds,
+                const core::Tensor& block_values,
+                core::Tensor& vertex_map,
+                core::Tensor& depth_map,
+                core::Tensor& color_map,
+                core::Tensor& normal_map,
+                const core::Tensor& intrinsics,
+                const core::Tensor& extrinsics,
+                int64_t h,
+                int64_t w,
+                int64_t block_resolution,
+                float voxel_size,
+                float sdf_trunc,
+                float depth_scale,
+                float depth_min,
+                float depth_max,
+                float weight_threshold);
+
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(const core::Tensor& points,
                core::Tensor& voxel_block_coords,
@@ -171,6 +293,60 @@ void ExtractSurfaceMeshCUDA(const core::Tensor& block_indices,
                             float voxel_size,
                             float weight_threshold);
 
+void ExtractSurfaceMeshPatchesCUDA(const core::Tensor& block_indices,
+                                   const core::Tensor& nb_block_indices,
+                                   const core::Tensor& nb_block_masks,
+                                   const core::Tensor& block_keys,
+                                   const core::Tensor& block_values,
+                                   core::Tensor& vertices,
+                                   core::Tensor& triangles,
+                                   core::Tensor& vertex_normals,
+                                   core::Tensor& vertex_colors,
+                                   core::Tensor& vertex_keys,
+                                   core::Tensor& vertex_offsets,
+                                   core::Tensor& triangle_offsets,
+                                   int64_t block_resolution,
+                                   float voxel_size,
+                                   float weight_threshold);
+
+void CullBlocksCUDA(const core::Tensor& depth,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    core::Tensor& mask,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    int64_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max);
+
+void BuildBlockTableCUDA(const core::Tensor& block_indices,
+                         const core::Tensor& block_keys,
+                         core::Tensor& table_keys,
+                         core::Tensor& table_indices,
+                         core::Tensor& block_bounds);
+
+void RayCastCUDA(const core::Tensor& table_keys,
+                 const core::Tensor& table_indices,
+                 const core::Tensor& block_bounds,
+                 const core::Tensor& block_values,
+                 core::Tensor& vertex_map,
+                 core::Tensor& depth_map,
+                 core::Tensor& color_map,
+                 core::Tensor& normal_map,
+                 const core::Tensor& intrinsics,
+                 const core::Tensor& extrinsics,
+                 int64_t h,
+                 int64_t w,
+                 int64_t block_resolution,
+                 float voxel_size,
+                 float sdf_trunc,
+                 float depth_scale,
+                 float depth_min,
+                 float depth_max,
+                 float weight_threshold);
+
 #endif
 }  // namespace tsdf
 }  // namespace kernel
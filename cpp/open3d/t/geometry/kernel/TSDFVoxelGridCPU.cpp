@@ -26,6 +26,7 @@
 
 #include <tbb/concurrent_unordered_set.h>
 
+#include "open3d/core/CPUExecutor.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -78,30 +79,39 @@ void TouchCPU(const core::Tensor& points,
     const float* pcd_ptr = static_cast<const float*>(points.GetDataPtr());
 
     tbb::concurrent_unordered_set<Coord3i, Coord3iHash> set;
-    core::kernel::CPULauncher::LaunchGeneralKernel(
-            n, [&](int64_t workload_idx) {
-                float x = pcd_ptr[3 * workload_idx + 0];
-                float y = pcd_ptr[3 * workload_idx + 1];
-                float z = pcd_ptr[3 * workload_idx + 2];
-
-                int xb_lo = static_cast<int>(
-                        std::floor((x - sdf_trunc) / block_size));
-                int xb_hi = static_cast<int>(
-                        std::floor((x + sdf_trunc) / block_size));
-                int yb_lo = static_cast<int>(
-                        std::floor((y - sdf_trunc) / block_size));
-                int yb_hi = static_cast<int>(
-                        std::floor((y + sdf_trunc) / block_size));
-                int zb_lo = static_cast<int>(
-                        std::floor((z - sdf_trunc) / block_size));
-                int zb_hi = static_cast<int>(
-                        std::floor((z + sdf_trunc) / block_size));
-                for (int xb = xb_lo; xb <= xb_hi; ++xb) {
-                    for (int yb = yb_lo; yb <= yb_hi; ++yb) {
-                        for (int zb = zb_lo; zb <= zb_hi; ++zb) {
-                            set.emplace(xb, yb, zb);
+    core::ParallelFor(
+            n, core::kernel::CPULauncher::kDefaultGrainSize,
+            [&](int64_t start, int64_t end) {
+                // Consecutive points of a depth image mostly touch the same
+                // blocks, which are inserted only once.
+                int last_lo[3] = {0, 0, 0};
+                int last_hi[3] = {-1, -1, -1};
+                for (int64_t workload_idx = start; workload_idx < end;
+                     ++workload_idx) {
+                    int lo[3], hi[3];
+                    for (int i = 0; i < 3; ++i) {
+                        float p = pcd_ptr[3 * workload_idx + i];
+                        lo[i] = static_cast<int>(
+                                std::floor((p - sdf_trunc) / block_size));
+                        hi[i] = static_cast<int>(
+                                std::floor((p + sdf_trunc) / block_size));
+                    }
+                    if (lo[0] == last_lo[0] && lo[1] == last_lo[1] &&
+                        lo[2] == last_lo[2] && hi[0] == last_hi[0] &&
+                        hi[1] == last_hi[1] && hi[2] == last_hi[2]) {
+                        continue;
+                    }
+                    for (int xb = lo[0]; xb <= hi[0]; ++xb) {
+                        for (int yb = lo[1]; yb <= hi[1]; ++yb) {
+                            for (int zb = lo[2]; zb <= hi[2]; ++zb) {
+                                set.emplace(xb, yb, zb);
+                            }
                         }
                     }
+                    for (int i = 0; i < 3; ++i) {
+                        last_lo[i] = lo[i];
+                        last_hi[i] = hi[i];
+                    }
                 }
             });
 
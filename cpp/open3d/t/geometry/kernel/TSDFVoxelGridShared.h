@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -47,6 +49,15 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel8i)) {     \
+            using voxel_t = ColoredVoxel8i;                  \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16i)) {           \
+            using voxel_t = Voxel16i;                        \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel8i)) {            \
+            using voxel_t = Voxel8i;                         \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -174,6 +185,144 @@ struct ColoredVoxel32f {
     }
 };
 
+/// 6-byte voxel structure.
+/// TSDF quantized to uint16_t, uint8_t weight saturated at 255, and uint8_t
+/// colors averaged in the range of the uint8_t input color. Half the size of
+/// ColoredVoxel16i at the cost of rounding the color average, and of a
+/// running average once the weight saturates.
+struct ColoredVoxel8i {
+    static const uint8_t kMaxUint8 = 255;
+    /// TSDF in [-1, 1] is stored as tsdf * kTSDFFactor + kTSDFFactor.
+    static constexpr float kTSDFFactor = 32767.0f;
+
+    uint16_t tsdf;
+    uint8_t weight;
+
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFFactor - 1.0f;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return static_cast<float>(r); }
+    OPEN3D_HOST_DEVICE float GetG() { return static_cast<float>(g); }
+    OPEN3D_HOST_DEVICE float GetB() { return static_cast<float>(b); }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<uint16_t>(
+                round((static_cast<float>(weight) * tsdf +
+                       (dsdf + 1.0f) * kTSDFFactor) *
+                      inv_wsum));
+        weight = static_cast<uint8_t>(
+                inc_wsum < static_cast<float>(kMaxUint8) ? weight + 1
+                                                         : kMaxUint8);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<uint16_t>(
+                round((static_cast<float>(weight) * tsdf +
+                       (dsdf + 1.0f) * kTSDFFactor) *
+                      inv_wsum));
+        r = static_cast<uint8_t>(
+                round((static_cast<float>(weight) * r + dr) * inv_wsum));
+        g = static_cast<uint8_t>(
+                round((static_cast<float>(weight) * g + dg) * inv_wsum));
+        b = static_cast<uint8_t>(
+                round((static_cast<float>(weight) * b + db) * inv_wsum));
+        weight = static_cast<uint8_t>(
+                inc_wsum < static_cast<float>(kMaxUint8) ? weight + 1
+                                                         : kMaxUint8);
+    }
+};
+
+/// 4-byte voxel structure.
+/// TSDF quantized to uint16_t and uint16_t weight. The TSDF resolution of
+/// 3e-5 truncation distances is well below the depth noise.
+struct Voxel16i {
+    static const uint16_t kMaxUint16 = 65535;
+    /// TSDF in [-1, 1] is stored as tsdf * kTSDFFactor + kTSDFFactor.
+    static constexpr float kTSDFFactor = 32767.0f;
+
+    uint16_t tsdf;
+    uint16_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFFactor - 1.0f;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<uint16_t>(
+                round((static_cast<float>(weight) * tsdf +
+                       (dsdf + 1.0f) * kTSDFFactor) *
+                      inv_wsum));
+        weight = static_cast<uint16_t>(inc_wsum < static_cast<float>(kMaxUint16)
+                                               ? weight + 1
+                                               : kMaxUint16);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel16i] should never reach here.\n");
+    }
+};
+
+/// 2-byte voxel structure.
+/// TSDF quantized to uint8_t and uint8_t weight saturated at 255. Meant for
+/// coarse maps: the surface is placed to within 1/127 of the truncation
+/// distance, and once the weight is high, observations closer than half a
+/// step to the average are lost to rounding.
+struct Voxel8i {
+    static const uint8_t kMaxUint8 = 255;
+    /// TSDF in [-1, 1] is stored as tsdf * kTSDFFactor + kTSDFFactor.
+    static constexpr float kTSDFFactor = 127.0f;
+
+    uint8_t tsdf;
+    uint8_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFFactor - 1.0f;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<uint8_t>(
+                round((static_cast<float>(weight) * tsdf +
+                       (dsdf + 1.0f) * kTSDFFactor) *
+                      inv_wsum));
+        weight = static_cast<uint8_t>(
+                inc_wsum < static_cast<float>(kMaxUint8) ? weight + 1
+                                                         : kMaxUint8);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[Voxel8i] should never reach here.\n");
+    }
+};
+
 // Get a voxel in a certain voxel block given the block id with its neighbors.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
@@ -236,6 +385,15 @@ inline OPEN3D_DEVICE void DeviceGetNormalAt(
     if (vzp && vzn) n[2] = (vzp->GetTSDF() - vzn->GetTSDF()) / (2 * voxel_size);
 };
 
+// Pack the coordinates of an edge midpoint on the grid of half voxels, each in
+// [-2^20, 2^20), into a key that is unique over the voxel grid.
+inline OPEN3D_HOST_DEVICE int64_t EncodeEdgeKey(int64_t x,
+                                                int64_t y,
+                                                int64_t z) {
+    const int64_t kOffset = int64_t(1) << 20;
+    return ((x + kOffset) << 42) | ((y + kOffset) << 21) | (z + kOffset);
+}
+
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
 void IntegrateCUDA
 #else
@@ -1076,6 +1234,1035 @@ void ExtractSurfaceMeshCPU
     triangles = triangles.Slice(0, 0, total_tri_count);
 }
 
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void ExtractSurfaceMeshPatchesCUDA
+#else
+void ExtractSurfaceMeshPatchesCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& nb_indices,
+         const core::Tensor& nb_masks,
+         const core::Tensor& block_keys,
+         const core::Tensor& block_values,
+         core::Tensor& vertices,
+         core::Tensor& triangles,
+         core::Tensor& normals,
+         core::Tensor& colors,
+         core::Tensor& vertex_keys,
+         core::Tensor& vertex_offsets,
+         core::Tensor& triangle_offsets,
+         int64_t resolution,
+         float voxel_size,
+         float weight_threshold) {
+    core::Device device = block_values.GetDevice();
+    int64_t resolution3 = resolution * resolution * resolution;
+
+    // Besides the edges of its own cubes, a patch owns copies of the
+    // vertices on the edges of its far faces, which are shared with the
+    // patches of the next blocks.
+    int64_t owner_resolution = resolution + 1;
+    int64_t owner_resolution3 =
+            owner_resolution * owner_resolution * owner_resolution;
+
+    // Shape / transform indexers, no data involved
+    NDArrayIndexer voxel_indexer({resolution, resolution, resolution});
+    NDArrayIndexer owner_indexer(
+            {owner_resolution, owner_resolution, owner_resolution});
+
+    int n_blocks = static_cast<int>(indices.GetLength());
+    // Block-wise mesh info. 4 channels correspond to:
+    // 3 edges' corresponding vertex index in the patch + 1 table index.
+    core::Tensor mesh_structure = core::Tensor::Zeros(
+            {n_blocks, owner_resolution, owner_resolution, owner_resolution, 4},
+            core::Dtype::Int32, device);
+
+    // Real data indexer
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+    NDArrayIndexer mesh_structure_indexer(mesh_structure, 4);
+    NDArrayIndexer nb_block_masks_indexer(nb_masks, 2);
+    NDArrayIndexer nb_block_indices_indexer(nb_indices, 2);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+
+    // Plain arrays that does not require indexers
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
+
+    // Per-patch vertex and triangle counters.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::Tensor vtx_counts =
+            core::Tensor::Zeros({n_blocks}, core::Dtype::Int32, device);
+    core::Tensor tri_counts =
+            core::Tensor::Zeros({n_blocks}, core::Dtype::Int32, device);
+    int* vtx_counts_ptr = static_cast<int*>(vtx_counts.GetDataPtr());
+    int* tri_counts_ptr = static_cast<int*>(tri_counts.GetDataPtr());
+#else
+    std::vector<std::atomic<int>> vtx_counts(n_blocks);
+    std::vector<std::atomic<int>> tri_counts(n_blocks);
+    std::atomic<int>* vtx_counts_ptr = vtx_counts.data();
+    std::atomic<int>* tri_counts_ptr = tri_counts.data();
+#endif
+
+    int64_t n = n_blocks * resolution3;
+    int64_t n_owners = n_blocks * owner_resolution3;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    // Pass 0: analyze mesh structure, count triangles and mark the edges
+    // with vertices in the patch of the cube.
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+                    // Natural index (0, N) -> (block_idx, voxel_idx)
+                    int64_t workload_block_idx = workload_idx / resolution3;
+                    int64_t voxel_idx = workload_idx % resolution3;
+
+                    // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+                    int64_t xv, yv, zv;
+                    voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+                    // Check per-vertex sign in the cube to determine cube type
+                    int table_idx = 0;
+                    for (int i = 0; i < 8; ++i) {
+                        voxel_t* voxel_ptr_i = DeviceGetVoxelAt<voxel_t>(
+                                static_cast<int>(xv) + vtx_shifts[i][0],
+                                static_cast<int>(yv) + vtx_shifts[i][1],
+                                static_cast<int>(zv) + vtx_shifts[i][2],
+                                static_cast<int>(workload_block_idx),
+                                static_cast<int>(resolution),
+                                nb_block_masks_indexer,
+                                nb_block_indices_indexer,
+                                voxel_block_buffer_indexer);
+                        if (voxel_ptr_i == nullptr) return;
+
+                        float tsdf_i = voxel_ptr_i->GetTSDF();
+                        float weight_i = voxel_ptr_i->GetWeight();
+                        if (weight_i <= weight_threshold) return;
+
+                        table_idx |= ((tsdf_i < 0) ? (1 << i) : 0);
+                    }
+
+                    int* mesh_struct_ptr =
+                            mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                    xv, yv, zv, workload_block_idx);
+                    mesh_struct_ptr[3] = table_idx;
+
+                    if (table_idx == 0 || table_idx == 255) return;
+                    OPEN3D_ATOMIC_ADD(&tri_counts_ptr[workload_block_idx],
+                                      tri_count[table_idx]);
+
+                    // Edges are owned by voxels of the same patch, possibly
+                    // on its far faces.
+                    int edges_with_vertices = edge_table[table_idx];
+                    for (int i = 0; i < 12; ++i) {
+                        if (edges_with_vertices & (1 << i)) {
+                            int* mesh_ptr_i =
+                                    mesh_structure_indexer
+                                            .GetDataPtrFromCoord<int>(
+                                                    xv + edge_shifts[i][0],
+                                                    yv + edge_shifts[i][1],
+                                                    zv + edge_shifts[i][2],
+                                                    workload_block_idx);
+
+                            // Non-atomic write, but we are safe
+                            mesh_ptr_i[edge_shifts[i][3]] = -1;
+                        }
+                    }
+                });
+            });
+
+    // Pass 1: determine valid number of vertices per patch.
+    launcher.LaunchGeneralKernel(n_owners, [=] OPEN3D_DEVICE(
+                                                   int64_t workload_idx) {
+        int64_t workload_block_idx = workload_idx / owner_resolution3;
+        int64_t xv, yv, zv;
+        owner_indexer.WorkloadToCoord(workload_idx % owner_resolution3, &xv,
+                                      &yv, &zv);
+        int* mesh_struct_ptr = mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                xv, yv, zv, workload_block_idx);
+        int count = (mesh_struct_ptr[0] == -1) + (mesh_struct_ptr[1] == -1) +
+                    (mesh_struct_ptr[2] == -1);
+        if (count > 0) {
+            OPEN3D_ATOMIC_ADD(&vtx_counts_ptr[workload_block_idx], count);
+        }
+    });
+
+    // Exclusive prefix sums of the counters on host, then reset the counters
+    // to allocate the vertices and triangles of each patch.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    std::vector<int> vtx_counts_host = vtx_counts.ToFlatVector<int>();
+    std::vector<int> tri_counts_host = tri_counts.ToFlatVector<int>();
+    vtx_counts.Fill(0);
+    tri_counts.Fill(0);
+#else
+    std::vector<int> vtx_counts_host(n_blocks), tri_counts_host(n_blocks);
+    for (int i = 0; i < n_blocks; ++i) {
+        vtx_counts_host[i] = vtx_counts[i].exchange(0);
+        tri_counts_host[i] = tri_counts[i].exchange(0);
+    }
+#endif
+    std::vector<int64_t> vtx_offsets_host(n_blocks + 1, 0);
+    std::vector<int64_t> tri_offsets_host(n_blocks + 1, 0);
+    for (int i = 0; i < n_blocks; ++i) {
+        vtx_offsets_host[i + 1] = vtx_offsets_host[i] + vtx_counts_host[i];
+        tri_offsets_host[i + 1] = tri_offsets_host[i] + tri_counts_host[i];
+    }
+    int64_t total_vtx_count = vtx_offsets_host[n_blocks];
+    int64_t total_tri_count = tri_offsets_host[n_blocks];
+    utility::LogDebug("Patches: {} blocks, {} vertices, {} triangles.",
+                      n_blocks, total_vtx_count, total_tri_count);
+
+    vertex_offsets = core::Tensor(vtx_offsets_host, {n_blocks + 1},
+                                  core::Dtype::Int64, device);
+    triangle_offsets = core::Tensor(tri_offsets_host, {n_blocks + 1},
+                                    core::Dtype::Int64, device);
+    const int64_t* vtx_offsets_ptr =
+            static_cast<const int64_t*>(vertex_offsets.GetDataPtr());
+    const int64_t* tri_offsets_ptr =
+            static_cast<const int64_t*>(triangle_offsets.GetDataPtr());
+
+    vertices = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32,
+                            device);
+    normals = core::Tensor({total_vtx_count, 3}, core::Dtype::Float32, device);
+    vertex_keys = core::Tensor({total_vtx_count}, core::Dtype::Int64, device);
+    triangles = core::Tensor({total_tri_count, 3}, core::Dtype::Int64, device);
+
+    NDArrayIndexer vertex_indexer(vertices, 1);
+    NDArrayIndexer normal_indexer(normals, 1);
+    NDArrayIndexer vertex_key_indexer(vertex_keys, 1);
+    NDArrayIndexer triangle_indexer(triangles, 1);
+
+    // Pass 2: extract vertices.
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                bool extract_color = false;
+                NDArrayIndexer color_indexer;
+                if (voxel_t::HasColor()) {
+                    extract_color = true;
+                    colors = core::Tensor({total_vtx_count, 3},
+                                          core::Dtype::Float32, device);
+                    color_indexer = NDArrayIndexer(colors, 1);
+                }
+                launcher.LaunchGeneralKernel(
+                        n_owners, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        auto GetVoxelAt =
+                                [&] OPEN3D_DEVICE(
+                                        int xo, int yo, int zo,
+                                        int curr_block_idx) -> voxel_t* {
+                            return DeviceGetVoxelAt<voxel_t>(
+                                    xo, yo, zo, curr_block_idx,
+                                    static_cast<int>(resolution),
+                                    nb_block_masks_indexer,
+                                    nb_block_indices_indexer,
+                                    voxel_block_buffer_indexer);
+                        };
+
+                        auto GetNormalAt = [&] OPEN3D_DEVICE(
+                                                   int xo, int yo, int zo,
+                                                   int curr_block_idx,
+                                                   float* n) {
+                            return DeviceGetNormalAt<voxel_t>(
+                                    xo, yo, zo, curr_block_idx, n,
+                                    static_cast<int>(resolution), voxel_size,
+                                    nb_block_masks_indexer,
+                                    nb_block_indices_indexer,
+                                    voxel_block_buffer_indexer);
+                        };
+
+                        // Natural index (0, N) -> (block_idx, owner_idx)
+                        int64_t workload_block_idx =
+                                workload_idx / owner_resolution3;
+                        int64_t block_idx = indices_ptr[workload_block_idx];
+
+                        // owner_idx -> (x_voxel, y_voxel, z_voxel)
+                        int64_t xv, yv, zv;
+                        owner_indexer.WorkloadToCoord(
+                                workload_idx % owner_resolution3, &xv, &yv,
+                                &zv);
+
+                        // Obtain voxel's mesh struct ptr
+                        int* mesh_struct_ptr =
+                                mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                        xv, yv, zv, workload_block_idx);
+
+                        // Early quit -- no allocated vertex to compute
+                        if (mesh_struct_ptr[0] != -1 &&
+                            mesh_struct_ptr[1] != -1 &&
+                            mesh_struct_ptr[2] != -1) {
+                            return;
+                        }
+
+                        // block_idx -> (x_block, y_block, z_block)
+                        int* block_key_ptr =
+                                block_keys_indexer.GetDataPtrFromCoord<int>(
+                                        block_idx);
+                        int64_t xb = static_cast<int64_t>(block_key_ptr[0]);
+                        int64_t yb = static_cast<int64_t>(block_key_ptr[1]);
+                        int64_t zb = static_cast<int64_t>(block_key_ptr[2]);
+
+                        // global coordinate (in voxels)
+                        int64_t x = xb * resolution + xv;
+                        int64_t y = yb * resolution + yv;
+                        int64_t z = zb * resolution + zv;
+
+                        // The owner voxel may lie in the next blocks.
+                        voxel_t* voxel_ptr = GetVoxelAt(
+                                static_cast<int>(xv), static_cast<int>(yv),
+                                static_cast<int>(zv),
+                                static_cast<int>(workload_block_idx));
+                        float tsdf_o = voxel_ptr->GetTSDF();
+                        float no[3] = {0}, ne[3] = {0};
+                        GetNormalAt(static_cast<int>(xv), static_cast<int>(yv),
+                                    static_cast<int>(zv),
+                                    static_cast<int>(workload_block_idx), no);
+
+                        // Enumerate 3 edges in the voxel
+                        for (int e = 0; e < 3; ++e) {
+                            int vertex_idx = mesh_struct_ptr[e];
+                            if (vertex_idx != -1) continue;
+
+                            voxel_t* voxel_ptr_e = GetVoxelAt(
+                                    static_cast<int>(xv) + (e == 0),
+                                    static_cast<int>(yv) + (e == 1),
+                                    static_cast<int>(zv) + (e == 2),
+                                    static_cast<int>(workload_block_idx));
+                            float tsdf_e = voxel_ptr_e->GetTSDF();
+                            float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
+
+                            int local_idx = OPEN3D_ATOMIC_ADD(
+                                    &vtx_counts_ptr[workload_block_idx], 1);
+                            mesh_struct_ptr[e] = local_idx;
+                            int64_t idx = vtx_offsets_ptr[workload_block_idx] +
+                                          local_idx;
+
+                            float ratio_x = ratio * int(e == 0);
+                            float ratio_y = ratio * int(e == 1);
+                            float ratio_z = ratio * int(e == 2);
+
+                            float* vertex_ptr =
+                                    vertex_indexer.GetDataPtrFromCoord<float>(
+                                            idx);
+                            vertex_ptr[0] = voxel_size * (x + ratio_x);
+                            vertex_ptr[1] = voxel_size * (y + ratio_y);
+                            vertex_ptr[2] = voxel_size * (z + ratio_z);
+
+                            // The edge is identified by its midpoint on the
+                            // grid of half voxels.
+                            *vertex_key_indexer.GetDataPtrFromCoord<int64_t>(
+                                    idx) = EncodeEdgeKey(2 * x + (e == 0),
+                                                         2 * y + (e == 1),
+                                                         2 * z + (e == 2));
+
+                            float* normal_ptr =
+                                    normal_indexer.GetDataPtrFromCoord<float>(
+                                            idx);
+                            GetNormalAt(static_cast<int>(xv) + (e == 0),
+                                        static_cast<int>(yv) + (e == 1),
+                                        static_cast<int>(zv) + (e == 2),
+                                        static_cast<int>(workload_block_idx),
+                                        ne);
+                            float nx = (1 - ratio) * no[0] + ratio * ne[0];
+                            float ny = (1 - ratio) * no[1] + ratio * ne[1];
+                            float nz = (1 - ratio) * no[2] + ratio * ne[2];
+                            float norm = static_cast<float>(
+                                    sqrt(nx * nx + ny * ny + nz * nz) + 1e-5);
+                            normal_ptr[0] = nx / norm;
+                            normal_ptr[1] = ny / norm;
+                            normal_ptr[2] = nz / norm;
+
+                            if (extract_color) {
+                                float* color_ptr =
+                                        color_indexer
+                                                .GetDataPtrFromCoord<float>(
+                                                        idx);
+                                float r_o = voxel_ptr->GetR();
+                                float g_o = voxel_ptr->GetG();
+                                float b_o = voxel_ptr->GetB();
+
+                                float r_e = voxel_ptr_e->GetR();
+                                float g_e = voxel_ptr_e->GetG();
+                                float b_e = voxel_ptr_e->GetB();
+                                color_ptr[0] = ((1 - ratio) * r_o +
+                                                 ratio * r_e) /
+                                                255.0f;
+                                color_ptr[1] = ((1 - ratio) * g_o +
+                                                 ratio * g_e) /
+                                                255.0f;
+                                color_ptr[2] = ((1 - ratio) * b_o +
+                                                 ratio * b_e) /
+                                                255.0f;
+                            }
+                        }
+                    });
+            });
+
+    // Pass 3: connect vertices and form triangles, indexed in the patch.
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        // Natural index (0, N) -> (block_idx, voxel_idx)
+        int64_t workload_block_idx = workload_idx / resolution3;
+        int64_t voxel_idx = workload_idx % resolution3;
+
+        // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+        int64_t xv, yv, zv;
+        voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+        // Obtain voxel's mesh struct ptr
+        int* mesh_struct_ptr = mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                xv, yv, zv, workload_block_idx);
+
+        int table_idx = mesh_struct_ptr[3];
+        if (tri_count[table_idx] == 0) return;
+
+        for (size_t tri = 0; tri < 16; tri += 3) {
+            if (tri_table[table_idx][tri] == -1) return;
+
+            int64_t tri_idx =
+                    tri_offsets_ptr[workload_block_idx] +
+                    OPEN3D_ATOMIC_ADD(&tri_counts_ptr[workload_block_idx], 1);
+            int64_t* triangle_ptr =
+                    triangle_indexer.GetDataPtrFromCoord<int64_t>(tri_idx);
+
+            for (size_t vertex = 0; vertex < 3; ++vertex) {
+                int edge = tri_table[table_idx][tri + vertex];
+                int* mesh_struct_ptr_i =
+                        mesh_structure_indexer.GetDataPtrFromCoord<int>(
+                                xv + edge_shifts[edge][0],
+                                yv + edge_shifts[edge][1],
+                                zv + edge_shifts[edge][2], workload_block_idx);
+                triangle_ptr[2 - vertex] =
+                        mesh_struct_ptr_i[edge_shifts[edge][3]];
+            }
+        }
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void CullBlocksCUDA
+#else
+void CullBlocksCPU
+#endif
+        (const core::Tensor& depth,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         core::Tensor& mask,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int64_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max) {
+    // Maximum valid depth of each tile of kTileSize x kTileSize pixels, 0 if
+    // the tile has no valid depth. Blocks are tested against the tiles they
+    // cover instead of the pixels.
+    const int64_t kTileSize = 8;
+    int64_t rows = depth.GetShape()[0];
+    int64_t cols = depth.GetShape()[1];
+    int64_t tile_rows = (rows + kTileSize - 1) / kTileSize;
+    int64_t tile_cols = (cols + kTileSize - 1) / kTileSize;
+    core::Tensor tile_max({tile_rows, tile_cols}, core::Dtype::Float32,
+                          depth.GetDevice());
+
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer tile_indexer(tile_max, 2);
+    NDArrayIndexer block_keys_indexer(block_keys, 1);
+    TransformIndexer transform_indexer(intrinsics, extrinsics, voxel_size);
+
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices.GetDataPtr());
+    bool* mask_ptr = static_cast<bool*>(mask.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    launcher.LaunchGeneralKernel(
+            tile_rows * tile_cols, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t ty = workload_idx / tile_cols;
+                int64_t tx = workload_idx % tile_cols;
+                int64_t y_end = (ty + 1) * kTileSize;
+                int64_t x_end = (tx + 1) * kTileSize;
+                y_end = y_end < rows ? y_end : rows;
+                x_end = x_end < cols ? x_end : cols;
+
+                float d_max = 0;
+                for (int64_t y = ty * kTileSize; y < y_end; ++y) {
+                    for (int64_t x = tx * kTileSize; x < x_end; ++x) {
+                        float d = *depth_indexer.GetDataPtrFromCoord<float>(
+                                          x, y) /
+                                  depth_scale;
+                        if (d > 0 && d <= depth_max && d > d_max) {
+                            d_max = d;
+                        }
+                    }
+                }
+                *tile_indexer.GetDataPtrFromCoord<float>(tx, ty) = d_max;
+            });
+
+    launcher.LaunchGeneralKernel(
+            indices.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int* block_key_ptr =
+                        block_keys_indexer.GetDataPtrFromCoord<int>(
+                                indices_ptr[workload_idx]);
+                int64_t x0 = block_key_ptr[0] * resolution;
+                int64_t y0 = block_key_ptr[1] * resolution;
+                int64_t z0 = block_key_ptr[2] * resolution;
+
+                // The voxels are in the box of the 8 corner voxels, and
+                // project into the bounding box of their projections.
+                float z_min = 0, z_max = 0;
+                float u_min = 0, u_max = 0, v_min = 0, v_max = 0;
+                bool all_in_front = true;
+                for (int k = 0; k < 8; ++k) {
+                    float xc, yc, zc, u = 0, v = 0;
+                    transform_indexer.RigidTransform(
+                            static_cast<float>(x0 + (k & 1) * (resolution - 1)),
+                            static_cast<float>(
+                                    y0 + ((k >> 1) & 1) * (resolution - 1)),
+                            static_cast<float>(
+                                    z0 + (k >> 2) * (resolution - 1)),
+                            &xc, &yc, &zc);
+                    if (zc <= 0) {
+                        all_in_front = false;
+                    } else {
+                        transform_indexer.Project(xc, yc, zc, &u, &v);
+                    }
+                    if (k == 0) {
+                        z_min = z_max = zc;
+                        u_min = u_max = u;
+                        v_min = v_max = v;
+                    }
+                    z_min = zc < z_min ? zc : z_min;
+                    z_max = zc > z_max ? zc : z_max;
+                    u_min = u < u_min ? u : u_min;
+                    u_max = u > u_max ? u : u_max;
+                    v_min = v < v_min ? v : v_min;
+                    v_max = v > v_max ? v : v_max;
+                }
+
+                // Behind the camera.
+                if (z_max <= 0) {
+                    mask_ptr[workload_idx] = false;
+                    return;
+                }
+                // Crossing the image plane, kept conservatively.
+                if (!all_in_front) {
+                    mask_ptr[workload_idx] = true;
+                    return;
+                }
+                // Outside the image.
+                if (u_max < 0 || v_max < 0 || u_min > cols - 1 ||
+                    v_min > rows - 1) {
+                    mask_ptr[workload_idx] = false;
+                    return;
+                }
+
+                int64_t tx_begin = u_min > 0 ? static_cast<int64_t>(u_min) /
+                                                       kTileSize
+                                             : 0;
+                int64_t ty_begin = v_min > 0 ? static_cast<int64_t>(v_min) /
+                                                       kTileSize
+                                             : 0;
+                int64_t tx_end = u_max < cols - 1
+                                         ? static_cast<int64_t>(u_max) /
+                                                   kTileSize
+                                         : tile_cols - 1;
+                int64_t ty_end = v_max < rows - 1
+                                         ? static_cast<int64_t>(v_max) /
+                                                   kTileSize
+                                         : tile_rows - 1;
+                float d_max = 0;
+                for (int64_t ty = ty_begin; ty <= ty_end; ++ty) {
+                    for (int64_t tx = tx_begin; tx <= tx_end; ++tx) {
+                        float d = *tile_indexer.GetDataPtrFromCoord<float>(tx,
+                                                                          ty);
+                        d_max = d > d_max ? d : d_max;
+                    }
+                }
+
+                // No valid depth, or all voxels beyond the truncation band
+                // behind the surface: integration would not update any voxel.
+                mask_ptr[workload_idx] =
+                        d_max > 0 && z_min - d_max <= sdf_trunc;
+            });
+}
+
+/// Hash of a voxel block coordinate in the ray casting block table.
+inline OPEN3D_HOST_DEVICE int64_t BlockTableHash(int xb, int yb, int zb) {
+    return static_cast<int64_t>((static_cast<uint64_t>(xb) * 73856093) ^
+                                (static_cast<uint64_t>(yb) * 19349669) ^
+                                (static_cast<uint64_t>(zb) * 83492791));
+}
+
+/// Find a block coordinate in the ray casting block table, returns its index
+/// in the voxel block buffer, or -1 if the block is not active.
+inline OPEN3D_HOST_DEVICE int64_t BlockTableFind(const int* table_keys,
+                                                 const int64_t* table_indices,
+                                                 int64_t table_mask,
+                                                 int xb,
+                                                 int yb,
+                                                 int zb) {
+    int64_t slot = BlockTableHash(xb, yb, zb) & table_mask;
+    while (true) {
+        int64_t block_idx = table_indices[slot];
+        if (block_idx < 0) return -1;
+        const int* key = table_keys + 3 * slot;
+        if (key[0] == xb && key[1] == yb && key[2] == zb) return block_idx;
+        slot = (slot + 1) & table_mask;
+    }
+}
+
+/// Floor division for voxel to block coordinates.
+inline OPEN3D_HOST_DEVICE int FloorDiv(int a, int b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/// Claim an empty slot of the ray casting block table for \p block_idx,
+/// returns false if another block holds the slot.
+inline OPEN3D_DEVICE bool BlockTableClaim(int64_t* slot_ptr,
+                                          int64_t block_idx) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    using ull = unsigned long long;
+    return atomicCAS(reinterpret_cast<ull*>(slot_ptr), static_cast<ull>(-1),
+                     static_cast<ull>(block_idx)) == static_cast<ull>(-1);
+#else
+    static_assert(sizeof(std::atomic<int64_t>) == sizeof(int64_t),
+                  "std::atomic<int64_t> must not add storage.");
+    int64_t empty = -1;
+    return reinterpret_cast<std::atomic<int64_t>*>(slot_ptr)
+            ->compare_exchange_strong(empty, block_idx);
+#endif
+}
+
+/// Ray casting block table, see kernel::tsdf::BuildBlockTable(). Built in
+/// parallel on the device of the hashmap, at most half full, with index -1 in
+/// the empty slots.
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void BuildBlockTableCUDA
+#else
+void BuildBlockTableCPU
+#endif
+        (const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         core::Tensor& table_keys,
+         core::Tensor& table_indices,
+         core::Tensor& block_bounds) {
+    core::Device device = block_keys.GetDevice();
+    core::Device host("CPU:0");
+    core::Tensor indices_contiguous = indices.Contiguous();
+
+    int64_t n = indices_contiguous.GetLength();
+    int64_t capacity = 16;
+    while (capacity < 2 * n) {
+        capacity <<= 1;
+    }
+    int64_t mask = capacity - 1;
+
+    table_keys =
+            core::Tensor::Zeros({capacity, 3}, core::Dtype::Int32, device);
+    table_indices =
+            core::Tensor::Full({capacity}, -1, core::Dtype::Int64, device);
+    block_bounds = core::Tensor::Zeros({2, 3}, core::Dtype::Int32, host);
+    if (n == 0) {
+        return;
+    }
+
+    core::Tensor keys = block_keys.IndexGet({indices_contiguous}).Contiguous();
+    core::Tensor key_min = keys.Min({0}).To(host);
+    core::Tensor key_max = keys.Max({0}).To(host);
+    int* bounds_ptr = static_cast<int*>(block_bounds.GetDataPtr());
+    for (int i = 0; i < 3; ++i) {
+        bounds_ptr[i] = static_cast<const int*>(key_min.GetDataPtr())[i];
+        bounds_ptr[3 + i] = static_cast<const int*>(key_max.GetDataPtr())[i];
+    }
+
+    const int64_t* indices_ptr =
+            static_cast<const int64_t*>(indices_contiguous.GetDataPtr());
+    const int* keys_ptr = static_cast<const int*>(keys.GetDataPtr());
+    int* table_keys_ptr = static_cast<int*>(table_keys.GetDataPtr());
+    int64_t* table_indices_ptr =
+            static_cast<int64_t*>(table_indices.GetDataPtr());
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+    launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int* key = keys_ptr + 3 * workload_idx;
+        int64_t slot = BlockTableHash(key[0], key[1], key[2]) & mask;
+        while (!BlockTableClaim(table_indices_ptr + slot,
+                                indices_ptr[workload_idx])) {
+            slot = (slot + 1) & mask;
+        }
+        // Keys are only read by later kernels, after the table is complete.
+        table_keys_ptr[3 * slot + 0] = key[0];
+        table_keys_ptr[3 * slot + 1] = key[1];
+        table_keys_ptr[3 * slot + 2] = key[2];
+    });
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+void RayCastCUDA
+#else
+void RayCastCPU
+#endif
+        (const core::Tensor& table_keys,
+         const core::Tensor& table_indices,
+         const core::Tensor& block_bounds,
+         const core::Tensor& block_values,
+         core::Tensor& vertex_map,
+         core::Tensor& depth_map,
+         core::Tensor& color_map,
+         core::Tensor& normal_map,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int64_t h,
+         int64_t w,
+         int64_t block_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_min,
+         float depth_max,
+         float weight_threshold) {
+    const int* table_keys_ptr =
+            static_cast<const int*>(table_keys.GetDataPtr());
+    const int64_t* table_indices_ptr =
+            static_cast<const int64_t*>(table_indices.GetDataPtr());
+    int64_t table_mask = table_indices.GetLength() - 1;
+
+    // Shape / transform indexers, no data involved
+    TransformIndexer w2c_transform_indexer(intrinsics, extrinsics);
+    TransformIndexer c2w_transform_indexer(
+            intrinsics,
+            extrinsics.To(core::Device("CPU:0")).Inverse().Contiguous());
+
+    // Real data indexer
+    NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
+
+    // Optional output maps
+    NDArrayIndexer vertex_map_indexer, depth_map_indexer, color_map_indexer,
+            normal_map_indexer;
+    bool enable_vertex = vertex_map.NumElements() != 0;
+    bool enable_depth = depth_map.NumElements() != 0;
+    bool enable_color = color_map.NumElements() != 0;
+    bool enable_normal = normal_map.NumElements() != 0;
+    if (enable_vertex) vertex_map_indexer = NDArrayIndexer(vertex_map, 2);
+    if (enable_depth) depth_map_indexer = NDArrayIndexer(depth_map, 2);
+    if (enable_color) color_map_indexer = NDArrayIndexer(color_map, 2);
+    if (enable_normal) normal_map_indexer = NDArrayIndexer(normal_map, 2);
+
+    int resolution = static_cast<int>(block_resolution);
+    float inv_voxel_size = 1.0f / voxel_size;
+
+    // Bounding box of the active blocks in meter, rays are clipped to it.
+    const int* block_min = static_cast<const int*>(block_bounds.GetDataPtr());
+    const int* block_max = block_min + 3;
+    float box_min_x = (block_min[0] * resolution - 0.5f) * voxel_size;
+    float box_min_y = (block_min[1] * resolution - 0.5f) * voxel_size;
+    float box_min_z = (block_min[2] * resolution - 0.5f) * voxel_size;
+    float box_max_x = ((block_max[0] + 1) * resolution - 0.5f) * voxel_size;
+    float box_max_y = ((block_max[1] + 1) * resolution - 0.5f) * voxel_size;
+    float box_max_z = ((block_max[2] + 1) * resolution - 0.5f) * voxel_size;
+
+    int64_t n = h * w;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::kernel::CUDALauncher launcher;
+#else
+    core::kernel::CPULauncher launcher;
+#endif
+
+    DISPATCH_BYTESIZE_TO_VOXEL(
+            voxel_block_buffer_indexer.ElementByteSize(), [&]() {
+                bool has_color = voxel_t::HasColor();
+                launcher.LaunchGeneralKernel(n, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+                    // Block of the last lookup, shared by most steps.
+                    int cached_xb = 0, cached_yb = 0, cached_zb = 0;
+                    int64_t cached_block_idx = -2;
+                    auto GetBlockIdx = [&] OPEN3D_DEVICE(int xb, int yb,
+                                                         int zb) -> int64_t {
+                        if (cached_block_idx == -2 || xb != cached_xb ||
+                            yb != cached_yb || zb != cached_zb) {
+                            cached_xb = xb;
+                            cached_yb = yb;
+                            cached_zb = zb;
+                            cached_block_idx =
+                                    BlockTableFind(table_keys_ptr,
+                                                   table_indices_ptr,
+                                                   table_mask, xb, yb, zb);
+                        }
+                        return cached_block_idx;
+                    };
+
+                    // Voxel at a global voxel coordinate.
+                    auto GetVoxelAt = [&] OPEN3D_DEVICE(int x, int y,
+                                                        int z) -> voxel_t* {
+                        int xb = FloorDiv(x, resolution);
+                        int yb = FloorDiv(y, resolution);
+                        int zb = FloorDiv(z, resolution);
+                        int64_t block_idx = GetBlockIdx(xb, yb, zb);
+                        if (block_idx < 0) return nullptr;
+                        return voxel_block_buffer_indexer
+                                .GetDataPtrFromCoord<voxel_t>(
+                                        x - xb * resolution,
+                                        y - yb * resolution,
+                                        z - zb * resolution, block_idx);
+                    };
+
+                    // Trilinear interpolation of TSDF, its gradient and
+                    // color at a point in voxel units. Fails if any of the 8
+                    // voxels of the cell is unobserved.
+                    auto GetTrilinearAt = [&] OPEN3D_DEVICE(
+                                                  float x, float y, float z,
+                                                  float* tsdf, float* grad,
+                                                  float* color) -> bool {
+                        int x0 = static_cast<int>(floorf(x));
+                        int y0 = static_cast<int>(floorf(y));
+                        int z0 = static_cast<int>(floorf(z));
+                        float rx = x - x0, ry = y - y0, rz = z - z0;
+
+                        // Most cells lie in one block, resolved only once.
+                        int xb = FloorDiv(x0, resolution);
+                        int yb = FloorDiv(y0, resolution);
+                        int zb = FloorDiv(z0, resolution);
+                        int xl = x0 - xb * resolution;
+                        int yl = y0 - yb * resolution;
+                        int zl = z0 - zb * resolution;
+                        bool in_block = xl < resolution - 1 &&
+                                        yl < resolution - 1 &&
+                                        zl < resolution - 1;
+                        int64_t block_idx = -1;
+                        if (in_block) {
+                            block_idx = GetBlockIdx(xb, yb, zb);
+                            if (block_idx < 0) return false;
+                        }
+
+                        *tsdf = 0;
+                        for (int i = 0; i < 3; ++i) {
+                            grad[i] = 0;
+                            color[i] = 0;
+                        }
+                        for (int k = 0; k < 8; ++k) {
+                            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+                            voxel_t* voxel_ptr =
+                                    in_block ? voxel_block_buffer_indexer
+                                                       .GetDataPtrFromCoord<
+                                                               voxel_t>(
+                                                               xl + dx,
+                                                               yl + dy,
+                                                               zl + dz,
+                                                               block_idx)
+                                             : GetVoxelAt(x0 + dx, y0 + dy,
+                                                          z0 + dz);
+                            if (voxel_ptr == nullptr ||
+                                voxel_ptr->GetWeight() <= weight_threshold) {
+                                return false;
+                            }
+                            float wx = dx ? rx : 1 - rx;
+                            float wy = dy ? ry : 1 - ry;
+                            float wz = dz ? rz : 1 - rz;
+                            float tsdf_k = voxel_ptr->GetTSDF();
+                            *tsdf += wx * wy * wz * tsdf_k;
+                            grad[0] += (dx ? 1 : -1) * wy * wz * tsdf_k;
+                            grad[1] += (dy ? 1 : -1) * wx * wz * tsdf_k;
+                            grad[2] += (dz ? 1 : -1) * wx * wy * tsdf_k;
+                            color[0] += wx * wy * wz * voxel_ptr->GetR();
+                            color[1] += wx * wy * wz * voxel_ptr->GetG();
+                            color[2] += wx * wy * wz * voxel_ptr->GetB();
+                        }
+                        return true;
+                    };
+
+                    int64_t y = workload_idx / w;
+                    int64_t x = workload_idx % w;
+
+                    // Ray through the pixel at unit depth, origin and
+                    // direction in world (in meter).
+                    float xc, yc, zc;
+                    w2c_transform_indexer.Unproject(static_cast<float>(x),
+                                                    static_cast<float>(y),
+                                                    1.0f, &xc, &yc, &zc);
+                    float ox, oy, oz, dx, dy, dz;
+                    c2w_transform_indexer.RigidTransform(0, 0, 0, &ox, &oy,
+                                                         &oz);
+                    c2w_transform_indexer.Rotate(xc, yc, zc, &dx, &dy, &dz);
+
+                    float o[3] = {ox, oy, oz};
+                    float d[3] = {dx, dy, dz};
+                    float inv_d[3];
+                    for (int i = 0; i < 3; ++i) {
+                        inv_d[i] = d[i] != 0 ? 1.0f / d[i] : 0;
+                    }
+
+                    // Clip the ray to the bounding box of the active blocks.
+                    float box_min[3] = {box_min_x, box_min_y, box_min_z};
+                    float box_max[3] = {box_max_x, box_max_y, box_max_z};
+                    float t_near = depth_min, t_far = depth_max;
+                    for (int i = 0; i < 3; ++i) {
+                        if (d[i] == 0) {
+                            if (o[i] < box_min[i] || o[i] > box_max[i]) return;
+                            continue;
+                        }
+                        float t_0 = (box_min[i] - o[i]) * inv_d[i];
+                        float t_1 = (box_max[i] - o[i]) * inv_d[i];
+                        t_near = fmaxf(t_near, fminf(t_0, t_1));
+                        t_far = fminf(t_far, fmaxf(t_0, t_1));
+                    }
+                    if (t_near > t_far) return;
+
+                    // March along depth t with steps bounded by the TSDF.
+                    // Blocks that are not allocated are crossed in one step.
+                    float block_size = voxel_size * resolution;
+                    float t = t_near;
+                    float t_prev = t;
+                    float tsdf_prev = 0;
+                    float tsdf_curr = 0;
+                    bool prev_valid = false;
+                    bool hit = false;
+                    float ray_norm = sqrtf(dx * dx + dy * dy + dz * dz);
+                    float min_step = voxel_size / ray_norm;
+                    while (t < t_far) {
+                        float px = (ox + t * dx) * inv_voxel_size;
+                        float py = (oy + t * dy) * inv_voxel_size;
+                        float pz = (oz + t * dz) * inv_voxel_size;
+                        int xv = static_cast<int>(floorf(px + 0.5f));
+                        int yv = static_cast<int>(floorf(py + 0.5f));
+                        int zv = static_cast<int>(floorf(pz + 0.5f));
+                        int xb = FloorDiv(xv, resolution);
+                        int yb = FloorDiv(yv, resolution);
+                        int zb = FloorDiv(zv, resolution);
+                        int64_t block_idx = GetBlockIdx(xb, yb, zb);
+
+                        if (block_idx < 0) {
+                            // Exit of the ray from the block, whose voxels
+                            // span [b * res - 0.5, (b + 1) * res - 0.5).
+                            float t_exit = t_far;
+                            int b[3] = {xb, yb, zb};
+                            for (int i = 0; i < 3; ++i) {
+                                if (d[i] == 0) continue;
+                                float lo = (b[i] * resolution - 0.5f) *
+                                           voxel_size;
+                                float bound = d[i] > 0 ? lo + block_size : lo;
+                                float t_i = (bound - o[i]) * inv_d[i];
+                                t_exit = t_i < t_exit ? t_i : t_exit;
+                            }
+                            t = t_exit > t ? t_exit + 1e-3f * min_step
+                                           : t + min_step;
+                            prev_valid = false;
+                            continue;
+                        }
+
+                        voxel_t* voxel_ptr =
+                                voxel_block_buffer_indexer
+                                        .GetDataPtrFromCoord<voxel_t>(
+                                                xv - xb * resolution,
+                                                yv - yb * resolution,
+                                                zv - zb * resolution,
+                                                block_idx);
+                        if (voxel_ptr->GetWeight() <= weight_threshold) {
+                            prev_valid = false;
+                            t += min_step;
+                            continue;
+                        }
+
+                        tsdf_curr = voxel_ptr->GetTSDF();
+                        if (prev_valid && tsdf_prev > 0 && tsdf_curr <= 0) {
+                            hit = true;
+                            break;
+                        }
+                        tsdf_prev = tsdf_curr;
+                        t_prev = t;
+                        prev_valid = true;
+                        float step = tsdf_curr * sdf_trunc / ray_norm;
+                        t += step > min_step ? step : min_step;
+                    }
+                    if (!hit) return;
+
+                    // Zero crossing between t_prev and t from the nearest
+                    // voxels, refined by a secant step on trilinear samples
+                    // half a voxel around it. Nearest voxels are off the ray
+                    // by up to half a voxel, so the refined crossing may
+                    // leave [t_prev, t] by a step.
+                    float t_hit = t_prev + (t - t_prev) * tsdf_prev /
+                                                   (tsdf_prev - tsdf_curr);
+                    float grad[3], color[3];
+                    float t_a = t_hit - 0.5f * min_step;
+                    float t_b = t_hit + 0.5f * min_step;
+                    float tsdf_a, tsdf_b;
+                    if (GetTrilinearAt((ox + t_a * dx) * inv_voxel_size,
+                                       (oy + t_a * dy) * inv_voxel_size,
+                                       (oz + t_a * dz) * inv_voxel_size,
+                                       &tsdf_a, grad, color) &&
+                        GetTrilinearAt((ox + t_b * dx) * inv_voxel_size,
+                                       (oy + t_b * dy) * inv_voxel_size,
+                                       (oz + t_b * dz) * inv_voxel_size,
+                                       &tsdf_b, grad, color) &&
+                        tsdf_a != tsdf_b) {
+                        float t_secant =
+                                t_a + (t_b - t_a) * tsdf_a / (tsdf_a - tsdf_b);
+                        if (t_secant > t_prev - min_step &&
+                            t_secant < t + min_step) {
+                            t_hit = t_secant;
+                        }
+                    }
+
+                    if (enable_depth) {
+                        float* depth_ptr =
+                                depth_map_indexer.GetDataPtrFromCoord<float>(
+                                        x, y);
+                        *depth_ptr = t_hit * depth_scale;
+                    }
+                    if (enable_vertex) {
+                        float* vertex_ptr =
+                                vertex_map_indexer.GetDataPtrFromCoord<float>(
+                                        x, y);
+                        vertex_ptr[0] = xc * t_hit;
+                        vertex_ptr[1] = yc * t_hit;
+                        vertex_ptr[2] = t_hit;
+                    }
+                    if (!enable_color && !enable_normal) return;
+
+                    if (!GetTrilinearAt((ox + t_hit * dx) * inv_voxel_size,
+                                        (oy + t_hit * dy) * inv_voxel_size,
+                                        (oz + t_hit * dz) * inv_voxel_size,
+                                        &tsdf_curr, grad, color)) {
+                        return;
+                    }
+                    if (enable_normal) {
+                        float nx, ny, nz;
+                        w2c_transform_indexer.Rotate(grad[0], grad[1], grad[2],
+                                                     &nx, &ny, &nz);
+                        float norm = sqrtf(nx * nx + ny * ny + nz * nz);
+                        if (norm > 0) {
+                            float* normal_ptr =
+                                    normal_map_indexer
+                                            .GetDataPtrFromCoord<float>(x, y);
+                            normal_ptr[0] = nx / norm;
+                            normal_ptr[1] = ny / norm;
+                            normal_ptr[2] = nz / norm;
+                        }
+                    }
+                    if (enable_color && has_color) {
+                        float* color_ptr =
+                                color_map_indexer.GetDataPtrFromCoord<float>(
+                                        x, y);
+                        color_ptr[0] = color[0] / 255.0f;
+                        color_ptr[1] = color[1] / 255.0f;
+                        color_ptr[2] = color[2] / 255.0f;
+                    }
+                });
+            });
+}
+
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
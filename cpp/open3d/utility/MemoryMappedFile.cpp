@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/MemoryMappedFile.h"
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "open3d/utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+#ifdef WINDOWS
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name)
+    : file_name_(file_name) {
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LogError("MemoryMappedFile: unable to open file {}.", file_name);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        LogError("MemoryMappedFile: unable to get the size of {}.", file_name);
+    }
+    size_ = static_cast<int64_t>(size.QuadPart);
+    file_handle_ = file;
+    if (size_ == 0) {
+        return;
+    }
+    HANDLE mapping =
+            CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        LogError("MemoryMappedFile: unable to map file {}.", file_name);
+    }
+    void* data_ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (data_ptr == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        LogError("MemoryMappedFile: unable to map file {}.", file_name);
+    }
+    mapping_handle_ = mapping;
+    data_ptr_ = static_cast<char*>(data_ptr);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (data_ptr_ != nullptr) {
+        UnmapViewOfFile(data_ptr_);
+    }
+    if (mapping_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_ != nullptr) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name)
+    : file_name_(file_name) {
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LogError("MemoryMappedFile: unable to open file {}.", file_name);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        LogError("MemoryMappedFile: unable to get the size of {}.", file_name);
+    }
+    size_ = static_cast<int64_t>(st.st_size);
+    if (size_ > 0) {
+        // The file descriptor is no longer needed once the file is mapped.
+        void* data_ptr = mmap(nullptr, static_cast<size_t>(size_),
+                              PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data_ptr == MAP_FAILED) {
+            close(fd);
+            LogError("MemoryMappedFile: unable to map file {}.", file_name);
+        }
+        data_ptr_ = static_cast<char*>(data_ptr);
+    }
+    close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (data_ptr_ != nullptr) {
+        munmap(data_ptr_, static_cast<size_t>(size_));
+    }
+}
+
+#endif
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \class MemoryMappedFile
+///
+/// \brief Maps a whole file into the virtual address space.
+///
+/// Pages are read from disk lazily on first access, so only the parts of the
+/// file that are touched are ever loaded. The mapping is copy-on-write: the
+/// memory can be modified, but changes are private to the process and are
+/// never written back to the file.
+class MemoryMappedFile {
+public:
+    /// Maps \p file_name. Throws if the file cannot be opened or mapped.
+    explicit MemoryMappedFile(const std::string& file_name);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    /// Returns the start of the mapped file. nullptr for an empty file.
+    char* GetDataPtr() { return data_ptr_; }
+    const char* GetDataPtr() const { return data_ptr_; }
+
+    /// Returns the file size in bytes.
+    int64_t GetSize() const { return size_; }
+
+    const std::string& GetFileName() const { return file_name_; }
+
+private:
+    std::string file_name_;
+    char* data_ptr_ = nullptr;
+    int64_t size_ = 0;
+#ifdef WINDOWS
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace utility
+}  // namespace open3d
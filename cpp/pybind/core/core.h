@@ -43,6 +43,7 @@ void pybind_core_tensor_accessor(py::class_<Tensor>& t);
 void pybind_core_linalg(py::module& m);
 void pybind_core_kernel(py::module& m);
 void pybind_core_hashmap(py::module& m);
+void pybind_core_profiler(py::module& m);
 
 }  // namespace core
 }  // namespace open3d
@@ -49,6 +49,8 @@ void pybind_core_dtype(py::module &m) {
                                                     "Open3D data types.");
     dtype.def(py::init<Dtype::DtypeCode, int64_t, const std::string &>());
     dtype.def_readonly_static("Undefined", &Dtype::Undefined);
+    dtype.def_readonly_static("Float16", &Dtype::Float16);
+    dtype.def_readonly_static("BFloat16", &Dtype::BFloat16);
     dtype.def_readonly_static("Float32", &Dtype::Float32);
     dtype.def_readonly_static("Float64", &Dtype::Float64);
     dtype.def_readonly_static("Int32", &Dtype::Int32);
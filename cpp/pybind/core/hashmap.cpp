@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/hashmap/MultiValueHashmap.h"
 
 #include <pybind11/cast.h>
 #include <pybind11/pytypes.h>
@@ -40,6 +41,13 @@
 namespace open3d {
 namespace core {
 void pybind_core_hashmap(py::module& m) {
+    py::enum_<HashmapBackend>(m, "HashmapBackend", "Hashmap implementation.")
+            .value("Default", HashmapBackend::Default)
+            .value("TBB", HashmapBackend::TBB)
+            .value("LinearProbing", HashmapBackend::LinearProbing)
+            .value("Slab", HashmapBackend::Slab)
+            .export_values();
+
     py::class_<Hashmap> hashmap(
             m, "Hashmap",
             "A Hashmap is a map from key to data wrapped by Tensors.");
@@ -48,19 +56,21 @@ void pybind_core_hashmap(py::module& m) {
                             const Dtype& dtype_value,
                             const py::handle& element_shape_key,
                             const py::handle& element_shape_value,
-                            const Device& device) {
+                            const Device& device,
+                            const HashmapBackend& backend) {
                     SizeVector element_shape_key_sv =
                             PyHandleToSizeVector(element_shape_key);
                     SizeVector element_shape_value_sv =
                             PyHandleToSizeVector(element_shape_value);
                     return Hashmap(init_capacity, dtype_key, dtype_value,
                                    element_shape_key_sv, element_shape_value_sv,
-                                   device);
+                                   device, backend);
                 }),
                 "init_capacity"_a, "dtype_key"_a, "dtype_value"_a,
                 "element_shape_key"_a = SizeVector({1}),
                 "element_shape_value"_a = SizeVector({1}),
-                "device"_a = Device("CPU:0"));
+                "device"_a = Device("CPU:0"),
+                "backend"_a = HashmapBackend::Default);
 
     hashmap.def("insert",
                 [](Hashmap& h, const Tensor& keys, const Tensor& values) {
@@ -107,6 +117,90 @@ void pybind_core_hashmap(py::module& m) {
     hashmap.def("clone", &Hashmap::Clone);
     hashmap.def("cpu", &Hashmap::CPU);
     hashmap.def("cuda", &Hashmap::CUDA, "device_id"_a = 0);
+
+    hashmap.def("save", &Hashmap::Save, "file_name"_a);
+    hashmap.def_static("load", &Hashmap::Load, "file_name"_a,
+                       "device"_a = Device("CPU:0"), "memory_mapped"_a = false,
+                       "backend"_a = HashmapBackend::Default);
+
+    py::class_<MultiValueHashmap> multi_value_hashmap(
+            m, "MultiValueHashmap",
+            "A MultiValueHashmap maps a key to several named values, each "
+            "stored in its own Tensor buffer.");
+
+    multi_value_hashmap.def(
+            py::init([](int64_t init_capacity, const Dtype& dtype_key,
+                        const py::handle& element_shape_key,
+                        const std::vector<std::string>& value_names,
+                        const std::vector<Dtype>& dtypes_value,
+                        const std::vector<py::handle>& element_shapes_value,
+                        const Device& device, const HashmapBackend& backend) {
+                std::vector<SizeVector> element_shapes_value_sv;
+                for (const py::handle& shape : element_shapes_value) {
+                    element_shapes_value_sv.push_back(
+                            PyHandleToSizeVector(shape));
+                }
+                return MultiValueHashmap(
+                        init_capacity, dtype_key,
+                        PyHandleToSizeVector(element_shape_key), value_names,
+                        dtypes_value, element_shapes_value_sv, device,
+                        backend);
+            }),
+            "init_capacity"_a, "dtype_key"_a, "element_shape_key"_a,
+            "value_names"_a, "dtypes_value"_a, "element_shapes_value"_a,
+            "device"_a = Device("CPU:0"),
+            "backend"_a = HashmapBackend::Default);
+
+    multi_value_hashmap.def("insert", [](MultiValueHashmap& h,
+                                         const Tensor& keys,
+                                         const std::vector<Tensor>& values) {
+        Tensor addrs, masks;
+        h.Insert(keys, values, addrs, masks);
+        return py::make_tuple(addrs, masks);
+    });
+
+    multi_value_hashmap.def("activate",
+                            [](MultiValueHashmap& h, const Tensor& keys) {
+                                Tensor addrs, masks;
+                                h.Activate(keys, addrs, masks);
+                                return py::make_tuple(addrs, masks);
+                            });
+
+    multi_value_hashmap.def("find",
+                            [](MultiValueHashmap& h, const Tensor& keys) {
+                                Tensor addrs, masks;
+                                h.Find(keys, addrs, masks);
+                                return py::make_tuple(addrs, masks);
+                            });
+
+    multi_value_hashmap.def("erase",
+                            [](MultiValueHashmap& h, const Tensor& keys) {
+                                Tensor masks;
+                                h.Erase(keys, masks);
+                                return masks;
+                            });
+
+    multi_value_hashmap.def("get_active_addrs", [](MultiValueHashmap& h) {
+        Tensor addrs;
+        h.GetActiveIndices(addrs);
+        return addrs;
+    });
+
+    multi_value_hashmap.def("get_key_tensor",
+                            &MultiValueHashmap::GetKeyTensor);
+    multi_value_hashmap.def("get_value_tensor",
+                            &MultiValueHashmap::GetValueTensor, "name"_a);
+    multi_value_hashmap.def("get_value_names",
+                            &MultiValueHashmap::GetValueNames);
+
+    multi_value_hashmap.def("reserve", &MultiValueHashmap::Reserve,
+                            "capacity"_a);
+    multi_value_hashmap.def("size", &MultiValueHashmap::Size);
+    multi_value_hashmap.def("capacity", &MultiValueHashmap::GetCapacity);
+
+    multi_value_hashmap.def("to", &MultiValueHashmap::To, "device"_a,
+                            "copy"_a = false);
+    multi_value_hashmap.def("clone", &MultiValueHashmap::Clone);
 }
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Profiler.h"
+
+#include "pybind/core/core.h"
+
+namespace open3d {
+namespace core {
+
+void pybind_core_profiler(py::module &m) {
+    py::module m_profiler = m.def_submodule("profiler");
+
+    m_profiler.def("enable", &Profiler::Enable,
+                   "Starts recording the kernel ops.");
+    m_profiler.def("disable", &Profiler::Disable,
+                   "Stops recording the kernel ops.");
+    m_profiler.def("is_enabled", &Profiler::IsEnabled);
+    m_profiler.def("reset", &Profiler::Reset,
+                   "Discards the recorded ops and restarts the clock.");
+    m_profiler.def("summary", &Profiler::GetSummary,
+                   "Returns a table of the recorded ops aggregated by name.");
+    m_profiler.def("to_chrome_trace", &Profiler::ToChromeTrace,
+                   "Returns the recorded ops as Chrome trace event JSON.");
+    m_profiler.def("save_chrome_trace", &Profiler::SaveChromeTrace,
+                   "file_name"_a,
+                   "Writes the recorded ops as Chrome trace event JSON, which "
+                   "can be opened in chrome://tracing or Perfetto.");
+}
+
+}  // namespace core
+}  // namespace open3d
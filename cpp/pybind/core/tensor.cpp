@@ -82,6 +82,41 @@
                 .cpp_name(self);                                          \
     });
 
+#define BIND_BINARY_OUT_OP(py_name, cpp_name)                             \
+    tensor.def(                                                           \
+            #py_name,                                                     \
+            [](const Tensor& self, const Tensor& other, Tensor& out) {    \
+                self.cpp_name(other, out);                                \
+                return out;                                               \
+            },                                                            \
+            "other"_a, "out"_a);                                          \
+    tensor.def(                                                           \
+            #py_name,                                                     \
+            [](const Tensor& self, int64_t value, Tensor& out) {          \
+                self.cpp_name(value, out);                                \
+                return out;                                               \
+            },                                                            \
+            "value"_a, "out"_a);                                          \
+    tensor.def(                                                           \
+            #py_name,                                                     \
+            [](const Tensor& self, double value, Tensor& out) {           \
+                self.cpp_name(value, out);                                \
+                return out;                                               \
+            },                                                            \
+            "value"_a, "out"_a);
+
+#define BIND_UNARY_OP(py_name, cpp_name)                            \
+    tensor.def(#py_name,                                            \
+               py::overload_cast<>(&Tensor::cpp_name, py::const_)); \
+    tensor.def(#py_name "_", &Tensor::cpp_name##_);                 \
+    tensor.def(                                                     \
+            #py_name,                                               \
+            [](const Tensor& self, Tensor& out) {                   \
+                self.cpp_name(out);                                 \
+                return out;                                         \
+            },                                                      \
+            "out"_a);
+
 #define BIND_REDUCTION_OP(py_name, cpp_name)                            \
     tensor.def(                                                         \
             #py_name,                                                   \
@@ -397,6 +432,10 @@ void pybind_core_tensor(py::module& m) {
     // Numpy IO.
     tensor.def("save", &Tensor::Save);
     tensor.def_static("load", &Tensor::Load);
+    tensor.def_static("load_memory_mapped", &Tensor::LoadMemoryMapped);
+    tensor.def_static("save_npz", &Tensor::SaveNpz, "file_name"_a, "tensors"_a);
+    tensor.def_static("load_npz", &Tensor::LoadNpz, "file_name"_a,
+                      "memory_mapped"_a = false);
 
     /// Linalg operations.
     tensor.def("matmul", &Tensor::Matmul);
@@ -434,6 +473,7 @@ void pybind_core_tensor(py::module& m) {
     //
     // BinaryEW: add.
     BIND_BINARY_OP_ALL_DTYPES(add, Add, CONST_ARG);
+    BIND_BINARY_OUT_OP(add, Add);
     BIND_BINARY_OP_ALL_DTYPES(add_, Add_, NON_CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__add__, Add, CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__iadd__, Add_, NON_CONST_ARG);
@@ -441,6 +481,7 @@ void pybind_core_tensor(py::module& m) {
 
     // BinaryEW: sub.
     BIND_BINARY_OP_ALL_DTYPES(sub, Sub, CONST_ARG);
+    BIND_BINARY_OUT_OP(sub, Sub);
     BIND_BINARY_OP_ALL_DTYPES(sub_, Sub_, NON_CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__sub__, Sub, CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__isub__, Sub_, NON_CONST_ARG);
@@ -448,6 +489,7 @@ void pybind_core_tensor(py::module& m) {
 
     // BinaryEW: mul.
     BIND_BINARY_OP_ALL_DTYPES(mul, Mul, CONST_ARG);
+    BIND_BINARY_OUT_OP(mul, Mul);
     BIND_BINARY_OP_ALL_DTYPES(mul_, Mul_, NON_CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__mul__, Mul, CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__imul__, Mul_, NON_CONST_ARG);
@@ -455,6 +497,7 @@ void pybind_core_tensor(py::module& m) {
 
     // BinaryEW: div.
     BIND_BINARY_OP_ALL_DTYPES(div, Div, CONST_ARG);
+    BIND_BINARY_OUT_OP(div, Div);
     BIND_BINARY_OP_ALL_DTYPES(div_, Div_, NON_CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__div__, Div, CONST_ARG);
     BIND_BINARY_OP_ALL_DTYPES(__idiv__, Div_, NON_CONST_ARG);
@@ -522,22 +565,16 @@ void pybind_core_tensor(py::module& m) {
     tensor.def("__bool__", &Tensor::IsNonZero);  // Python 3.X.
 
     // Unary element-wise ops.
-    tensor.def("sqrt", &Tensor::Sqrt);
-    tensor.def("sqrt_", &Tensor::Sqrt_);
-    tensor.def("sin", &Tensor::Sin);
-    tensor.def("sin_", &Tensor::Sin_);
-    tensor.def("cos", &Tensor::Cos);
-    tensor.def("cos_", &Tensor::Cos_);
-    tensor.def("neg", &Tensor::Neg);
-    tensor.def("neg_", &Tensor::Neg_);
-    tensor.def("exp", &Tensor::Exp);
-    tensor.def("exp_", &Tensor::Exp_);
-    tensor.def("abs", &Tensor::Abs);
-    tensor.def("abs_", &Tensor::Abs_);
-    tensor.def("floor", &Tensor::Floor);
-    tensor.def("ceil", &Tensor::Ceil);
-    tensor.def("round", &Tensor::Round);
-    tensor.def("trunc", &Tensor::Trunc);
+    BIND_UNARY_OP(sqrt, Sqrt);
+    BIND_UNARY_OP(sin, Sin);
+    BIND_UNARY_OP(cos, Cos);
+    BIND_UNARY_OP(neg, Neg);
+    BIND_UNARY_OP(exp, Exp);
+    BIND_UNARY_OP(abs, Abs);
+    BIND_UNARY_OP(floor, Floor);
+    BIND_UNARY_OP(ceil, Ceil);
+    BIND_UNARY_OP(round, Round);
+    BIND_UNARY_OP(trunc, Trunc);
     tensor.def("logical_not", &Tensor::LogicalNot);
     tensor.def("logical_not_", &Tensor::LogicalNot_);
 
@@ -552,6 +589,17 @@ void pybind_core_tensor(py::module& m) {
                 }
             },
             "as_tuple"_a = false);
+    tensor.def("masked_select", &Tensor::MaskedSelect, "mask"_a);
+    tensor.def("index_add_", &Tensor::IndexAdd_, "dim"_a, "index"_a, "src"_a);
+    tensor.def("index_max_", &Tensor::IndexMax_, "dim"_a, "index"_a, "src"_a);
+
+    // Sorting.
+    tensor.def("sort", &Tensor::Sort);
+    tensor.def("argsort", &Tensor::ArgSort);
+    tensor.def("unique", &Tensor::Unique);
+    tensor.def("segment_sum", &Tensor::SegmentSum, "row_splits"_a);
+    tensor.def("segment_mean", &Tensor::SegmentMean, "row_splits"_a);
+    tensor.def("segment_max", &Tensor::SegmentMax, "row_splits"_a);
     tensor.def("all", &Tensor::All);
     tensor.def("any", &Tensor::Any);
 
@@ -594,6 +642,10 @@ void pybind_core_tensor(py::module& m) {
             return py::int_(tensor.Item<uint16_t>());
         } else if (dtype == Dtype::Bool) {
             return py::bool_(tensor.Item<bool>());
+        } else if (dtype == Dtype::Float16) {
+            return py::float_(static_cast<float>(tensor.Item<Float16>()));
+        } else if (dtype == Dtype::BFloat16) {
+            return py::float_(static_cast<float>(tensor.Item<BFloat16>()));
         } else {
             utility::LogError(
                     "Tensor.item(): unsupported dtype to convert to python.");
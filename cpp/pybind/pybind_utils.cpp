@@ -63,6 +63,9 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
     } else if (format == py::format_descriptor<bool>::format() &&
                byte_size == 1) {
         return core::Dtype::Bool;
+    } else if (format == "e" && byte_size == 2) {
+        // Half precision float. NumPy has no bfloat16 format.
+        return core::Dtype::Float16;
     } else {
         utility::LogError(
                 "ArrayFormatToDtype: unsupported python array format {} with "
@@ -86,6 +89,8 @@ std::string DtypeToArrayFormat(const core::Dtype& dtype) {
         return py::format_descriptor<uint16_t>::format();
     } else if (dtype == core::Dtype::Bool) {
         return py::format_descriptor<bool>::format();
+    } else if (dtype == core::Dtype::Float16) {
+        return "e";
     } else {
         utility::LogError("Unsupported data type.");
     }
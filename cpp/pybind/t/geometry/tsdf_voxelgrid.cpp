@@ -39,6 +39,14 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             m, "TSDFVoxelGrid",
             "A voxel grid for TSDF and/or color integration.");
 
+    py::enum_<TSDFVoxelGrid::SurfaceMaskCode>(
+            tsdf_voxelgrid, "SurfaceMaskCode", py::arithmetic(),
+            "Bit masks of the maps rendered by ray_cast.")
+            .value("VertexMap", TSDFVoxelGrid::SurfaceMaskCode::VertexMap)
+            .value("DepthMap", TSDFVoxelGrid::SurfaceMaskCode::DepthMap)
+            .value("ColorMap", TSDFVoxelGrid::SurfaceMaskCode::ColorMap)
+            .value("NormalMap", TSDFVoxelGrid::SurfaceMaskCode::NormalMap);
+
     // Constructors.
     tsdf_voxelgrid.def(
             py::init<const std::unordered_map<std::string, core::Dtype>&, float,
@@ -63,6 +71,11 @@ void pybind_tsdf_voxelgrid(py::module& m) {
                               const core::Tensor&, float, float>(
                     &TSDFVoxelGrid::Integrate));
 
+    tsdf_voxelgrid.def("set_incremental_integration",
+                       &TSDFVoxelGrid::SetIncrementalIntegration, "enable"_a,
+                       "history"_a = 3, "max_translation"_a = 0.01f,
+                       "max_rotation"_a = 0.02f);
+
     tsdf_voxelgrid.def("extract_surface_points",
                        &TSDFVoxelGrid::ExtractSurfacePoints,
                        "weight_threshold"_a = 3.0f);
@@ -70,6 +83,36 @@ void pybind_tsdf_voxelgrid(py::module& m) {
                        &TSDFVoxelGrid::ExtractSurfaceMesh,
                        "weight_threshold"_a = 3.0f);
 
+    // Eigen keys are not hashable in Python, key the patches by tuples.
+    tsdf_voxelgrid.def(
+            "extract_surface_mesh_patches",
+            [](TSDFVoxelGrid& voxel_grid, float weight_threshold) {
+                py::dict patches;
+                for (auto& kv :
+                     voxel_grid.ExtractSurfaceMeshPatches(weight_threshold)) {
+                    patches[py::make_tuple(kv.first(0), kv.first(1),
+                                           kv.first(2))] = kv.second;
+                }
+                return patches;
+            },
+            "weight_threshold"_a = 3.0f);
+    tsdf_voxelgrid.def("stitch_surface_mesh_patches",
+                       &TSDFVoxelGrid::StitchSurfaceMeshPatches);
+
+    tsdf_voxelgrid.def(
+            "ray_cast", &TSDFVoxelGrid::RayCast, "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0f,
+            "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
+            "weight_threshold"_a = 3.0f,
+            "ray_cast_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                TSDFVoxelGrid::SurfaceMaskCode::NormalMap);
+
+    tsdf_voxelgrid.def("enable_streaming", &TSDFVoxelGrid::EnableStreaming,
+                       "directory"_a, "radius"_a, "cell_size"_a = 4);
+    tsdf_voxelgrid.def("disable_streaming", &TSDFVoxelGrid::DisableStreaming);
+    tsdf_voxelgrid.def("get_num_stored_blocks",
+                       &TSDFVoxelGrid::GetNumStoredBlocks);
+
     tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To, "device"_a, "copy"_a = false);
     tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone);
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
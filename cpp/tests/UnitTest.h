@@ -45,6 +45,7 @@
 #include "tests/test_utility/Rand.h"
 #include "tests/test_utility/Raw.h"
 #include "tests/test_utility/Sort.h"
+#include "tests/test_utility/TemporaryDirectory.h"
 
 // GPU_CONDITIONAL_COMPILE_STR is "" if gpu is available, otherwise "DISABLED_"
 // The GPU_CONDITIONAL_COMPILE_STR value is configured in CMake
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/CPUExecutor.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Forwards to another executor and counts the loops it runs.
+class CountingExecutor : public core::CPUExecutor {
+public:
+    explicit CountingExecutor(std::shared_ptr<core::CPUExecutor> executor)
+        : executor_(executor) {}
+
+    int64_t GetNumThreads() const override {
+        return executor_->GetNumThreads();
+    }
+    bool InParallel() const override { return executor_->InParallel(); }
+    void ParallelFor(
+            int64_t n,
+            int64_t grain_size,
+            const std::function<void(int64_t, int64_t)>& func) override {
+        num_loops_++;
+        executor_->ParallelFor(n, grain_size, func);
+    }
+
+    int64_t GetNumLoops() const { return num_loops_; }
+
+private:
+    std::shared_ptr<core::CPUExecutor> executor_;
+    std::atomic<int64_t> num_loops_{0};
+};
+
+static std::vector<std::shared_ptr<core::CPUExecutor>> MakeExecutors() {
+    return {std::make_shared<core::OpenMPExecutor>(),
+            std::make_shared<core::ThreadPoolExecutor>(4),
+            std::make_shared<core::ThreadPoolExecutor>(1),
+            std::make_shared<core::TBBExecutor>()};
+}
+
+// Runs a loop over n elements and checks that every index is visited once
+// and that all but the last range have at least grain_size elements.
+static void CheckCoverage(core::CPUExecutor& executor,
+                          int64_t n,
+                          int64_t grain_size) {
+    std::vector<std::atomic<int>> visits(n);
+    for (auto& visit : visits) {
+        visit = 0;
+    }
+    std::atomic<int64_t> num_small_ranges(0);
+    executor.ParallelFor(n, grain_size, [&](int64_t start, int64_t end) {
+        EXPECT_LT(start, end);
+        if (end - start < grain_size) {
+            num_small_ranges++;
+        }
+        for (int64_t i = start; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+    }
+    EXPECT_LE(num_small_ranges, 1);
+}
+
+TEST(CPUExecutor, Coverage) {
+    for (auto& executor : MakeExecutors()) {
+        EXPECT_GE(executor->GetNumThreads(), 1);
+        EXPECT_FALSE(executor->InParallel());
+        CheckCoverage(*executor, 1, 1);
+        CheckCoverage(*executor, 1000, 1);
+        CheckCoverage(*executor, 100003, 4096);
+        CheckCoverage(*executor, 100, 1000);
+    }
+}
+
+TEST(CPUExecutor, Nested) {
+    for (auto& executor : MakeExecutors()) {
+        const int64_t outer = 16;
+        const int64_t inner = 1000;
+        std::vector<std::atomic<int>> visits(outer * inner);
+        for (auto& visit : visits) {
+            visit = 0;
+        }
+        executor->ParallelFor(outer, 1, [&](int64_t start, int64_t end) {
+            if (executor->GetNumThreads() > 1) {
+                EXPECT_TRUE(executor->InParallel());
+            }
+            for (int64_t i = start; i < end; ++i) {
+                executor->ParallelFor(
+                        inner, 10, [&](int64_t inner_start, int64_t inner_end) {
+                            for (int64_t j = inner_start; j < inner_end; ++j) {
+                                visits[i * inner + j]++;
+                            }
+                        });
+            }
+        });
+        for (auto& visit : visits) {
+            ASSERT_EQ(visit, 1);
+        }
+    }
+}
+
+TEST(CPUExecutor, ConcurrentCallers) {
+    core::ThreadPoolExecutor executor(4);
+    const int num_callers = 4;
+    const int64_t n = 50000;
+    std::vector<int64_t> sums(num_callers, 0);
+    std::vector<std::thread> callers;
+    for (int c = 0; c < num_callers; ++c) {
+        callers.emplace_back([&, c]() {
+            for (int repeat = 0; repeat < 20; ++repeat) {
+                std::atomic<int64_t> sum(0);
+                executor.ParallelFor(n, 100, [&](int64_t start, int64_t end) {
+                    int64_t local_sum = 0;
+                    for (int64_t i = start; i < end; ++i) {
+                        local_sum += i;
+                    }
+                    sum += local_sum;
+                });
+                sums[c] = sum;
+                if (sums[c] != n * (n - 1) / 2) {
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (int c = 0; c < num_callers; ++c) {
+        EXPECT_EQ(sums[c], n * (n - 1) / 2);
+    }
+}
+
+TEST(CPUExecutor, Exceptions) {
+    core::ThreadPoolExecutor executor(4);
+    EXPECT_THROW(executor.ParallelFor(1000, 1,
+                                      [](int64_t start, int64_t end) {
+                                          if (start <= 500 && 500 < end) {
+                                              throw std::runtime_error("500");
+                                          }
+                                      }),
+                 std::runtime_error);
+
+    // The pool stays usable.
+    CheckCoverage(executor, 10000, 100);
+}
+
+TEST(CPUExecutor, SetCPUExecutor) {
+    std::shared_ptr<core::CPUExecutor> default_executor =
+            core::GetCPUExecutor();
+    auto counting = std::make_shared<CountingExecutor>(
+            std::make_shared<core::ThreadPoolExecutor>(3));
+    core::SetCPUExecutor(counting);
+    EXPECT_EQ(core::GetCPUExecutor(), counting);
+
+    const int64_t n = 1 << 20;
+    core::Device device("CPU:0");
+    core::Tensor a = core::Tensor::Ones({n}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Full({n}, 2, core::Dtype::Float32, device);
+    core::Tensor c = a + b;
+    EXPECT_GT(counting->GetNumLoops(), 0);
+    EXPECT_TRUE(c.AllClose(
+            core::Tensor::Full({n}, 3, core::Dtype::Float32, device)));
+
+    int64_t num_loops = counting->GetNumLoops();
+    core::Tensor sum = c.Sum({0});
+    EXPECT_GT(counting->GetNumLoops(), num_loops);
+    EXPECT_FLOAT_EQ(sum.Item<float>(), 3.0f * n);
+
+    core::Tensor index =
+            core::Tensor::Arange(0, n, 2, core::Dtype::Int64, device);
+    EXPECT_TRUE(c.IndexGet({index}).AllClose(core::Tensor::Full(
+            {n / 2}, 3, core::Dtype::Float32, device)));
+
+    core::SetCPUExecutor(nullptr);
+    EXPECT_NE(core::GetCPUExecutor(), counting);
+    EXPECT_EQ(typeid(*core::GetCPUExecutor()), typeid(*default_executor));
+
+    num_loops = counting->GetNumLoops();
+    c = a + b;
+    EXPECT_EQ(counting->GetNumLoops(), num_loops);
+}
+
+}  // namespace tests
+}  // namespace open3d
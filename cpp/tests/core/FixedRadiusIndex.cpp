@@ -26,8 +26,12 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <tuple>
+#include <utility>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
@@ -38,7 +42,7 @@
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
+TEST(FixedRadiusIndex, CUDA_CONDITIONAL_TEST(SearchRadius)) {
     core::Device device = core::Device("CUDA:0");
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
@@ -68,5 +72,102 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST(FixedRadiusIndex, SearchRadiusCPU) {
+    core::Device device = core::Device("CPU:0");
+
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    float radius = 0.1;
+    core::nns::FixedRadiusIndex index(ref, radius);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    EXPECT_THROW(index.SearchRadius(query, -1.0), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, 0.0), std::runtime_error);
+    // The cells are too small for a larger radius.
+    EXPECT_THROW(index.SearchRadius(query, 0.2), std::runtime_error);
+
+    std::tuple<core::Tensor, core::Tensor, core::Tensor> result =
+            index.SearchRadius(query, radius);
+    core::Tensor indices = std::get<0>(result);
+    core::Tensor distances = std::get<1>(result);
+    core::Tensor num_neighbors = std::get<2>(result);
+    EXPECT_EQ(indices.GetDtype(), core::Dtype::Int64);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938}));
+    ExpectEQ(num_neighbors.ToFlatVector<int64_t>(), std::vector<int64_t>({2}));
+
+    // Smaller radii reuse the cells of the index.
+    result = index.SearchRadius(query, 0.08);
+    ExpectEQ(std::get<0>(result).ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1}));
+
+    // No queries.
+    result = index.SearchRadius(
+            core::Tensor::Empty({0, 3}, core::Dtype::Float32, device), radius);
+    EXPECT_EQ(std::get<0>(result).GetLength(), 0);
+    EXPECT_EQ(std::get<2>(result).GetLength(), 0);
+}
+
+TEST(FixedRadiusIndex, SearchRadiusCPUBruteForce) {
+    core::Device device = core::Device("CPU:0");
+    const int num_points = 2000;
+    const int num_queries = 300;
+    const double radius = 0.15;
+
+    // Some points are outside of the unit cube to get negative voxel indices.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-0.3, 1.0);
+    std::vector<double> points(num_points * 3);
+    for (double &x : points) {
+        x = uniform(rng);
+    }
+    std::vector<double> queries(num_queries * 3);
+    for (double &x : queries) {
+        x = uniform(rng);
+    }
+    core::Tensor dataset(points, {num_points, 3}, core::Dtype::Float64, device);
+    core::Tensor query(queries, {num_queries, 3}, core::Dtype::Float64, device);
+
+    core::nns::FixedRadiusIndex index(dataset, radius);
+    core::Tensor indices, distances, num_neighbors;
+    std::tie(indices, distances, num_neighbors) =
+            index.SearchRadius(query, radius);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<double> distances_vec = distances.ToFlatVector<double>();
+    std::vector<int64_t> num_neighbors_vec =
+            num_neighbors.ToFlatVector<int64_t>();
+
+    int64_t offset = 0;
+    for (int q = 0; q < num_queries; ++q) {
+        std::vector<std::pair<double, int64_t>> expected;
+        for (int p = 0; p < num_points; ++p) {
+            double dist = 0;
+            for (int d = 0; d < 3; ++d) {
+                double diff = points[p * 3 + d] - queries[q * 3 + d];
+                dist += diff * diff;
+            }
+            if (dist <= radius * radius) {
+                expected.emplace_back(dist, p);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        ASSERT_EQ(num_neighbors_vec[q], int64_t(expected.size()));
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(indices_vec[offset + k], expected[k].second);
+            EXPECT_DOUBLE_EQ(distances_vec[offset + k], expected[k].first);
+        }
+        offset += expected.size();
+    }
+    EXPECT_EQ(offset, indices.GetLength());
+    EXPECT_GT(offset, num_queries);
+}
+
 }  // namespace tests
 }  // namespace open3d
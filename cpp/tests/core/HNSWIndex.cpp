@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/HNSWIndex.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Points around a few cluster centers, like descriptors of similar surfaces.
+static std::vector<float> ClusteredPoints(int n, int dimension, int seed) {
+    std::mt19937 center_rng(0);
+    std::uniform_real_distribution<float> uniform(0.0, 1.0);
+    std::vector<float> centers(20 * dimension);
+    for (auto &c : centers) {
+        c = uniform(center_rng);
+    }
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> normal(0.0, 0.05);
+    std::vector<float> points(n * dimension);
+    for (int i = 0; i < n; ++i) {
+        int center = i % 20;
+        for (int d = 0; d < dimension; ++d) {
+            points[i * dimension + d] =
+                    centers[center * dimension + d] + normal(rng);
+        }
+    }
+    return points;
+}
+
+// Fraction of the true knn found.
+static double Recall(const std::vector<float> &points,
+                     const std::vector<float> &queries,
+                     int dimension,
+                     int knn,
+                     const std::vector<int64_t> &indices) {
+    int num_points = int(points.size()) / dimension;
+    int num_queries = int(queries.size()) / dimension;
+    int64_t found = 0;
+    for (int i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<float, int64_t>> all;
+        for (int j = 0; j < num_points; ++j) {
+            float dist = 0;
+            for (int d = 0; d < dimension; ++d) {
+                float diff = queries[i * dimension + d] -
+                             points[j * dimension + d];
+                dist += diff * diff;
+            }
+            all.emplace_back(dist, j);
+        }
+        std::partial_sort(all.begin(), all.begin() + knn, all.end());
+        for (int k = 0; k < knn; ++k) {
+            auto begin = indices.begin() + i * knn;
+            if (std::find(begin, begin + knn, all[k].second) != begin + knn) {
+                ++found;
+            }
+        }
+    }
+    return double(found) / (num_queries * knn);
+}
+
+TEST(HNSWIndex, SearchKnn) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::HNSWIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, 0.1), std::runtime_error);
+    EXPECT_THROW(index.SetEfSearch(0), std::runtime_error);
+
+    // Small datasets are searched exhaustively.
+    core::Tensor indices;
+    core::Tensor distances;
+    std::tie(indices, distances) = index.SearchKnn(query, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    std::tie(indices, distances) = index.SearchKnn(query, 12);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 10}));
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+
+    // Neighbors beyond the radius are -1.
+    std::tie(indices, distances) = index.SearchHybrid(query, 0.1, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, -1}));
+}
+
+TEST(HNSWIndex, Recall) {
+    const int dimension = 33;
+    const int knn = 10;
+    std::vector<float> points = ClusteredPoints(5000, dimension, 0);
+    std::vector<float> queries = ClusteredPoints(200, dimension, 1);
+    core::Tensor ref(points, {5000, dimension}, core::Dtype::Float32);
+    core::Tensor query(queries, {200, dimension}, core::Dtype::Float32);
+    core::nns::HNSWIndex index(ref, 12, 100);
+
+    index.SetEfSearch(16);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query, knn);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({200, knn}));
+    double low_recall = Recall(points, queries, dimension, knn,
+                               indices.ToFlatVector<int64_t>());
+
+    index.SetEfSearch(200);
+    std::tie(indices, distances) = index.SearchKnn(query, knn);
+    double high_recall = Recall(points, queries, dimension, knn,
+                                indices.ToFlatVector<int64_t>());
+    EXPECT_GE(high_recall, 0.98);
+    EXPECT_GE(high_recall, low_recall);
+
+    // Results are sorted by distance.
+    std::vector<float> dists = distances.ToFlatVector<float>();
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_TRUE(std::is_sorted(dists.begin() + i * knn,
+                                   dists.begin() + (i + 1) * knn));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -321,5 +321,282 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+static std::vector<core::HashmapBackend> BackendsForDevice(
+        const core::Device &device) {
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        return {core::HashmapBackend::TBB,
+                core::HashmapBackend::LinearProbing};
+    }
+    return {core::HashmapBackend::Slab};
+}
+
+TEST_P(HashmapPermuteDevices, SaveLoad) {
+    core::Device device = GetParam();
+    TemporaryDirectory directory("hashmap_test");
+    const std::string file_name = directory.GetFilePath("hashmap.npz");
+    const int n = 10000;
+    const int slots = 1023;
+
+    HashData<int3, int> data(n, slots);
+    std::vector<int> keys_int3(reinterpret_cast<int *>(data.keys_.data()),
+                               reinterpret_cast<int *>(data.keys_.data()) +
+                                       3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+    // Primitive int3 keys and the same keys as an object dtype.
+    core::Dtype dtype_int3(core::Dtype::DtypeCode::Object, 12, "int3");
+    for (const core::Dtype &dtype_key : {core::Dtype::Int32, dtype_int3}) {
+        core::SizeVector shape_key =
+                dtype_key.IsObject() ? core::SizeVector{1}
+                                     : core::SizeVector{3};
+        core::Hashmap hashmap(n, dtype_key, core::Dtype::Int32, shape_key,
+                              {1}, device);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        core::Tensor erase_masks;
+        hashmap.Erase(keys.Slice(0, 0, 100), erase_masks);
+        hashmap.Save(file_name);
+
+        for (bool memory_mapped : {false, true}) {
+            core::Hashmap loaded = core::Hashmap::Load(file_name, device,
+                                                       memory_mapped);
+            EXPECT_EQ(loaded.GetDevice(), device);
+            EXPECT_EQ(loaded.GetCapacity(), hashmap.GetCapacity());
+            EXPECT_EQ(loaded.Size(), hashmap.Size());
+            EXPECT_EQ(loaded.GetKeyDtype(), dtype_key);
+
+            core::Tensor expected_addrs, expected_masks;
+            hashmap.Find(keys, expected_addrs, expected_masks);
+            loaded.Find(keys, addrs, masks);
+            EXPECT_EQ(masks.ToFlatVector<bool>(),
+                      expected_masks.ToFlatVector<bool>());
+
+            core::Tensor found = masks;
+            core::Tensor expected_values =
+                    hashmap.GetValueTensor()
+                            .IndexGet({expected_addrs.To(core::Dtype::Int64)})
+                            .IndexGet({found});
+            core::Tensor loaded_values =
+                    loaded.GetValueTensor()
+                            .IndexGet({addrs.To(core::Dtype::Int64)})
+                            .IndexGet({found});
+            EXPECT_TRUE(loaded_values.AllClose(expected_values));
+
+            // The saved index is attached on the CPU, which preserves the
+            // buffer addresses.
+            if (device.GetType() == core::Device::DeviceType::CPU) {
+                EXPECT_EQ(addrs.IndexGet({found}).ToFlatVector<int>(),
+                          expected_addrs.IndexGet({found}).ToFlatVector<int>());
+            }
+        }
+
+        // Changes to a mapped hashmap are not written back to the file.
+        core::Hashmap mapped = core::Hashmap::Load(file_name, device, true);
+        mapped.Erase(keys, masks);
+        EXPECT_EQ(mapped.Size(), 0);
+        mapped.Insert(keys.Slice(0, 0, 10), values.Slice(0, 0, 10), addrs,
+                      masks);
+        EXPECT_EQ(mapped.Size(), 10);
+        core::Hashmap reloaded = core::Hashmap::Load(file_name, device, true);
+        EXPECT_EQ(reloaded.Size(), hashmap.Size());
+        core::Tensor expected_addrs, expected_masks;
+        hashmap.Find(keys, expected_addrs, expected_masks);
+        reloaded.Find(keys, addrs, masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(),
+                  expected_masks.ToFlatVector<bool>());
+    }
+
+    // Backends without an index save the active entries only.
+    for (const core::HashmapBackend &backend : BackendsForDevice(device)) {
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {3},
+                              {1}, device, backend);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        hashmap.Save(file_name);
+        core::Hashmap loaded = core::Hashmap::Load(file_name, device, true);
+        EXPECT_EQ(loaded.Size(), hashmap.Size());
+        loaded.Find(keys, addrs, masks);
+        EXPECT_TRUE(masks.All());
+    }
+
+    // A saved index that cannot be attached, e.g. by another backend, is
+    // loaded by inserting its active entries, which erasing leaves in no
+    // particular order.
+    {
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {3},
+                              {1}, core::Device("CPU:0"),
+                              core::HashmapBackend::LinearProbing);
+        core::Device host("CPU:0");
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys.To(host), values.To(host), addrs, masks);
+        hashmap.Erase(keys.Slice(0, 0, n, 3).To(host), masks);
+        hashmap.Save(file_name);
+
+        core::Tensor expected_addrs, expected_masks;
+        hashmap.Find(keys.To(host), expected_addrs, expected_masks);
+        core::Tensor expected_values =
+                hashmap.GetValueTensor()
+                        .IndexGet({expected_addrs.To(core::Dtype::Int64)})
+                        .IndexGet({expected_masks});
+        for (const core::HashmapBackend &backend : BackendsForDevice(device)) {
+            core::Hashmap loaded =
+                    core::Hashmap::Load(file_name, device, false, backend);
+            EXPECT_EQ(loaded.Size(), hashmap.Size());
+            loaded.Find(keys, addrs, masks);
+            EXPECT_EQ(masks.ToFlatVector<bool>(),
+                      expected_masks.ToFlatVector<bool>());
+            core::Tensor loaded_values =
+                    loaded.GetValueTensor()
+                            .IndexGet({addrs.To(core::Dtype::Int64)})
+                            .IndexGet({masks})
+                            .To(host);
+            EXPECT_TRUE(loaded_values.AllClose(expected_values));
+        }
+    }
+
+    // Empty hashmaps round trip as well.
+    core::Hashmap empty(16, core::Dtype::Int64, core::Dtype::Float32, {1},
+                        {2}, device);
+    empty.Save(file_name);
+    core::Hashmap loaded = core::Hashmap::Load(file_name, device);
+    EXPECT_EQ(loaded.Size(), 0);
+    EXPECT_EQ(loaded.GetCapacity(), 16);
+    EXPECT_EQ(loaded.GetValueBytesize(), 8);
+
+    core::Hashmap empty_object(16, dtype_int3, core::Dtype::Int32, {1}, {1},
+                               device);
+    empty_object.Save(file_name);
+    loaded = core::Hashmap::Load(file_name, device);
+    EXPECT_EQ(loaded.GetKeyDtype(), dtype_int3);
+    EXPECT_EQ(loaded.GetKeyBytesize(), 12);
+
+    EXPECT_ANY_THROW(
+            core::Hashmap::Load(directory.GetFilePath("does_not_exist.npz")));
+}
+
+TEST_P(HashmapPermuteDevices, Backends) {
+    core::Device device = GetParam();
+    const int n = 100000;
+    const int slots = 4099;
+
+    for (core::HashmapBackend backend : BackendsForDevice(device)) {
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, backend);
+        EXPECT_EQ(hashmap.GetBackend(), backend);
+
+        HashData<int, int> data(n, slots);
+        core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+        core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+        // Duplicated keys in a batch are inserted exactly once.
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  slots);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        // Erase every other key, with duplicates.
+        std::vector<int> erase_keys_vec;
+        for (int i = 0; i < 2 * slots; ++i) {
+            erase_keys_vec.push_back((i % slots) / 2 * 2 * data.k_factor_);
+        }
+        core::Tensor erase_keys(erase_keys_vec,
+                                {static_cast<int64_t>(erase_keys_vec.size())},
+                                core::Dtype::Int32, device);
+        hashmap.Erase(erase_keys, masks);
+        int64_t num_erased = (slots + 1) / 2;
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  num_erased);
+        EXPECT_EQ(hashmap.Size(), slots - num_erased);
+
+        // Find all keys, only odd values remain.
+        hashmap.Find(keys, addrs, masks);
+        std::vector<bool> masks_vec = masks.ToFlatVector<bool>();
+        std::vector<int> addrs_vec =
+                addrs.To(core::Dtype::Int32).ToFlatVector<int>();
+        std::vector<int> buffer_values =
+                hashmap.GetValueTensor().ToFlatVector<int>();
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(masks_vec[i], data.vals_[i] % 2 == 1);
+            if (masks_vec[i]) {
+                EXPECT_EQ(buffer_values[addrs_vec[i]], data.vals_[i]);
+            }
+        }
+
+        // Reinsert everything, only the erased keys are new.
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                  num_erased);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        core::Tensor active_addrs;
+        hashmap.GetActiveIndices(active_addrs);
+        core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+        std::vector<int> active_values =
+                hashmap.GetValueTensor()
+                        .IndexGet({active_indices})
+                        .ToFlatVector<int>();
+        std::sort(active_values.begin(), active_values.end());
+        for (int i = 0; i < slots; ++i) {
+            EXPECT_EQ(active_values[i], i);
+        }
+    }
+}
+
+TEST(Hashmap, LinearProbingGrowth) {
+    core::Device device("CPU:0");
+    core::Hashmap hashmap(16, core::Dtype::Int32, core::Dtype::Int32, {3}, {1},
+                          device, core::HashmapBackend::LinearProbing);
+
+    // Insert in batches to trigger several resizes.
+    const int num_batches = 50;
+    const int batch_size = 997;
+    std::vector<core::Tensor> batch_keys;
+    std::vector<core::Tensor> batch_addrs;
+    for (int b = 0; b < num_batches; ++b) {
+        std::vector<int> keys_vec;
+        std::vector<int> values_vec;
+        for (int i = 0; i < batch_size; ++i) {
+            int k = b * batch_size + i;
+            keys_vec.insert(keys_vec.end(), {k, -k, k * 7});
+            values_vec.push_back(k);
+        }
+        core::Tensor keys(keys_vec, {batch_size, 3}, core::Dtype::Int32,
+                          device);
+        core::Tensor values(values_vec, {batch_size}, core::Dtype::Int32,
+                            device);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        EXPECT_TRUE(masks.All());
+        batch_keys.push_back(keys);
+        batch_addrs.push_back(addrs);
+    }
+    EXPECT_EQ(hashmap.Size(), num_batches * batch_size);
+    EXPECT_GE(hashmap.GetCapacity(), num_batches * batch_size);
+
+    // Buffer addresses are stable across resizes and rehashes.
+    hashmap.Rehash(hashmap.GetBucketCount() * 2);
+    for (int b = 0; b < num_batches; ++b) {
+        core::Tensor addrs, masks;
+        hashmap.Find(batch_keys[b], addrs, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_TRUE(addrs.AllClose(batch_addrs[b]));
+    }
+
+    // Repeated erase and insert leaves tombstones that must be recycled.
+    for (int round = 0; round < 20; ++round) {
+        core::Tensor addrs, masks;
+        hashmap.Erase(batch_keys[round % num_batches], masks);
+        EXPECT_TRUE(masks.All());
+        hashmap.Insert(batch_keys[round % num_batches],
+                       core::Tensor::Ones({batch_size}, core::Dtype::Int32,
+                                          device),
+                       addrs, masks);
+        EXPECT_TRUE(masks.All());
+    }
+    EXPECT_EQ(hashmap.Size(), num_batches * batch_size);
+}
+
 }  // namespace tests
 }  // namespace open3d
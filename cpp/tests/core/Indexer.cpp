@@ -189,5 +189,33 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, IsContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor input0({2, 3}, core::Dtype::Float32, device);
+    core::Tensor input1({1}, core::Dtype::Float32, device);
+    core::Tensor input2({3, 2}, core::Dtype::Float32, device);
+    core::Tensor input3({1, 3}, core::Dtype::Float32, device);
+    core::Tensor output({2, 3}, core::Dtype::Float32, device);
+
+    core::Indexer indexer({input0, input1, input2.T(), input3}, output);
+    EXPECT_TRUE(indexer.IsInputContiguous(0));
+    EXPECT_FALSE(indexer.IsInputScalar(0));
+    EXPECT_FALSE(indexer.IsInputContiguous(1));
+    EXPECT_TRUE(indexer.IsInputScalar(1));
+    EXPECT_FALSE(indexer.IsInputContiguous(2));
+    EXPECT_FALSE(indexer.IsInputScalar(2));
+    EXPECT_FALSE(indexer.IsInputContiguous(3));
+    EXPECT_FALSE(indexer.IsInputScalar(3));
+    EXPECT_TRUE(indexer.IsOutputContiguous());
+
+    // Sliced output.
+    core::Tensor output_large({2, 6}, core::Dtype::Float32, device);
+    core::Tensor output_sliced = output_large.Slice(1, 0, 3);
+    core::Indexer indexer_sliced({input0}, output_sliced);
+    EXPECT_TRUE(indexer_sliced.IsInputContiguous(0));
+    EXPECT_FALSE(indexer_sliced.IsOutputContiguous());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -33,6 +34,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
@@ -216,5 +218,276 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
         EXPECT_TRUE(std::abs(X_data[i] - X_gt[i]) < EPSILON);
     }
 }
+/// Batch of matrices with entries uniformly distributed in [-1, 1].
+static core::Tensor RandomMatrices(const core::SizeVector& shape,
+                                   const core::Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    std::vector<double> values(shape.NumElements());
+    for (auto& v : values) {
+        v = dist(rng);
+    }
+    return core::Tensor(values, shape, core::Dtype::Float64, device);
+}
+
+static void ExpectAllClose(const core::Tensor& A,
+                           const core::Tensor& B,
+                           double epsilon) {
+    EXPECT_EQ(A.GetShape(), B.GetShape());
+    std::vector<double> A_data =
+            A.To(core::Dtype::Float64).ToFlatVector<double>();
+    std::vector<double> B_data =
+            B.To(core::Dtype::Float64).ToFlatVector<double>();
+    for (size_t i = 0; i < A_data.size(); ++i) {
+        EXPECT_NEAR(A_data[i], B_data[i], epsilon);
+    }
+}
+
+TEST_P(LinalgPermuteDevices, BatchedMatmul) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {3, 4, 5, 6}) {
+        core::Tensor A = RandomMatrices({7, n, n}, device);
+        core::Tensor B = RandomMatrices({7, n, 2 * n}, device);
+        core::Tensor b = RandomMatrices({7, n}, device);
+        core::Tensor C, c;
+        core::BatchedMatmul(A, B, C);
+        core::BatchedMatmul(A, b, c);
+        EXPECT_EQ(C.GetShape(), core::SizeVector({7, n, 2 * n}));
+        EXPECT_EQ(c.GetShape(), core::SizeVector({7, n}));
+        for (int64_t i = 0; i < 7; ++i) {
+            ExpectAllClose(C[i], A[i].Matmul(B[i]), 1e-12);
+            ExpectAllClose(c[i], A[i].Matmul(b[i].Reshape({n, 1})).Reshape({n}),
+                           1e-12);
+        }
+    }
+
+    // Large matrices go through BLAS.
+    core::Tensor A = RandomMatrices({2, 40, 40}, device);
+    core::Tensor C;
+    core::BatchedMatmul(A, A, C);
+    for (int64_t i = 0; i < 2; ++i) {
+        ExpectAllClose(C[i], A[i].Matmul(A[i]), 1e-12);
+    }
+
+    // Incompatible shape test
+    EXPECT_ANY_THROW(core::BatchedMatmul(A, RandomMatrices({3, 40, 40}, device),
+                                         C));
+    EXPECT_ANY_THROW(core::BatchedMatmul(A, RandomMatrices({2, 39, 40}, device),
+                                         C));
+    EXPECT_ANY_THROW(core::BatchedMatmul(A[0], A[0], C));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedInverse) {
+    const float EPSILON = 1e-5;
+
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor A(std::vector<float>{2, 3, 1, 3, 3, 1, 2, 4, 1, 2, 0, 0, 0, 4,
+                                      0, 0, 0, 8},
+                   {2, 3, 3}, dtype, device);
+    core::Tensor A_inv;
+    core::BatchedInverse(A, A_inv);
+    EXPECT_EQ(A_inv.GetShape(), core::SizeVector({2, 3, 3}));
+
+    std::vector<float> A_inv_data = A_inv.ToFlatVector<float>();
+    std::vector<float> A_inv_gt = {-1, 1, 0, -1,  0,    1, 6, -2,   -3,
+                                   0.5, 0, 0, 0, 0.25, 0, 0, 0, 0.125};
+    for (int i = 0; i < 18; ++i) {
+        EXPECT_TRUE(std::abs(A_inv_data[i] - A_inv_gt[i]) < EPSILON);
+    }
+
+    for (int64_t n : {4, 5, 6}) {
+        core::Tensor B = RandomMatrices({9, n, n}, device);
+        core::Tensor B_inv;
+        core::BatchedInverse(B, B_inv);
+        core::Tensor I = core::Tensor::Eye(n, core::Dtype::Float64, device);
+        for (int64_t i = 0; i < 9; ++i) {
+            ExpectAllClose(B[i].Matmul(B_inv[i]), I, 1e-9);
+        }
+    }
+
+    // Singular test
+    core::Tensor singular = A.Clone();
+    singular[1] = core::Tensor::Zeros({3, 3}, dtype, device);
+    EXPECT_ANY_THROW(core::BatchedInverse(singular, A_inv));
+
+    // Shape test
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({3, 3}, dtype, device), A_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 4}, dtype, device), A_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 3}, core::Dtype::Int32, device), A_inv));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSolve) {
+    const float EPSILON = 1e-6;
+
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor A(std::vector<float>{3, 1, 1, 2, 0, 1, 1, 0}, {2, 2, 2},
+                   dtype, device);
+    core::Tensor B(std::vector<float>{9, 8, 4, 5}, {2, 2}, dtype, device);
+    core::Tensor X;
+    core::BatchedSolve(A, B, X);
+
+    EXPECT_EQ(X.GetShape(), core::SizeVector({2, 2}));
+    std::vector<float> X_data = X.ToFlatVector<float>();
+    std::vector<float> X_gt = std::vector<float>{2, 3, 5, 4};
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(std::abs(X_data[i] - X_gt[i]) < EPSILON);
+    }
+
+    for (int64_t n : {3, 4, 6, 7}) {
+        core::Tensor C = RandomMatrices({5, n, n}, device);
+        core::Tensor b = RandomMatrices({5, n}, device);
+        core::Tensor D = RandomMatrices({5, n, 3}, device);
+        core::Tensor x, Y;
+        core::BatchedSolve(C, b, x);
+        core::BatchedSolve(C, D, Y);
+        for (int64_t i = 0; i < 5; ++i) {
+            ExpectAllClose(C[i].Matmul(x[i].Reshape({n, 1})).Reshape({n}), b[i],
+                           1e-9);
+            ExpectAllClose(C[i].Matmul(Y[i]), D[i], 1e-9);
+        }
+    }
+
+    // Singular test
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Zeros({2, 2, 2}, dtype, device), B, X));
+
+    // Shape test
+    EXPECT_ANY_THROW(core::BatchedSolve(A, B.Reshape({4}), X));
+    EXPECT_ANY_THROW(core::BatchedSolve(A, B[0].Reshape({1, 2}), X));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({2, 2, 3}, dtype, device), B, X));
+}
+
+/// Checks A[i] = U[i] diag(S[i]) VT[i] with orthogonal U[i], VT[i] and
+/// descending S[i].
+static void ExpectSVD(const core::Tensor& A, double epsilon) {
+    core::Tensor U, S, VT;
+    core::BatchedSVD(A, U, S, VT);
+    const int64_t batch = A.GetShape()[0];
+    const int64_t m = A.GetShape()[1];
+    const int64_t n = A.GetShape()[2];
+    EXPECT_EQ(U.GetShape(), core::SizeVector({batch, m, m}));
+    EXPECT_EQ(S.GetShape(), core::SizeVector({batch, n}));
+    EXPECT_EQ(VT.GetShape(), core::SizeVector({batch, n, n}));
+    core::Device device = A.GetDevice();
+    for (int64_t i = 0; i < batch; ++i) {
+        ExpectAllClose(U[i].Matmul(U[i].T()),
+                       core::Tensor::Eye(m, A.GetDtype(), device), epsilon);
+        ExpectAllClose(VT[i].Matmul(VT[i].T()),
+                       core::Tensor::Eye(n, A.GetDtype(), device), epsilon);
+        core::Tensor U_n = U[i].Slice(1, 0, n);
+        ExpectAllClose(U_n.Matmul(core::Tensor::Diag(S[i])).Matmul(VT[i]), A[i],
+                       epsilon);
+        std::vector<double> S_data =
+                S[i].To(core::Dtype::Float64).ToFlatVector<double>();
+        for (int64_t j = 1; j < n; ++j) {
+            EXPECT_GE(S_data[j - 1], S_data[j]);
+        }
+    }
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSVD) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {3, 4, 5, 6}) {
+        ExpectSVD(RandomMatrices({6, n, n}, device), 1e-10);
+    }
+    ExpectSVD(RandomMatrices({6, 7, 3}, device), 1e-10);
+
+    // Same as the SVD test, rank deficient matrices.
+    core::Tensor A(std::vector<double>{2, 4, 1, 3, 0, 0, 0, 0, 1, 2, 1, 2, 1,
+                                       2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+                   {3, 4, 2}, core::Dtype::Float64, device);
+    ExpectSVD(A, 1e-10);
+    core::Tensor U, S, VT;
+    core::BatchedSVD(A, U, S, VT);
+    ExpectAllClose(S[0], std::get<1>(A[0].SVD()), 1e-10);
+    ExpectAllClose(S[1], core::Tensor(std::vector<double>{std::sqrt(20.0), 0},
+                                      {2}, core::Dtype::Float64, device),
+                   1e-10);
+    ExpectAllClose(S[2], core::Tensor::Zeros({2}, core::Dtype::Float64, device),
+                   1e-10);
+
+    core::Tensor B = RandomMatrices({4, 3, 3}, device).To(core::Dtype::Float32);
+    ExpectSVD(B, 1e-5);
+
+    // Shape test
+    EXPECT_ANY_THROW(core::BatchedSVD(RandomMatrices({2, 2, 3}, device), U, S,
+                                      VT));
+    EXPECT_ANY_THROW(core::BatchedSVD(RandomMatrices({2, 3}, device), U, S,
+                                      VT));
+}
+
+/// Checks A[i] V[i] = V[i] diag(eigenvalues[i]) with orthogonal V[i] and
+/// ascending eigenvalues[i].
+static void ExpectSymmetricEigen(const core::Tensor& A, double epsilon) {
+    core::Tensor eigenvalues, eigenvectors;
+    core::BatchedSymmetricEigen(A, eigenvalues, eigenvectors);
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    EXPECT_EQ(eigenvalues.GetShape(), core::SizeVector({batch, n}));
+    EXPECT_EQ(eigenvectors.GetShape(), core::SizeVector({batch, n, n}));
+    for (int64_t i = 0; i < batch; ++i) {
+        core::Tensor V = eigenvectors[i];
+        ExpectAllClose(V.T().Matmul(V),
+                       core::Tensor::Eye(n, A.GetDtype(), A.GetDevice()),
+                       epsilon);
+        ExpectAllClose(A[i].Matmul(V),
+                       V.Matmul(core::Tensor::Diag(eigenvalues[i])), epsilon);
+        std::vector<double> values = eigenvalues[i]
+                                             .To(core::Dtype::Float64)
+                                             .ToFlatVector<double>();
+        for (int64_t j = 1; j < n; ++j) {
+            EXPECT_LE(values[j - 1], values[j]);
+        }
+    }
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSymmetricEigen) {
+    core::Device device = GetParam();
+
+    for (int64_t n : {3, 4, 6, 7}) {
+        core::Tensor A = RandomMatrices({20, n, n}, device);
+        ExpectSymmetricEigen(A.Add(A.Transpose(1, 2)), 1e-9);
+    }
+
+    // Covariances of a plane, a line and a point, a diagonal matrix with
+    // repeated eigenvalues and a zero matrix.
+    core::Tensor A(std::vector<double>{1, 0.5, 0,   0.5, 1, 0, 0, 0, 0,
+                                       1, 1,   1,   1,   1, 1, 1, 1, 1,
+                                       3, 0,   0,   0,   1, 0, 0, 0, 3,
+                                       0, 0,   0,   0,   0, 0, 0, 0, 0},
+                   {4, 3, 3}, core::Dtype::Float64, device);
+    ExpectSymmetricEigen(A, 1e-9);
+    core::Tensor eigenvalues, eigenvectors;
+    core::BatchedSymmetricEigen(A, eigenvalues, eigenvectors);
+    ExpectAllClose(eigenvalues,
+                   core::Tensor(std::vector<double>{0, 0.5, 1.5, 0, 0, 3, 1, 3,
+                                                    3, 0, 0, 0},
+                                {4, 3}, core::Dtype::Float64, device),
+                   1e-9);
+
+    // Only the lower triangle is read.
+    core::Tensor L = A.Clone();
+    L[0][0][1] = 7.0;
+    core::Tensor L_eigenvalues, L_eigenvectors;
+    core::BatchedSymmetricEigen(L, L_eigenvalues, L_eigenvectors);
+    ExpectAllClose(L_eigenvalues, eigenvalues, 1e-12);
+
+    core::Tensor B = RandomMatrices({8, 3, 3}, device).To(core::Dtype::Float32);
+    ExpectSymmetricEigen(B.Add(B.Transpose(1, 2)), 1e-5);
+
+    // Shape test
+    EXPECT_ANY_THROW(core::BatchedSymmetricEigen(
+            RandomMatrices({2, 3, 4}, device), eigenvalues, eigenvectors));
+}
 }  // namespace tests
 }  // namespace open3d
@@ -30,6 +30,7 @@
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -78,5 +79,61 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, CPUCachedMallocFree) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager cached_mm;
+    core::CPUCachedMemoryManager::ReleaseCache();
+
+    // A freed block is reused for an allocation of the same size class.
+    core::CPUCacheStatistics stats0 =
+            core::CPUCachedMemoryManager::GetStatistics();
+    void* ptr = cached_mm.Malloc(1000, device);
+    EXPECT_EQ(reinterpret_cast<size_t>(ptr) % 64, 0);
+    cached_mm.Free(ptr, device);
+    void* ptr_reused = cached_mm.Malloc(900, device);
+    EXPECT_EQ(ptr, ptr_reused);
+    core::CPUCacheStatistics stats1 =
+            core::CPUCachedMemoryManager::GetStatistics();
+    EXPECT_EQ(stats1.num_mallocs_ - stats0.num_mallocs_, 2);
+    EXPECT_EQ(stats1.num_cache_hits_ - stats0.num_cache_hits_, 1);
+    EXPECT_EQ(stats1.bytes_in_use_ - stats0.bytes_in_use_, 1024);
+
+    // Large blocks are aligned and rounded up to 2 MiB.
+    void* large_ptr = cached_mm.Malloc(3 * 1024 * 1024, device);
+    EXPECT_EQ(reinterpret_cast<size_t>(large_ptr) % (2 * 1024 * 1024), 0);
+    std::memset(large_ptr, 0, 3 * 1024 * 1024);
+    cached_mm.Free(large_ptr, device);
+    cached_mm.Free(ptr_reused, device);
+    core::CPUCacheStatistics stats2 =
+            core::CPUCachedMemoryManager::GetStatistics();
+    EXPECT_EQ(stats2.bytes_in_use_, stats0.bytes_in_use_);
+    EXPECT_GE(stats2.bytes_cached_, 4 * 1024 * 1024 + 1024);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+    core::CPUCacheStatistics stats3 =
+            core::CPUCachedMemoryManager::GetStatistics();
+    EXPECT_EQ(stats3.bytes_cached_, 0);
+}
+
+TEST(MemoryManager, CPUCacheSwitch) {
+    core::Device device("CPU:0");
+    bool cache_enabled = core::MemoryManager::IsCPUCacheEnabled();
+
+    // Memory can be freed after switching the CPU memory manager.
+    core::MemoryManager::SetCPUCacheEnabled(false);
+    void* ptr_simple = core::MemoryManager::Malloc(100, device);
+    core::MemoryManager::SetCPUCacheEnabled(true);
+    EXPECT_TRUE(core::MemoryManager::IsCPUCacheEnabled());
+    void* ptr_cached = core::MemoryManager::Malloc(100, device);
+    core::MemoryManager::Free(ptr_simple, device);
+    core::MemoryManager::SetCPUCacheEnabled(false);
+    core::MemoryManager::Free(ptr_cached, device);
+
+    core::MemoryManager::SetCPUCacheEnabled(true);
+    core::Tensor t = core::Tensor::Ones({100, 3}, core::Dtype::Float32, device);
+    EXPECT_EQ(t.Sum({0, 1}).Item<float>(), 300);
+    core::MemoryManager::SetCPUCacheEnabled(cache_enabled);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/hashmap/MultiValueHashmap.h"
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/SizeVector.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class MultiValueHashmapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(MultiValueHashmap,
+                         MultiValueHashmapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Keys (i % slots, 0, 1), tsdf filled with the slot and color (slot, 0, 255).
+static void MakeVoxelData(const core::Device &device,
+                          int n,
+                          int slots,
+                          core::Tensor &keys,
+                          core::Tensor &tsdf,
+                          core::Tensor &color) {
+    std::vector<int> keys_vec(n * 3);
+    std::vector<float> tsdf_vec(n * 4);
+    std::vector<uint8_t> color_vec(n * 3);
+    for (int i = 0; i < n; ++i) {
+        int slot = (i * 7) % slots;
+        keys_vec[i * 3 + 0] = slot;
+        keys_vec[i * 3 + 1] = 0;
+        keys_vec[i * 3 + 2] = 1;
+        for (int j = 0; j < 4; ++j) {
+            tsdf_vec[i * 4 + j] = static_cast<float>(slot);
+        }
+        color_vec[i * 3 + 0] = static_cast<uint8_t>(slot);
+        color_vec[i * 3 + 1] = 0;
+        color_vec[i * 3 + 2] = 255;
+    }
+    keys = core::Tensor(keys_vec, {n, 3}, core::Dtype::Int32, device);
+    tsdf = core::Tensor(tsdf_vec, {n, 2, 2}, core::Dtype::Float32, device);
+    color = core::Tensor(color_vec, {n, 3}, core::Dtype::UInt8, device);
+}
+
+static void ExpectVoxelValues(const core::MultiValueHashmap &hashmap,
+                              const core::Tensor &addrs,
+                              const core::Tensor &keys) {
+    core::Tensor indices = addrs.To(core::Dtype::Int64);
+    core::Tensor slots = keys.Slice(1, 0, 1).To(core::Dtype::Float32);
+    core::Tensor tsdf = hashmap.GetValueTensor("tsdf").IndexGet({indices});
+    EXPECT_TRUE(tsdf.View({keys.GetLength(), 4})
+                        .AllClose(slots.Expand({keys.GetLength(), 4})));
+    core::Tensor color = hashmap.GetValueTensor("color").IndexGet({indices});
+    EXPECT_TRUE(color.Slice(1, 0, 1).To(core::Dtype::Float32).AllClose(slots));
+    EXPECT_EQ(color.Slice(1, 2, 3)
+                      .To(core::Dtype::Int64)
+                      .Sum({0})
+                      .Item<int64_t>(),
+              255 * keys.GetLength());
+}
+
+static void CheckInsertFindErase(const core::Device &device,
+                                 const core::HashmapBackend &backend) {
+    const int n = 10000;
+    const int slots = 211;
+
+    core::Tensor keys, tsdf, color;
+    MakeVoxelData(device, n, slots, keys, tsdf, color);
+
+    // Start small so that insertion has to grow the value buffers.
+    core::MultiValueHashmap hashmap(8, core::Dtype::Int32, {3},
+                                    {"tsdf", "color"},
+                                    {core::Dtype::Float32, core::Dtype::UInt8},
+                                    {{2, 2}, {3}}, device, backend);
+    EXPECT_EQ(hashmap.GetValueTensor("tsdf").GetShape(),
+              core::SizeVector({hashmap.GetCapacity(), 2, 2}));
+
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, {tsdf, color}, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), slots);
+    EXPECT_EQ(hashmap.Size(), slots);
+    EXPECT_GE(hashmap.GetCapacity(), slots);
+    EXPECT_EQ(hashmap.GetValueTensor("color").GetShape(),
+              core::SizeVector({hashmap.GetCapacity(), 3}));
+
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ExpectVoxelValues(hashmap, addrs, keys);
+
+    // Erase the first half of the slots, the rest keeps its values.
+    core::Tensor erase_masks;
+    core::Tensor erase_keys = keys.Slice(0, 0, slots / 2);
+    hashmap.Erase(erase_keys, erase_masks);
+    EXPECT_TRUE(erase_masks.All());
+    EXPECT_EQ(hashmap.Size(), slots - slots / 2);
+
+    core::Tensor remaining_keys = keys.Slice(0, slots / 2, slots);
+    hashmap.Find(remaining_keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ExpectVoxelValues(hashmap, addrs, remaining_keys);
+
+    // Activated keys get zeroed values even where erased entries were.
+    hashmap.Activate(erase_keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    core::Tensor indices = addrs.To(core::Dtype::Int64);
+    EXPECT_TRUE(hashmap.GetValueTensor("tsdf")
+                        .IndexGet({indices})
+                        .AllClose(core::Tensor::Zeros(
+                                {slots / 2, 2, 2}, core::Dtype::Float32,
+                                device)));
+
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    EXPECT_EQ(active_addrs.GetLength(), slots);
+}
+
+TEST_P(MultiValueHashmapPermuteDevices, InsertFindErase) {
+    core::Device device = GetParam();
+    CheckInsertFindErase(device, core::HashmapBackend::Default);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        // The TBB backend moves entries when it grows.
+        CheckInsertFindErase(device, core::HashmapBackend::TBB);
+    }
+}
+
+TEST_P(MultiValueHashmapPermuteDevices, CopySemantics) {
+    core::Device device = GetParam();
+    const int n = 1000;
+    const int slots = 97;
+
+    core::Tensor keys, tsdf, color;
+    MakeVoxelData(device, n, slots, keys, tsdf, color);
+
+    core::MultiValueHashmap hashmap(4, core::Dtype::Int32, {3},
+                                    {"tsdf", "color"},
+                                    {core::Dtype::Float32, core::Dtype::UInt8},
+                                    {{2, 2}, {3}}, device);
+    EXPECT_EQ(hashmap.GetValueNames(),
+              std::vector<std::string>({"tsdf", "color"}));
+    EXPECT_EQ(hashmap.GetValueDtype("color"), core::Dtype::UInt8);
+
+    // Copies share storage, also across growth.
+    core::MultiValueHashmap shared = hashmap;
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, {tsdf, color}, addrs, masks);
+    EXPECT_EQ(shared.Size(), slots);
+    EXPECT_EQ(shared.GetCapacity(), hashmap.GetCapacity());
+
+    core::MultiValueHashmap cloned = hashmap.Clone();
+    hashmap.Erase(keys, masks);
+    EXPECT_EQ(shared.Size(), 0);
+    EXPECT_EQ(cloned.Size(), slots);
+    cloned.Find(keys, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ExpectVoxelValues(cloned, addrs, keys);
+
+    core::MultiValueHashmap host = cloned.To(core::Device("CPU:0"));
+    host.Find(keys.To(core::Device("CPU:0")), addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ExpectVoxelValues(host, addrs, keys.To(core::Device("CPU:0")));
+
+    // Reserve keeps the content, addresses have to be queried again.
+    host.Reserve(host.GetCapacity() * 4);
+    host.Find(keys.To(core::Device("CPU:0")), addrs, masks);
+    EXPECT_TRUE(masks.All());
+    ExpectVoxelValues(host, addrs, keys.To(core::Device("CPU:0")));
+}
+
+TEST_P(MultiValueHashmapPermuteDevices, InvalidArguments) {
+    core::Device device = GetParam();
+    EXPECT_ANY_THROW(core::MultiValueHashmap(
+            8, core::Dtype::Int32, {3}, {"tsdf", "tsdf"},
+            {core::Dtype::Float32, core::Dtype::Float32}, {{1}, {1}}, device));
+    EXPECT_ANY_THROW(core::MultiValueHashmap(8, core::Dtype::Int32, {3},
+                                             {"tsdf"}, {}, {{1}}, device));
+
+    core::MultiValueHashmap hashmap(8, core::Dtype::Int32, {3},
+                                    {"tsdf", "weight"},
+                                    {core::Dtype::Float32, core::Dtype::UInt16},
+                                    {{1}, {1}}, device);
+    core::Tensor keys = core::Tensor::Zeros({2, 3}, core::Dtype::Int32, device);
+    core::Tensor tsdf =
+            core::Tensor::Zeros({2, 1}, core::Dtype::Float32, device);
+    core::Tensor addrs, masks;
+    EXPECT_ANY_THROW(hashmap.Insert(keys, {tsdf}, addrs, masks));
+    EXPECT_ANY_THROW(hashmap.Insert(keys, {tsdf, tsdf}, addrs, masks));
+    EXPECT_ANY_THROW(hashmap.GetValueTensor("color"));
+    EXPECT_EQ(hashmap.Size(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,8 +26,11 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <utility>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -79,6 +82,74 @@ TEST(NanoFlannIndex, SearchKnn) {
     EXPECT_EQ(distances.GetShape(), core::SizeVector({1, 10}));
 }
 
+TEST(NanoFlannIndex, SearchKnnBatched) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-1.0, 1.0);
+    const int num_points = 2000;
+    const int num_queries = 700;
+    const int knn = 8;
+    std::vector<float> points(num_points * 3);
+    std::vector<float> queries(num_queries * 3);
+    for (auto &p : points) {
+        p = uniform(rng);
+    }
+    for (auto &q : queries) {
+        q = uniform(rng);
+    }
+    core::Tensor ref(points, {num_points, 3}, core::Dtype::Float32);
+    core::Tensor query(queries, {num_queries, 3}, core::Dtype::Float32);
+    core::nns::NanoFlannIndex index(ref);
+
+    core::Tensor indices, distances;
+    index.SearchKnn(query, knn, indices, distances);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+    EXPECT_EQ(distances.GetDtype(), core::Dtype::Float32);
+
+    // Compare with brute force, ordered by distance.
+    std::vector<int64_t> result_indices = indices.ToFlatVector<int64_t>();
+    std::vector<float> result_distances = distances.ToFlatVector<float>();
+    for (int i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<float, int64_t>> all;
+        for (int j = 0; j < num_points; ++j) {
+            float dist = 0;
+            for (int d = 0; d < 3; ++d) {
+                float diff = queries[i * 3 + d] - points[j * 3 + d];
+                dist += diff * diff;
+            }
+            all.emplace_back(dist, j);
+        }
+        std::partial_sort(all.begin(), all.begin() + knn, all.end());
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(result_indices[i * knn + k], all[k].second);
+            EXPECT_NEAR(result_distances[i * knn + k], all[k].first, 1e-6);
+        }
+    }
+
+    // Matching outputs are reused, mismatching ones are reallocated.
+    void *indices_ptr = indices.GetDataPtr();
+    void *distances_ptr = distances.GetDataPtr();
+    index.SearchKnn(query, knn, indices, distances);
+    EXPECT_EQ(indices.GetDataPtr(), indices_ptr);
+    EXPECT_EQ(distances.GetDataPtr(), distances_ptr);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), result_indices);
+
+    index.SearchKnn(query, knn + 1, indices, distances);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn + 1}));
+    EXPECT_EQ(distances.GetShape(), core::SizeVector({num_queries, knn + 1}));
+    EXPECT_EQ(indices.Slice(1, 0, knn).ToFlatVector<int64_t>(),
+              result_indices);
+
+    // Missing neighbors are -1.
+    core::nns::NanoFlannIndex small_index(ref.Slice(0, 0, 5));
+    small_index.SearchKnn(query, knn, indices, distances);
+    EXPECT_EQ(indices.Slice(1, 5, knn).ToFlatVector<int64_t>(),
+              std::vector<int64_t>(num_queries * (knn - 5), -1));
+    EXPECT_TRUE(indices.Slice(1, 0, 5).Ge(0).All());
+
+    EXPECT_THROW(index.SearchKnn(query, 0, indices, distances),
+                 std::runtime_error);
+}
+
 TEST(NanoFlannIndex, SearchRadius) {
     std::vector<int> ref_indices = {1, 4};
     std::vector<double> ref_distance = {0.00626358, 0.00747938};
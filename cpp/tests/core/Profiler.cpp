@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Profiler.h"
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Profiler, DisabledByDefault) {
+    core::Profiler::Reset();
+    EXPECT_FALSE(core::Profiler::IsEnabled());
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32);
+    (a + a).Sum({0});
+    EXPECT_TRUE(core::Profiler::GetEvents().empty());
+}
+
+TEST(Profiler, RecordOps) {
+    core::Profiler::Reset();
+    core::Profiler::Enable();
+    core::Tensor a = core::Tensor::Ones({4, 3}, core::Dtype::Float32);
+    core::Tensor b = a.Add(a);
+    b.Sqrt_();
+    b.Sum({0});
+    b.Matmul(core::Tensor::Ones({3, 2}, core::Dtype::Float32));
+    b.IndexGet({core::Tensor::Init<int64_t>({0, 2})});
+    core::Profiler::Disable();
+    a.Mul(a);
+
+    std::vector<core::ProfilerEvent> events = core::Profiler::GetEvents();
+    auto find = [&](const std::string& category, const std::string& name) {
+        for (const core::ProfilerEvent& event : events) {
+            if (event.category == category && event.name == name) {
+                return &event;
+            }
+        }
+        return static_cast<const core::ProfilerEvent*>(nullptr);
+    };
+
+    const core::ProfilerEvent* add = find("BinaryEW", "Add");
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(add->shape, core::SizeVector({4, 3}));
+    EXPECT_EQ(add->dtype, core::Dtype::Float32);
+    EXPECT_EQ(add->device, core::Device("CPU:0"));
+    EXPECT_EQ(add->bytes, 3 * 12 * 4);
+    EXPECT_GE(add->duration_us, 0);
+    EXPECT_EQ(add->thread_id, 0);
+
+    const core::ProfilerEvent* sum = find("Reduction", "Sum");
+    ASSERT_NE(sum, nullptr);
+    EXPECT_EQ(sum->shape, core::SizeVector({4, 3}));
+    EXPECT_EQ(sum->bytes, (12 + 3) * 4);
+
+    EXPECT_NE(find("UnaryEW", "Sqrt"), nullptr);
+    EXPECT_NE(find("Linalg", "Matmul"), nullptr);
+    EXPECT_NE(find("IndexGetSet", "IndexGetRows"), nullptr);
+    EXPECT_EQ(find("BinaryEW", "Mul"), nullptr);
+
+    // Events are recorded when they end, so nested ops come first.
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LE(events[i - 1].start_us + events[i - 1].duration_us,
+                  events[i].start_us + events[i].duration_us);
+    }
+
+    core::Profiler::Reset();
+    EXPECT_TRUE(core::Profiler::GetEvents().empty());
+}
+
+TEST(Profiler, Hashmap) {
+    core::Profiler::Reset();
+    core::Profiler::Enable();
+    core::Hashmap hashmap(10, core::Dtype::Int32, core::Dtype::Int32, {1},
+                          {1}, core::Device("CPU:0"));
+    core::Tensor keys = core::Tensor::Init<int32_t>({{1}, {2}, {3}});
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, keys, addrs, masks);
+    hashmap.Find(keys, addrs, masks);
+    core::Profiler::Disable();
+
+    std::string summary = core::Profiler::GetSummary();
+    EXPECT_NE(summary.find("Hashmap::Insert"), std::string::npos);
+    EXPECT_NE(summary.find("Hashmap::Find"), std::string::npos);
+    core::Profiler::Reset();
+}
+
+TEST(Profiler, ChromeTraceAndSummary) {
+    core::Profiler::Reset();
+    core::Profiler::Enable();
+    core::Tensor a = core::Tensor::Ones({8}, core::Dtype::Float64);
+    for (int i = 0; i < 3; ++i) {
+        a.Add_(a);
+    }
+    core::Profiler::Disable();
+
+    std::string trace = core::Profiler::ToChromeTrace();
+    EXPECT_EQ(trace.find("{\"traceEvents\": ["), 0);
+    EXPECT_NE(trace.find("\"name\": \"BinaryEW::Add\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\": \"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"shape\": \"[8]\""), std::string::npos);
+    EXPECT_NE(trace.find("\"dtype\": \"Float64\""), std::string::npos);
+
+    std::string summary = core::Profiler::GetSummary();
+    size_t line = summary.find("BinaryEW::Add");
+    ASSERT_NE(line, std::string::npos);
+    // Three calls.
+    EXPECT_NE(summary.substr(line, 48).find(" 3 "), std::string::npos);
+    core::Profiler::Reset();
+}
+
+}  // namespace tests
+}  // namespace open3d
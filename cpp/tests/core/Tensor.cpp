@@ -26,13 +26,18 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <random>
+#include <tuple>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/CPUVectorized.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -1353,6 +1358,126 @@ TEST_P(TensorPermuteDevices, Div_) {
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
 }
 
+TEST_P(TensorPermuteDevices, ScalarOperand) {
+    core::Device device = GetParam();
+
+    // Contiguous operands take the by-value scalar path.
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    EXPECT_EQ((a * 0.5).ToFlatVector<float>(),
+              std::vector<float>({0, 0.5, 1, 1.5, 2, 2.5}));
+    EXPECT_EQ((a / 2.f).ToFlatVector<float>(),
+              std::vector<float>({0, 0.5, 1, 1.5, 2, 2.5}));
+
+    // Non-contiguous operands broadcast a 0-d tensor.
+    core::Tensor col = a.Slice(1, 1, 2);
+    EXPECT_EQ((col - 1).ToFlatVector<float>(), std::vector<float>({0, 3}));
+    col += 10;
+    EXPECT_EQ(a.ToFlatVector<float>(),
+              std::vector<float>({0, 11, 2, 3, 14, 5}));
+
+    // Scalars are converted to the dtype of the tensor.
+    core::Tensor i = core::Tensor::Init<int32_t>({1, 2, 3}, device);
+    EXPECT_EQ((i * 2.7).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 4, 6}));
+    EXPECT_EQ((i + size_t(4)).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 6, 7}));
+    core::Tensor u = core::Tensor::Init<uint8_t>({250, 251}, device);
+    EXPECT_EQ((u + 10).ToFlatVector<uint8_t>(), std::vector<uint8_t>({4, 5}));
+    core::Tensor d = core::Tensor::Init<double>({1, 2}, device);
+    d.Mul_(core::Scalar(0.1));
+    EXPECT_EQ(d.ToFlatVector<double>(), std::vector<double>({0.1, 0.2}));
+
+    // Scalars on a large tensor are applied in parallel chunks.
+    core::Tensor large =
+            core::Tensor::Ones({100003}, core::Dtype::Float32, device);
+    large.Mul_(3).Sub_(1);
+    EXPECT_TRUE(large.AllClose(
+            core::Tensor::Full({100003}, 2, core::Dtype::Float32, device)));
+}
+
+TEST_P(TensorPermuteDevices, BinaryOutParameter) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({10, 20, 30}, device);
+
+    // An empty out is allocated.
+    core::Tensor out;
+    a.Add(b, out);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({10, 21, 32, 13, 24, 35}));
+
+    // A compatible out is reused.
+    const void* data_ptr = out.GetDataPtr();
+    a.Mul(b, out);
+    EXPECT_EQ(out.GetDataPtr(), data_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({0, 20, 60, 30, 80, 150}));
+    a.Sub(1, out);
+    EXPECT_EQ(out.GetDataPtr(), data_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({-1, 0, 1, 2, 3, 4}));
+    a.Div(2.f, out);
+    EXPECT_EQ(out.GetDataPtr(), data_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({0, 0.5, 1, 1.5, 2, 2.5}));
+
+    // A view of a larger tensor is written in place.
+    core::Tensor c = core::Tensor::Zeros({2, 3}, core::Dtype::Float32, device);
+    core::Tensor row = c[1];
+    b.Sub(b, row);
+    b.Add(5, row);
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 15, 25, 35}));
+
+    // Out may be an input, and is reallocated if it cannot hold the result.
+    core::Tensor x = b.Clone();
+    x.Mul(a, x);
+    EXPECT_EQ(x.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(x.ToFlatVector<float>(),
+              std::vector<float>({0, 20, 60, 30, 80, 150}));
+    core::Tensor y = core::Tensor::Zeros({6}, core::Dtype::Int32, device);
+    a.Add(1, y);
+    EXPECT_EQ(y.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(y.ToFlatVector<float>(), std::vector<float>({1, 2, 3, 4, 5, 6}));
+}
+
+TEST_P(TensorPermuteDevices, UnaryOutParameter) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({-2.5, -0.4, 1.6, 4}, device);
+
+    core::Tensor out;
+    a.Abs(out);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({2.5, 0.4, 1.6, 4}));
+    const void* data_ptr = out.GetDataPtr();
+    out.Sqrt(out);
+    EXPECT_EQ(out.GetDataPtr(), data_ptr);
+    EXPECT_TRUE(out.AllClose(core::Tensor::Init<float>(
+            {std::sqrt(2.5f), std::sqrt(0.4f), std::sqrt(1.6f), 2}, device)));
+    a.Floor(out);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({-3, -1, 1, 4}));
+    a.Ceil(out);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({-2, -0, 2, 4}));
+    a.Neg(out);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({2.5, 0.4, -1.6, -4}));
+    EXPECT_EQ(out.GetDataPtr(), data_ptr);
+
+    // In-place rounding.
+    core::Tensor b = a.Clone();
+    b.Floor_();
+    EXPECT_EQ(b.ToFlatVector<float>(), std::vector<float>({-3, -1, 1, 4}));
+    b = a.Clone();
+    b.Ceil_();
+    EXPECT_EQ(b.ToFlatVector<float>(), std::vector<float>({-2, -0, 2, 4}));
+    b = a.Clone();
+    b.Round_();
+    EXPECT_EQ(b.ToFlatVector<float>(), std::vector<float>({-3, -0, 2, 4}));
+    b = a.Clone();
+    b.Trunc_();
+    EXPECT_EQ(b.ToFlatVector<float>(), std::vector<float>({-2, -0, 1, 4}));
+}
+
 TEST_P(TensorPermuteDevices, ReduceSumKeepDim) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
@@ -1576,6 +1701,82 @@ TEST_P(TensorPermuteDevices, ReduceMultipleOutputsSumLargeArray) {
     EXPECT_EQ(dst.ToFlatVector<int>(), std::vector<int>(7 * 8234719, 3));
 }
 
+TEST_P(TensorPermuteDevices, ReduceMixedDims) {
+    core::Device device = GetParam();
+    core::SizeVector shape{5, 6, 7};
+    std::vector<int64_t> vals(shape.NumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<int64_t>((i * 7919) % 101) - 50;
+    }
+    core::Tensor src(vals, shape, core::Dtype::Int64, device);
+
+    // Reference: reduce each dims combination with nested loops.
+    auto reference = [&](const core::SizeVector& dims, bool is_max) {
+        std::vector<bool> reduced(3, false);
+        for (int64_t dim : dims) {
+            reduced[dim] = true;
+        }
+        core::SizeVector dst_shape{reduced[0] ? 1 : 5, reduced[1] ? 1 : 6,
+                                   reduced[2] ? 1 : 7};
+        std::vector<int64_t> dst_vals(
+                dst_shape.NumElements(),
+                is_max ? std::numeric_limits<int64_t>::lowest() : 0);
+        for (int64_t i = 0; i < 5; ++i) {
+            for (int64_t j = 0; j < 6; ++j) {
+                for (int64_t k = 0; k < 7; ++k) {
+                    int64_t dst_idx = ((reduced[0] ? 0 : i) * dst_shape[1] +
+                                       (reduced[1] ? 0 : j)) *
+                                              dst_shape[2] +
+                                      (reduced[2] ? 0 : k);
+                    int64_t val = vals[(i * 6 + j) * 7 + k];
+                    dst_vals[dst_idx] =
+                            is_max ? std::max(dst_vals[dst_idx], val)
+                                   : dst_vals[dst_idx] + val;
+                }
+            }
+        }
+        return dst_vals;
+    };
+
+    std::vector<core::SizeVector> all_dims = {{0},    {1},    {2},
+                                              {0, 1}, {0, 2}, {1, 2}};
+    for (const core::SizeVector& dims : all_dims) {
+        EXPECT_EQ(src.Sum(dims, true).ToFlatVector<int64_t>(),
+                  reference(dims, false));
+        EXPECT_EQ(src.Max(dims, true).ToFlatVector<int64_t>(),
+                  reference(dims, true));
+    }
+
+    // Non-contiguous input.
+    core::Tensor src_t = src.Transpose(0, 2);
+    EXPECT_EQ(src_t.Sum({0}, false).ToFlatVector<int64_t>(),
+              src_t.Contiguous().Sum({0}, false).ToFlatVector<int64_t>());
+    EXPECT_EQ(src_t.Sum({1, 2}, false).ToFlatVector<int64_t>(),
+              src_t.Contiguous().Sum({1, 2}, false).ToFlatVector<int64_t>());
+}
+
+TEST_P(TensorPermuteDevices, ReduceFewOutputsLargeArray) {
+    core::Device device = GetParam();
+    // Few outputs and many reduced elements, e.g. the centroid of a point
+    // cloud. The reduced elements are split across threads.
+    int64_t num_points = 1000003;
+    std::vector<int> vals(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        vals[i * 3 + 0] = 1;
+        vals[i * 3 + 1] = i % 2;
+        vals[i * 3 + 2] = -1;
+    }
+    core::Tensor src(vals, {num_points, 3}, core::Dtype::Int32, device);
+
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int>(),
+              std::vector<int>({static_cast<int>(num_points),
+                                static_cast<int>(num_points / 2),
+                                -static_cast<int>(num_points)}));
+    EXPECT_EQ(src.Min({0}).ToFlatVector<int>(), std::vector<int>({1, 0, -1}));
+    EXPECT_EQ(src.T().Sum({1}).ToFlatVector<int>(),
+              src.Sum({0}).ToFlatVector<int>());
+}
+
 TEST_P(TensorPermuteDevices, ReduceSum64bit1D) {
     core::Device device = GetParam();
     // num_bytes = 8 * (2 ^ 28) + 1 = 2 ^ 31 + 1 ~= 2GB
@@ -1943,6 +2144,174 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+
+    core::Tensor src = core::Tensor::Init<float>(
+            {3.5, -1, 0, -2.5, 7, -0.0f, 1e-3}, device);
+    std::vector<float> sorted = src.Sort().ToFlatVector<float>();
+    EXPECT_EQ(sorted, std::vector<float>({-2.5, -1, -0.0f, 0, 1e-3, 3.5, 7}));
+    EXPECT_TRUE(std::signbit(sorted[2]));
+    EXPECT_FALSE(std::signbit(sorted[3]));
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 1, 5, 2, 6, 0, 4}));
+
+    src = core::Tensor::Init<int32_t>({5, -7, 5, 0, -7, 3}, device);
+    EXPECT_EQ(src.Sort().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-7, -7, 0, 3, 5, 5}));
+    // Stable, equal values keep their order.
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 4, 3, 5, 0, 2}));
+
+    src = core::Tensor::Init<uint8_t>({200, 1, 255, 0}, device);
+    EXPECT_EQ(src.Sort().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 1, 200, 255}));
+
+    // Spans several chunks and all digits of the keys.
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(
+            std::numeric_limits<int64_t>::min(),
+            std::numeric_limits<int64_t>::max());
+    std::vector<int64_t> vals(200000);
+    for (auto& v : vals) {
+        v = dist(rng) >> (rng() % 64);
+    }
+    src = core::Tensor(vals, {int64_t(vals.size())}, core::Dtype::Int64,
+                       device);
+    std::vector<int64_t> indices(vals.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::stable_sort(indices.begin(), indices.end(),
+                     [&](int64_t a, int64_t b) { return vals[a] < vals[b]; });
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(), indices);
+    std::sort(vals.begin(), vals.end());
+    EXPECT_EQ(src.Sort().ToFlatVector<int64_t>(), vals);
+
+    std::uniform_real_distribution<double> real_dist(-1e6, 1e6);
+    std::vector<double> real_vals(100000);
+    for (auto& v : real_vals) {
+        v = real_dist(rng);
+    }
+    src = core::Tensor(real_vals, {int64_t(real_vals.size())},
+                       core::Dtype::Float64, device);
+    std::sort(real_vals.begin(), real_vals.end());
+    EXPECT_EQ(src.Sort().ToFlatVector<double>(), real_vals);
+
+    // Empty.
+    src = core::Tensor::Empty({0}, core::Dtype::Float32, device);
+    EXPECT_EQ(src.Sort().GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(src.ArgSort().GetDtype(), core::Dtype::Int64);
+
+    // Only 1-D tensors of the supported dtypes.
+    EXPECT_THROW(core::Tensor::Zeros({2, 3}, core::Dtype::Float32, device)
+                         .Sort(),
+                 std::runtime_error);
+    EXPECT_THROW(core::Tensor::Zeros({3}, core::Dtype::Bool, device).Sort(),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor src =
+            core::Tensor::Init<int64_t>({4, 1, 4, 9, 1, 1, -3}, device);
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = src.Unique();
+    EXPECT_EQ(values.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-3, 1, 4, 9}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 2, 3, 1, 1, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 2, 1}));
+    EXPECT_TRUE(values.IndexGet({inverse}).AllClose(src));
+
+    // -0.0 equals 0.0.
+    src = core::Tensor::Init<float>({0, 2, -0.0f, 0}, device);
+    std::tie(values, inverse, counts) = src.Unique();
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({0, 2}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 0, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({3, 1}));
+
+    src = core::Tensor::Empty({0}, core::Dtype::Int32, device);
+    std::tie(values, inverse, counts) = src.Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    core::Device device = GetParam();
+
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, 6}, {-7, 8}, {9, -10}}, device);
+    core::Tensor row_splits =
+            core::Tensor::Init<int64_t>({0, 2, 2, 5}, device);
+
+    core::Tensor dst = src.SegmentSum(row_splits);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({4, 6, 0, 0, 7, 4}));
+
+    dst = src.SegmentMax(row_splits);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({3, 4, 0, 0, 9, 8}));
+
+    dst = src.SegmentMean(row_splits);
+    std::vector<float> mean = dst.ToFlatVector<float>();
+    EXPECT_EQ(mean[0], 2);
+    EXPECT_EQ(mean[1], 3);
+    EXPECT_TRUE(std::isnan(mean[2]));
+    EXPECT_TRUE(std::isnan(mean[3]));
+    EXPECT_FLOAT_EQ(mean[4], 7.f / 3);
+    EXPECT_FLOAT_EQ(mean[5], 4.f / 3);
+
+    // 1-D and integer tensors.
+    core::Tensor src_int = core::Tensor::Init<int32_t>({1, 5, 2, 8}, device);
+    row_splits = core::Tensor::Init<int64_t>({0, 3, 4}, device);
+    EXPECT_EQ(src_int.SegmentSum(row_splits).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({8, 8}));
+    EXPECT_EQ(src_int.SegmentMax(row_splits).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 8}));
+    EXPECT_THROW(src_int.SegmentMean(row_splits), std::runtime_error);
+
+    // row_splits must go from 0 to the number of rows and be sorted.
+    EXPECT_THROW(src.SegmentSum(core::Tensor::Init<int64_t>({0, 4}, device)),
+                 std::runtime_error);
+    EXPECT_THROW(
+            src.SegmentSum(core::Tensor::Init<int64_t>({0, 3, 2, 5}, device)),
+            std::runtime_error);
+    EXPECT_THROW(src.SegmentSum(core::Tensor::Init<int32_t>({0, 5}, device)),
+                 std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, SortSegmentVoxelDownSample) {
+    core::Device device = GetParam();
+
+    // Average the points that fall into the same voxel of size 1.
+    core::Tensor points = core::Tensor::Init<float>({{0.1, 0.2, 0.3},
+                                                     {2.5, 0.5, 0.5},
+                                                     {0.3, 0.4, 0.5},
+                                                     {2.7, 0.1, 0.9},
+                                                     {1.5, 1.5, 1.5}},
+                                                    device);
+    core::Tensor voxels = points.Floor().To(core::Dtype::Int64).T();
+    core::Tensor keys =
+            voxels[0].Mul(16).Add(voxels[1].Mul(4)).Add(voxels[2]);
+    core::Tensor order = keys.ArgSort();
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = keys.IndexGet({order}).Unique();
+
+    std::vector<int64_t> splits = {0};
+    for (int64_t count : counts.ToFlatVector<int64_t>()) {
+        splits.push_back(splits.back() + count);
+    }
+    core::Tensor row_splits(splits, {int64_t(splits.size())},
+                            core::Dtype::Int64, device);
+    core::Tensor down = points.IndexGet({order}).SegmentMean(row_splits);
+    EXPECT_TRUE(down.AllClose(core::Tensor::Init<float>(
+            {{0.2, 0.3, 0.4}, {1.5, 1.5, 1.5}, {2.6, 0.3, 0.7}}, device)));
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2403,6 +2772,233 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, NonZero) {
+    core::Device device = GetParam();
+
+    // Spans multiple chunks of the parallel compaction.
+    const int64_t n = 100003;
+    std::vector<int32_t> values(n * 3, 0);
+    std::vector<int64_t> rows_gt, cols_gt;
+    for (int64_t i = 0; i < n * 3; ++i) {
+        if (i % 7 == 0 || i % 11 == 0) {
+            values[i] = static_cast<int32_t>(i);
+            rows_gt.push_back(i / 3);
+            cols_gt.push_back(i % 3);
+        }
+    }
+    core::Tensor a(values, {n, 3}, core::Dtype::Int32, device);
+    core::Tensor result = a.NonZero();
+    EXPECT_EQ(result.GetShape(),
+              core::SizeVector({2, static_cast<int64_t>(rows_gt.size() - 1)}));
+    rows_gt.erase(rows_gt.begin());
+    cols_gt.erase(cols_gt.begin());
+    EXPECT_EQ(result[0].ToFlatVector<int64_t>(), rows_gt);
+    EXPECT_EQ(result[1].ToFlatVector<int64_t>(), cols_gt);
+
+    // Non-contiguous.
+    core::Tensor b = core::Tensor::Init<bool>(
+            {{{true, false}, {false, false}}, {{false, true}, {true, true}}},
+            device);
+    result = b.Transpose(0, 2).NonZero();
+    EXPECT_EQ(result.GetShape(), core::SizeVector({3, 4}));
+    EXPECT_EQ(result.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0, 1, 1, 0, 1, 0, 1, 0, 1, 1, 1}));
+
+    // Scalar and empty tensors.
+    EXPECT_EQ(core::Tensor::Init<float>(2, device).NonZero().GetShape(),
+              core::SizeVector({0, 1}));
+    EXPECT_EQ(core::Tensor::Zeros({0, 3}, core::Dtype::Float32, device)
+                      .NonZero()
+                      .GetShape(),
+              core::SizeVector({2, 0}));
+}
+
+TEST_P(TensorPermuteDevices, MaskedSelect) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    core::Tensor mask =
+            core::Tensor::Init<bool>({false, true, false, true}, device);
+    core::Tensor selected = points.MaskedSelect(mask);
+    EXPECT_EQ(selected.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(selected.ToFlatVector<float>(),
+              std::vector<float>({3, 4, 5, 9, 10, 11}));
+
+    // Same result as advanced indexing.
+    EXPECT_TRUE(points.IndexGet({mask}).AllClose(selected));
+    EXPECT_TRUE(points.GetItem(core::TensorKey::IndexTensor(mask))
+                        .AllClose(selected));
+
+    // Mask over all dimensions, of a non-contiguous tensor.
+    core::Tensor points_t = points.T();
+    core::Tensor mask_t = points_t.Gt(4.5f);
+    EXPECT_EQ(points_t.MaskedSelect(mask_t).ToFlatVector<float>(),
+              std::vector<float>({6, 9, 7, 10, 5, 8, 11}));
+    EXPECT_EQ(points_t.IndexGet({mask_t}).ToFlatVector<float>(),
+              std::vector<float>({6, 9, 7, 10, 5, 8, 11}));
+
+    // Large mask, spanning multiple chunks.
+    const int64_t n = 100003;
+    core::Tensor ids = core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device)
+                               .Reshape({n, 1});
+    core::Tensor large_mask = ids.Reshape({n}).Lt(n / 2);
+    core::Tensor large_selected = ids.MaskedSelect(large_mask);
+    EXPECT_EQ(large_selected.GetShape(), core::SizeVector({n / 2, 1}));
+    EXPECT_TRUE(large_selected.AllClose(ids.Slice(0, 0, n / 2)));
+
+    // Wide rows.
+    core::Tensor wide = core::Tensor::Arange(0, 80, 1, core::Dtype::Int64,
+                                             device)
+                                .Reshape({4, 20});
+    EXPECT_TRUE(wide.MaskedSelect(mask).AllClose(
+            wide.IndexGet({core::Tensor::Init<int64_t>({1, 3}, device)})));
+
+    // Nothing selected.
+    EXPECT_EQ(points.MaskedSelect(core::Tensor::Zeros({4}, core::Dtype::Bool,
+                                                      device))
+                      .GetShape(),
+              core::SizeVector({0, 3}));
+
+    // Invalid masks.
+    EXPECT_ANY_THROW(points.MaskedSelect(points));
+    EXPECT_ANY_THROW(points.MaskedSelect(
+            core::Tensor::Ones({3}, core::Dtype::Bool, device)));
+    EXPECT_ANY_THROW(points.MaskedSelect(
+            core::Tensor::Ones({4, 3, 1}, core::Dtype::Bool, device)));
+}
+
+/// Non-contiguous 2-D view with the values of t.
+static core::Tensor NonContiguous(const core::Tensor& t) {
+    const int64_t rows = t.GetShape()[0];
+    const int64_t cols = t.GetShape()[1];
+    core::Tensor padded = core::Tensor::Zeros({rows, cols + 1}, t.GetDtype(),
+                                              t.GetDevice());
+    core::Tensor view = padded.Slice(1, 0, cols);
+    view.AsRvalue() = t;
+    return view;
+}
+
+TEST_P(TensorPermuteDevices, IndexGetSetRows) {
+    core::Device device = GetParam();
+
+    const int64_t n = 50000;
+    core::Tensor points =
+            core::Tensor::Arange(0, n * 3, 1, core::Dtype::Float32, device)
+                    .Reshape({n, 3});
+    std::vector<int64_t> index_data;
+    for (int64_t i = 0; i < 2 * n; ++i) {
+        index_data.push_back((i * 7919) % n - (i % 5 == 0 ? n : 0));
+    }
+    core::Tensor index(index_data, {2 * n}, core::Dtype::Int64, device);
+
+    // Contiguous rows take the fast path, compare against the generic path
+    // of a non-contiguous view.
+    core::Tensor gathered = points.IndexGet({index});
+    EXPECT_EQ(gathered.GetShape(), core::SizeVector({2 * n, 3}));
+    core::Tensor points_view = NonContiguous(points);
+    EXPECT_FALSE(points_view.IsContiguous());
+    EXPECT_TRUE(gathered.AllClose(points_view.IndexGet({index})));
+    EXPECT_EQ(gathered[1].ToFlatVector<float>(),
+              std::vector<float>({7919 * 3, 7919 * 3 + 1, 7919 * 3 + 2}));
+    EXPECT_EQ(gathered[0].ToFlatVector<float>(),
+              points[0].ToFlatVector<float>());
+
+    // Wide rows and 1-D tensors.
+    core::Tensor wide = points.Reshape({n / 10, 30});
+    core::Tensor wide_index = index.Slice(0, 0, 100).Div(10);
+    EXPECT_TRUE(wide.IndexGet({wide_index})
+                        .AllClose(NonContiguous(wide).IndexGet({wide_index})));
+    std::vector<float> flat_gt;
+    for (int64_t i : index_data) {
+        flat_gt.push_back(static_cast<float>(i < 0 ? i + 3 * n : i));
+    }
+    EXPECT_EQ(points.Reshape({3 * n}).IndexGet({index}).ToFlatVector<float>(),
+              flat_gt);
+
+    // Scatter rows, without repeated indices.
+    core::Tensor perm = core::Tensor::Arange(n - 1, -1, -1, core::Dtype::Int64,
+                                             device);
+    core::Tensor reversed = points.Clone();
+    reversed.IndexSet({perm}, points);
+    EXPECT_TRUE(reversed[0].AllClose(points[n - 1]));
+    EXPECT_TRUE(reversed.IndexGet({perm}).AllClose(points));
+
+    // Out of bounds.
+    core::Tensor out_of_bounds =
+            core::Tensor::Init<int64_t>({0, n}, device);
+    EXPECT_ANY_THROW(points.IndexGet({out_of_bounds}));
+    EXPECT_ANY_THROW(points.IndexSet(
+            {out_of_bounds},
+            core::Tensor::Zeros({2, 3}, core::Dtype::Float32, device)));
+    EXPECT_ANY_THROW(points.IndexGet(
+            {core::Tensor::Init<int64_t>({-n - 1}, device)}));
+}
+
+TEST_P(TensorPermuteDevices, IndexAddMax) {
+    core::Device device = GetParam();
+
+    core::Tensor dst =
+            core::Tensor::Zeros({3, 2}, core::Dtype::Float32, device);
+    core::Tensor index = core::Tensor::Init<int64_t>({0, 2, 0, -1}, device);
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, -6}, {7, 8}}, device);
+    dst.IndexAdd_(0, index, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({6, -4, 0, 0, 10, 12}));
+
+    dst = core::Tensor::Zeros({3, 2}, core::Dtype::Float32, device);
+    dst.IndexMax_(0, index, src);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({5, 2, 0, 0, 7, 8}));
+
+    // Along the last dimension, of a non-contiguous tensor.
+    core::Tensor counts = core::Tensor::Zeros({2, 3}, core::Dtype::Int32,
+                                              device);
+    core::Tensor counts_t = counts.T();
+    counts_t.IndexAdd_(0, index,
+                       core::Tensor::Ones({4, 2}, core::Dtype::Int32, device));
+    EXPECT_EQ(counts.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 0, 2, 2, 0, 2}));
+    counts.IndexAdd_(1, index,
+                     core::Tensor::Ones({2, 4}, core::Dtype::Int32, device));
+    EXPECT_EQ(counts.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({4, 0, 4, 4, 0, 4}));
+
+    // Voxel averaging, many points per destination row.
+    const int64_t n = 100000;
+    const int64_t num_voxels = 1000;
+    core::Tensor points =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Float64, device)
+                    .Reshape({n, 1});
+    core::Tensor voxel =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int64, device)
+                    .Reshape({n})
+                    .Div(n / num_voxels);
+    core::Tensor sums =
+            core::Tensor::Zeros({num_voxels, 1}, core::Dtype::Float64, device);
+    sums.IndexAdd_(0, voxel, points);
+    core::Tensor maxs =
+            core::Tensor::Zeros({num_voxels, 1}, core::Dtype::Float64, device);
+    maxs.IndexMax_(0, voxel, points);
+    std::vector<double> sums_data = sums.ToFlatVector<double>();
+    std::vector<double> maxs_data = maxs.ToFlatVector<double>();
+    const int64_t per_voxel = n / num_voxels;
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        const double first = v * per_voxel;
+        const double last = first + per_voxel - 1;
+        EXPECT_EQ(sums_data[v], (first + last) * per_voxel / 2);
+        EXPECT_EQ(maxs_data[v], last);
+    }
+
+    // Invalid inputs.
+    EXPECT_ANY_THROW(dst.IndexAdd_(0, index, src.Slice(0, 0, 3)));
+    EXPECT_ANY_THROW(dst.IndexAdd_(0, index.To(core::Dtype::Int32), src));
+    EXPECT_ANY_THROW(dst.IndexAdd_(0, index, src.To(core::Dtype::Float64)));
+    EXPECT_ANY_THROW(dst.IndexAdd_(
+            0, core::Tensor::Init<int64_t>({0, 3, 0, 0}, device), src));
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -2793,5 +3389,236 @@ TEST_P(TensorPermuteDevices, NumpyIO) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(TensorPermuteDevices, NumpyIOMemoryMapped) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Arange(0, 24, 1, core::Dtype::Float32,
+                                          device)
+                             .Reshape({4, 6});
+    t.Save(file_name);
+    {
+        core::Tensor t_mmap = core::Tensor::LoadMemoryMapped(file_name);
+        EXPECT_EQ(t_mmap.GetDevice(), core::Device("CPU:0"));
+        EXPECT_TRUE(t_mmap.IsContiguous());
+        EXPECT_TRUE(t_mmap.AllClose(t.To(core::Device("CPU:0"))));
+
+        // Views and IndexGet read from the mapping.
+        core::Tensor t_slice = t_mmap.Slice(0, 1, 4, 2);
+        EXPECT_EQ(t_slice.GetBlob(), t_mmap.GetBlob());
+        EXPECT_EQ(t_slice.ToFlatVector<float>(),
+                  std::vector<float>({6, 7, 8, 9, 10, 11, 18, 19, 20, 21, 22,
+                                      23}));
+        core::Tensor index = core::Tensor::Init<int64_t>({3, 0});
+        EXPECT_EQ(t_mmap.IndexGet({index}).ToFlatVector<float>(),
+                  std::vector<float>({18, 19, 20, 21, 22, 23, 0, 1, 2, 3, 4,
+                                      5}));
+
+        // Writes are private to the tensor.
+        t_mmap[0][0] = 100.f;
+        EXPECT_EQ(t_mmap[0][0].Item<float>(), 100.f);
+    }
+    EXPECT_EQ(core::Tensor::Load(file_name)[0][0].Item<float>(), 0.f);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(TensorPermuteDevices, NumpyIONpz) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensors.npz";
+
+    std::unordered_map<std::string, core::Tensor> tensors = {
+            {"points",
+             core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device)},
+            {"labels", core::Tensor::Init<int64_t>({7, 8}, device)},
+            {"mask", core::Tensor::Init<bool>({true, false, true}, device)},
+            {"empty", core::Tensor::Ones({0, 3}, core::Dtype::Float64,
+                                         device)},
+            {"scalar", core::Tensor::Init<uint8_t>(3, device)},
+            // Contiguous view that does not start at its blob.
+            {"slice", core::Tensor::Init<int>({{0, 1}, {2, 3}, {4, 5}}, device)
+                              .Slice(0, 1, 3)}};
+    core::Tensor::SaveNpz(file_name, tensors);
+
+    for (bool memory_mapped : {false, true}) {
+        std::unordered_map<std::string, core::Tensor> loaded =
+                core::Tensor::LoadNpz(file_name, memory_mapped);
+        EXPECT_EQ(loaded.size(), tensors.size());
+        for (const auto &kv : tensors) {
+            ASSERT_EQ(loaded.count(kv.first), 1u);
+            const core::Tensor &t = loaded.at(kv.first);
+            EXPECT_EQ(t.GetDtype(), kv.second.GetDtype());
+            EXPECT_EQ(t.GetShape(), kv.second.GetShape());
+            EXPECT_TRUE(t.To(device).AllClose(kv.second));
+        }
+    }
+
+    // Loaded tensors outlive the tensor map and the mapping.
+    core::Tensor points = core::Tensor::LoadNpz(file_name, true).at("points");
+    EXPECT_EQ(points.Slice(1, 1, 3).ToFlatVector<float>(),
+              std::vector<float>({1, 2, 4, 5}));
+
+    EXPECT_ANY_THROW(core::Tensor::LoadNpz("does_not_exist.npz"));
+    EXPECT_ANY_THROW(core::Tensor::LoadMemoryMapped(file_name));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(TensorPermuteDevices, VectorizedFastPath) {
+    core::Device device = GetParam();
+
+    // Large enough to be split across threads.
+    int64_t n = 200003;
+    std::vector<float> vals_a(n);
+    std::vector<float> vals_b(n);
+    for (int64_t i = 0; i < n; ++i) {
+        vals_a[i] = static_cast<float>(i % 97) - 48.5f;
+        vals_b[i] = static_cast<float>(i % 13) + 1.0f;
+    }
+    core::Tensor a(vals_a, {n}, core::Dtype::Float32, device);
+    core::Tensor b(vals_b, {n}, core::Dtype::Float32, device);
+
+    // A non-contiguous view of the same values goes through the generic code
+    // path and serves as the reference.
+    core::Tensor a_padded =
+            core::Tensor::Zeros({n, 2}, core::Dtype::Float32, device);
+    a_padded.Slice(1, 0, 1) = a.Reshape({n, 1});
+    core::Tensor a_sliced = a_padded.Slice(1, 0, 1).Reshape({n});
+    ASSERT_FALSE(a_sliced.IsContiguous());
+
+    core::Tensor ref_add = a_sliced + b;
+    core::Tensor ref_sub = a_sliced - b;
+    core::Tensor ref_mul_scalar = a_sliced * 3.f;
+    core::Tensor ref_neg = a_sliced.Neg();
+    core::Tensor ref_abs = a_sliced.Abs();
+    core::Tensor ref_floor = (a_sliced / b).Floor();
+    int64_t ref_sum_int = a_sliced.Floor()
+                                  .To(core::Dtype::Int64)
+                                  .Sum({0})
+                                  .ToFlatVector<int64_t>()[0];
+    float ref_sum = a_sliced.Sum({0}).ToFlatVector<float>()[0];
+
+    core::kernel::CPUVectorISA supported_isa =
+            core::kernel::GetSupportedCPUVectorISA();
+    std::vector<core::kernel::CPUVectorISA> isas = {
+            core::kernel::CPUVectorISA::None, core::kernel::CPUVectorISA::AVX2,
+            core::kernel::CPUVectorISA::AVX512};
+    for (core::kernel::CPUVectorISA isa : isas) {
+        core::kernel::SetCPUVectorISA(isa);
+        EXPECT_LE(static_cast<int>(core::kernel::GetCPUVectorISA()),
+                  static_cast<int>(supported_isa));
+
+        EXPECT_TRUE((a + b).AllClose(ref_add));
+        EXPECT_TRUE((a * 3.f).AllClose(ref_mul_scalar));
+        EXPECT_TRUE(a.Neg().AllClose(ref_neg));
+        EXPECT_TRUE(a.Abs().AllClose(ref_abs));
+        EXPECT_TRUE((a / b).Floor().AllClose(ref_floor));
+
+        core::Tensor c = a.Clone();
+        c.Sub_(b);
+        EXPECT_TRUE(c.AllClose(ref_sub));
+
+        // Integer reductions are exact regardless of the reduction order.
+        EXPECT_EQ(a.Floor()
+                          .To(core::Dtype::Int64)
+                          .Sum({0})
+                          .ToFlatVector<int64_t>()[0],
+                  ref_sum_int);
+        EXPECT_EQ(a.Max({0}).ToFlatVector<float>()[0], 47.5f);
+        EXPECT_EQ(a.Min({0}).ToFlatVector<float>()[0], -48.5f);
+        EXPECT_NEAR(a.Sum({0}).ToFlatVector<float>()[0], ref_sum, 1.f);
+    }
+    core::kernel::SetCPUVectorISA(supported_isa);
+}
+
+TEST_P(TensorPermuteDevices, HalfPrecisionDtypes) {
+    core::Device device = GetParam();
+
+    // Conversions from float round to nearest even.
+    EXPECT_EQ(core::Float16(1.0f).bits_, 0x3c00);
+    EXPECT_EQ(core::Float16(-2.0f).bits_, 0xc000);
+    EXPECT_EQ(core::Float16(65504.0f).bits_, 0x7bff);
+    EXPECT_EQ(core::Float16(1e6f).bits_, 0x7c00);
+    EXPECT_EQ(static_cast<float>(core::Float16(1.0f + 1.0f / 2048)), 1.0f);
+    EXPECT_EQ(static_cast<float>(core::Float16(1.0f + 3.0f / 2048)),
+              1.0f + 4.0f / 2048);
+    EXPECT_EQ(static_cast<float>(core::Float16(5.960464477539063e-08f)),
+              5.960464477539063e-08f);
+    EXPECT_TRUE(std::isnan(static_cast<float>(
+            core::Float16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(core::BFloat16(1.0f).bits_, 0x3f80);
+    EXPECT_EQ(static_cast<float>(core::BFloat16(3.140625f)), 3.140625f);
+    EXPECT_EQ(static_cast<float>(core::BFloat16(1.0f + 1.0f / 256)), 1.0f);
+    EXPECT_TRUE(std::isnan(static_cast<float>(
+            core::BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+    EXPECT_EQ(core::Dtype::Float16.ByteSize(), 2);
+    EXPECT_EQ(core::Dtype::BFloat16.ByteSize(), 2);
+    EXPECT_EQ(core::Dtype::FromType<core::Float16>(), core::Dtype::Float16);
+    EXPECT_EQ(core::Dtype::FromType<core::BFloat16>(), core::Dtype::BFloat16);
+
+    for (const core::Dtype &dtype :
+         {core::Dtype::Float16, core::Dtype::BFloat16}) {
+        core::Tensor a = core::Tensor::Init<float>({{1, -2.5, 3}, {4, 5, -6}},
+                                                   device)
+                                 .To(dtype);
+        core::Tensor b = core::Tensor::Init<float>({{0.5, 2, 2}, {8, 1, 4}},
+                                                   device)
+                                 .To(dtype);
+        EXPECT_EQ(a.GetDtype(), dtype);
+        EXPECT_EQ((a + b).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({1.5, -0.5, 5, 12, 6, -2}));
+        EXPECT_EQ((a * b).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({0.5, -5, 6, 32, 5, -24}));
+        EXPECT_EQ((a / b).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({2, -1.25, 1.5, 0.5, 5, -1.5}));
+        EXPECT_EQ(a.Abs().To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({1, 2.5, 3, 4, 5, 6}));
+        EXPECT_EQ(a.Max({1}).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({3, 5}));
+        EXPECT_EQ(a.Min({0}).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({1, -2.5, -6}));
+        EXPECT_EQ(a.ArgMax({1}).ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({2, 1}));
+        EXPECT_EQ(a.Lt(b).ToFlatVector<bool>(),
+                  std::vector<bool>({false, true, false, true, false, true}));
+        EXPECT_EQ((a + 1.f).To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({2, -1.5, 4, 5, 6, -5}));
+
+        // Reductions accumulate in float. Accumulating 4096 ones in Float16
+        // would get stuck at 2048.
+        core::Tensor ones = core::Tensor::Ones({4096}, dtype, device);
+        EXPECT_EQ(ones.Sum({0}).To(core::Dtype::Float32).Item<float>(),
+                  4096.f);
+        EXPECT_EQ(ones.Reshape({64, 64})
+                          .Sum({0})
+                          .To(core::Dtype::Float32)
+                          .ToFlatVector<float>(),
+                  std::vector<float>(64, 64.f));
+    }
+
+    // Float16 round trip through NumPy's "<f2" format.
+    const std::string file_name = "tensor_float16.npy";
+    core::Tensor t = core::Tensor::Init<float>({{1, 2.5}, {-3, 65504}}, device)
+                             .To(core::Dtype::Float16);
+    t.Save(file_name);
+    core::Tensor t_load = core::Tensor::Load(file_name);
+    EXPECT_EQ(t_load.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(t_load.To(core::Dtype::Float32).ToFlatVector<float>(),
+              std::vector<float>({1, 2.5, -3, 65504}));
+    utility::filesystem::RemoveFile(file_name);
+
+    // DLPack round trip.
+    for (const core::Dtype &dtype :
+         {core::Dtype::Float16, core::Dtype::BFloat16}) {
+        core::Tensor src_t =
+                core::Tensor::Init<float>({1, 2, 3}, device).To(dtype);
+        core::Tensor dst_t = core::Tensor::FromDLPack(src_t.ToDLPack());
+        EXPECT_EQ(dst_t.GetDtype(), dtype);
+        EXPECT_EQ(dst_t.To(core::Dtype::Float32).ToFlatVector<float>(),
+                  std::vector<float>({1, 2, 3}));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, MulAddSqrt) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor c = core::Tensor::Init<float>({1, 2, 3}, device);
+
+    core::Tensor d = core::TensorExpr(a).Mul(b).Add(c).Sqrt().Eval();
+    core::Tensor d_ref = a.Mul(b).Add(c).Sqrt();
+    EXPECT_EQ(d.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_TRUE(d.AllClose(d_ref));
+}
+
+TEST_P(TensorExprPermuteDevices, ScalarOperands) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<int32_t>({0, 1, 2, 3}, device);
+
+    core::Tensor b = ((core::TensorExpr(a) * 3 + a) - 1).Neg().Eval();
+    EXPECT_EQ(b.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, -3, -7, -11}));
+
+    core::Tensor c = core::TensorExpr(a).Div(2).Eval();
+    EXPECT_EQ(c.ToFlatVector<int32_t>(), std::vector<int32_t>({0, 0, 1, 1}));
+}
+
+TEST_P(TensorExprPermuteDevices, SharedSubExpression) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<double>({1, 2, 3}, device);
+
+    core::TensorExpr a_plus_one = core::TensorExpr(a).Add(1.0);
+    core::Tensor b = a_plus_one.Mul(a_plus_one).Eval();
+    EXPECT_EQ(b.ToFlatVector<double>(), std::vector<double>({4, 9, 16}));
+}
+
+TEST_P(TensorExprPermuteDevices, EvalInPlace) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    core::Tensor b = core::Tensor::Init<float>({10, 20}, device);
+
+    // Broadcasted operand and output aliasing an input.
+    core::TensorExpr(a).Mul(a).Add(b).Eval(a);
+    EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({11, 24, 19, 36}));
+}
+
+TEST_P(TensorExprPermuteDevices, NonContiguous) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+
+    core::Tensor b = core::TensorExpr(a.T()).Sub(a.T()).Abs().Eval();
+    EXPECT_EQ(b.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(b.ToFlatVector<float>(), std::vector<float>(6, 0));
+
+    core::Tensor c = core::TensorExpr(a.T()).Mul(2.f).Eval();
+    EXPECT_TRUE(c.AllClose(a.T().Mul(2.f)));
+}
+
+TEST_P(TensorExprPermuteDevices, LargeTensor) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Ones({1000, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Full({1000, 3}, 2.f, core::Dtype::Float32,
+                                        device);
+
+    core::Tensor c = core::TensorExpr(a).Add(b).Mul(b).Eval();
+    EXPECT_TRUE(c.AllClose(core::Tensor::Full({1000, 3}, 6.f,
+                                              core::Dtype::Float32, device)));
+}
+
+TEST_P(TensorExprPermuteDevices, Exceptions) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({3, 2}, core::Dtype::Float32, device);
+    core::Tensor c = core::Tensor::Ones({2, 3}, core::Dtype::Int32, device);
+
+    // Shape and dtype mismatch.
+    EXPECT_ANY_THROW(core::TensorExpr(a).Add(b));
+    EXPECT_ANY_THROW(core::TensorExpr(a).Add(c));
+
+    // Float-only ops.
+    EXPECT_ANY_THROW(core::TensorExpr(c).Sqrt().Eval());
+
+    // Output shape mismatch.
+    EXPECT_ANY_THROW(core::TensorExpr(a).Add(1.f).Eval(b));
+}
+
+}  // namespace tests
+}  // namespace open3d
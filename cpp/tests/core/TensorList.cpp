@@ -393,6 +393,159 @@ TEST_P(TensorListPermuteDevices, Concatenate) {
     EXPECT_FALSE(tl3.AsTensor().Slice(0, 3, 4).IsSame(tl0.AsTensor()));  // Copy
 }
 
+TEST_P(TensorListPermuteDevices, AppendEmpty) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl({3}, dtype, device);
+    core::Tensor slot = tl.AppendEmpty(2);
+    EXPECT_EQ(slot.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(tl.GetSize(), 2);
+    EXPECT_EQ(tl.GetReservedSize(), 4);
+
+    // The slot shares memory with the tensorlist.
+    slot.Fill(1);
+    EXPECT_TRUE(tl.AsTensor().AllClose(
+            core::Tensor::Ones({2, 3}, dtype, device)));
+
+    tl.AppendEmpty(3).Fill(2);
+    EXPECT_EQ(tl.GetSize(), 5);
+    EXPECT_EQ(tl.GetReservedSize(), 16);
+    EXPECT_TRUE(tl[1].AllClose(core::Tensor::Ones({3}, dtype, device)));
+    EXPECT_TRUE(tl[4].AllClose(core::Tensor::Full({3}, 2, dtype, device)));
+
+    EXPECT_EQ(tl.AppendEmpty(0).GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(tl.GetSize(), 5);
+    EXPECT_ANY_THROW(tl.AppendEmpty(-1));
+
+    // Inplace TensorList does not support append.
+    core::TensorList tl_inplace = core::TensorList::FromTensor(
+            core::Tensor::Ones({3, 3}, dtype, device), true);
+    EXPECT_ANY_THROW(tl_inplace.AppendEmpty(1));
+}
+
+TEST_P(TensorListPermuteDevices, Chunked) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl = core::TensorList::Chunked({2}, dtype, device, 4);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetChunks().size(), 0);
+
+    // Elements are never moved by later appends.
+    core::Tensor slot0 = tl.AppendEmpty(3);
+    slot0.Fill(0);
+    core::Tensor slot1 = tl.AppendEmpty(2);
+    slot1.Fill(1);
+    core::Tensor slot2 = tl.AppendEmpty(6);
+    slot2.Fill(2);
+    tl.PushBack(core::Tensor::Full({2}, 3, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 12);
+    EXPECT_EQ(tl.GetChunks().size(), 4);
+    EXPECT_TRUE(slot0.IsSame(tl.GetChunks()[0]));
+    EXPECT_TRUE(slot2.IsSame(tl.GetChunks()[2]));
+
+    std::vector<float> expected = {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+                                   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3};
+    EXPECT_EQ(tl.AsTensor().ToFlatVector<float>(), expected);
+    for (int64_t i = 0; i < tl.GetSize(); ++i) {
+        EXPECT_EQ(tl[i].ToFlatVector<float>()[0], expected[i * 2]);
+    }
+    EXPECT_TRUE(tl[-1].AllClose(core::Tensor::Full({2}, 3, dtype, device)));
+    EXPECT_ANY_THROW(tl[12]);
+
+    // Extending a chunked tensorlist by itself.
+    tl.Extend(tl);
+    EXPECT_EQ(tl.GetSize(), 24);
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 12, 24).AllClose(
+            tl.AsTensor().Slice(0, 0, 12)));
+
+    // Shrinking into a previous chunk.
+    tl.Resize(4);
+    EXPECT_EQ(tl.GetChunks().size(), 2);
+    EXPECT_EQ(tl.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1}));
+    tl.Resize(6);
+    EXPECT_EQ(tl.AsTensor().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0}));
+
+    // After MakeContiguous, AsTensor shares memory again.
+    tl.MakeContiguous();
+    EXPECT_EQ(tl.GetChunks().size(), 1);
+    EXPECT_TRUE(tl.AsTensor().IsSame(tl.AsTensor()));
+    EXPECT_EQ(tl.GetSize(), 6);
+
+    core::TensorList tl_clone = tl.Clone();
+    tl_clone[0].Fill(5);
+    EXPECT_TRUE(tl[0].AllClose(core::Tensor::Zeros({2}, dtype, device)));
+
+    tl.Clear();
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_ANY_THROW(core::TensorList::Chunked({2}, dtype, device, 0));
+}
+
+TEST_P(TensorListPermuteDevices, Concat) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor t0 = core::Tensor::Zeros({1, 2, 3}, dtype, device);
+    core::Tensor t1 = core::Tensor::Ones({3, 2, 3}, dtype, device);
+    core::TensorList tl0 = core::TensorList::FromTensor(t0);
+    core::TensorList tl1 = core::TensorList::FromTensor(t1, true);
+    core::TensorList tl2({2, 3}, dtype, device);
+
+    // No copy is made.
+    core::TensorList tl = core::TensorList::Concat({tl0, tl2, tl1, tl0});
+    EXPECT_EQ(tl.GetSize(), 5);
+    EXPECT_TRUE(tl.IsChunked());
+    EXPECT_EQ(tl.GetChunks().size(), 3);
+    EXPECT_TRUE(tl.GetChunks()[1].IsSame(t1));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 1, 4).AllClose(t1));
+    EXPECT_TRUE(tl[4].AllClose(t0[0]));
+
+    // Appending does not write to the memory of the inputs.
+    core::Tensor base = core::Tensor::Full({4, 2, 3}, 7, dtype, device);
+    tl = core::TensorList::Concat(
+            {core::TensorList::FromTensor(base.Slice(0, 0, 2), true)});
+    tl.PushBack(core::Tensor::Full({2, 3}, 2, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 3);
+    EXPECT_TRUE(base.AllClose(core::Tensor::Full({4, 2, 3}, 7, dtype, device)));
+    tl[0].Fill(1);
+    EXPECT_TRUE(base[0].AllClose(core::Tensor::Ones({2, 3}, dtype, device)));
+
+    // Neither does appending after shrinking into an input.
+    core::Tensor t2 = core::Tensor::Full({2, 2, 3}, 2, dtype, device);
+    tl = core::TensorList::Concat({core::TensorList::FromTensor(t1, true),
+                                   core::TensorList::FromTensor(t2, true)});
+    tl.Resize(2);
+    tl.PushBack(core::Tensor::Full({2, 3}, 5, dtype, device));
+    tl.AppendEmpty(3).Fill(6);
+    EXPECT_EQ(tl.GetSize(), 6);
+    EXPECT_TRUE(t1.AllClose(core::Tensor::Ones({3, 2, 3}, dtype, device)));
+    EXPECT_TRUE(t2.AllClose(core::Tensor::Full({2, 2, 3}, 2, dtype, device)));
+    EXPECT_TRUE(tl[1].AllClose(core::Tensor::Ones({2, 3}, dtype, device)));
+    EXPECT_TRUE(tl[2].AllClose(core::Tensor::Full({2, 3}, 5, dtype, device)));
+    EXPECT_TRUE(tl[5].AllClose(core::Tensor::Full({2, 3}, 6, dtype, device)));
+
+    // Nor after shrinking again within the kept part of an input.
+    core::Tensor t3 = core::Tensor::Full({4, 2, 3}, 3, dtype, device);
+    tl = core::TensorList::Concat({core::TensorList::FromTensor(t3, true)});
+    tl.Resize(2);
+    tl.Resize(1);
+    tl.PushBack(core::Tensor::Full({2, 3}, 5, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 2);
+    EXPECT_TRUE(t3.AllClose(core::Tensor::Full({4, 2, 3}, 3, dtype, device)));
+    EXPECT_TRUE(tl[1].AllClose(core::Tensor::Full({2, 3}, 5, dtype, device)));
+
+    EXPECT_ANY_THROW(core::TensorList::Concat({}));
+    EXPECT_ANY_THROW(core::TensorList::Concat(
+            {tl0, core::TensorList({3}, dtype, device)}));
+    EXPECT_ANY_THROW(core::TensorList::Concat(
+            {tl0, core::TensorList({2, 3}, core::Dtype::Int32, device)}));
+}
+
 TEST_P(TensorListPermuteDevices, SquareBracketsOperator) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -33,6 +33,8 @@
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/t/geometry/VoxelBlockStore.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -107,5 +109,412 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     EXPECT_NEAR(result.fitness_, 1.0, 1e-5);
     EXPECT_NEAR(result.inlier_rmse_, 0, 1e-5);
 }
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCast) {
+    core::Device device = GetParam();
+
+    // Fronto-parallel plane at 1m, fused from a few identical frames.
+    const int width = 640, height = 480;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.01f, 0.04f, 16, 1000, device);
+    core::Tensor intrinsics(
+            std::vector<float>{525, 0, 319.5, 0, 525, 239.5, 0, 0, 1}, {3, 3},
+            core::Dtype::Float32);
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0"));
+    t::geometry::Image depth(core::Tensor::Full(
+            {height, width, 1}, 1000, core::Dtype::UInt16, device));
+    core::Tensor color_t =
+            core::Tensor::Zeros({height, width, 3}, core::Dtype::UInt8, device);
+    color_t.Slice(2, 0, 1).Fill(255);
+    color_t.Slice(2, 1, 2).Fill(51);
+    t::geometry::Image color(color_t);
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+
+    using Mask = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    auto result = voxel_grid.RayCast(
+            intrinsics, extrinsics, width, height, 1000.0f, 0.1f, 3.0f, 3.0f,
+            Mask::VertexMap | Mask::DepthMap | Mask::ColorMap |
+                    Mask::NormalMap);
+    EXPECT_EQ(result.size(), 4);
+    EXPECT_EQ(result.at(Mask::DepthMap).GetShape(),
+              core::SizeVector({height, width, 1}));
+
+    core::Device host("CPU:0");
+    core::Tensor depth_map = result.at(Mask::DepthMap).To(host);
+    core::Tensor vertex_map = result.at(Mask::VertexMap).To(host);
+    core::Tensor normal_map = result.at(Mask::NormalMap).To(host);
+    core::Tensor color_map = result.at(Mask::ColorMap).To(host);
+
+    // Pixels away from the image border, whose cells are fully observed.
+    for (int v = 40; v < height - 40; v += 20) {
+        for (int u = 40; u < width - 40; u += 20) {
+            EXPECT_NEAR(depth_map[v][u][0].Item<float>(), 1000.0f, 2.0f);
+            EXPECT_NEAR(vertex_map[v][u][2].Item<float>(), 1.0f, 2e-3f);
+            EXPECT_NEAR(vertex_map[v][u][0].Item<float>(),
+                        (u - 319.5f) / 525.0f, 2e-3f);
+            EXPECT_NEAR(normal_map[v][u][2].Item<float>(), -1.0f, 1e-3f);
+            EXPECT_NEAR(color_map[v][u][0].Item<float>(), 1.0f, 1e-2f);
+            EXPECT_NEAR(color_map[v][u][1].Item<float>(), 0.2f, 1e-2f);
+            EXPECT_NEAR(color_map[v][u][2].Item<float>(), 0.0f, 1e-2f);
+        }
+    }
+
+    // Rays beyond the plane miss.
+    auto far = voxel_grid.RayCast(intrinsics, extrinsics, width, height,
+                                  1000.0f, 0.1f, 0.5f);
+    EXPECT_EQ(far.at(Mask::DepthMap).Sum({0, 1, 2}).Item<float>(), 0.0f);
+
+    // Blocks activated after a ray cast are looked up by the next one: a
+    // plane at 0.6m, too far in front to update the first one, hides it.
+    t::geometry::Image near_depth(core::Tensor::Full(
+            {height, width, 1}, 600, core::Dtype::UInt16, device));
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(near_depth, color, intrinsics, extrinsics);
+    }
+    core::Tensor near_depth_map =
+            voxel_grid.RayCast(intrinsics, extrinsics, width, height)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    EXPECT_NEAR(near_depth_map[240][320][0].Item<float>(), 600.0f, 2.0f);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, CompactVoxels) {
+    core::Device device = GetParam();
+    core::Device host("CPU:0");
+
+    // Fronto-parallel plane at 1m, observed with +-5mm of alternating noise.
+    const int width = 640, height = 480;
+    core::Tensor intrinsics(
+            std::vector<float>{525, 0, 319.5, 0, 525, 239.5, 0, 0, 1}, {3, 3},
+            core::Dtype::Float32);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32, host);
+    core::Tensor color_t =
+            core::Tensor::Zeros({height, width, 3}, core::Dtype::UInt8, device);
+    color_t.Slice(2, 0, 1).Fill(255);
+    color_t.Slice(2, 1, 2).Fill(51);
+    t::geometry::Image color(color_t);
+
+    using Mask = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    auto Fuse = [&](const std::unordered_map<std::string, core::Dtype>
+                            &attr_dtype_map) {
+        t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, 0.01f, 0.04f,
+                                              16, 1000, device);
+        for (int i = 0; i < 6; ++i) {
+            t::geometry::Image depth(
+                    core::Tensor::Full({height, width, 1}, i % 2 ? 1005 : 995,
+                                       core::Dtype::UInt16, device));
+            if (attr_dtype_map.count("color") != 0) {
+                voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+            } else {
+                voxel_grid.Integrate(depth, intrinsics, extrinsics);
+            }
+        }
+        return voxel_grid;
+    };
+
+    t::geometry::TSDFVoxelGrid reference =
+            Fuse({{"tsdf", core::Dtype::Float32},
+                  {"weight", core::Dtype::UInt16},
+                  {"color", core::Dtype::UInt16}});
+    int64_t num_triangles =
+            reference.ExtractSurfaceMesh().GetTriangles().GetLength();
+
+    std::vector<std::unordered_map<std::string, core::Dtype>> layouts = {
+            {{"tsdf", core::Dtype::UInt16}, {"weight", core::Dtype::UInt16}},
+            {{"tsdf", core::Dtype::UInt8}, {"weight", core::Dtype::UInt8}},
+            {{"tsdf", core::Dtype::UInt16},
+             {"weight", core::Dtype::UInt8},
+             {"color", core::Dtype::UInt8}}};
+    for (const auto &layout : layouts) {
+        t::geometry::TSDFVoxelGrid voxel_grid = Fuse(layout);
+        EXPECT_EQ(voxel_grid.ExtractSurfaceMesh().GetTriangles().GetLength(),
+                  num_triangles);
+
+        bool has_color = layout.count("color") != 0;
+        auto result = voxel_grid.RayCast(
+                intrinsics, extrinsics, width, height, 1000.0f, 0.1f, 3.0f,
+                3.0f, Mask::DepthMap | (has_color ? Mask::ColorMap : 0));
+        core::Tensor depth_map = result.at(Mask::DepthMap).To(host);
+        for (int v = 40; v < height - 40; v += 20) {
+            for (int u = 40; u < width - 40; u += 20) {
+                EXPECT_NEAR(depth_map[v][u][0].Item<float>(), 1000.0f, 2.0f);
+            }
+        }
+        if (has_color) {
+            core::Tensor color_map = result.at(Mask::ColorMap).To(host);
+            EXPECT_NEAR(color_map[240][320][0].Item<float>(), 1.0f, 1e-2f);
+            EXPECT_NEAR(color_map[240][320][1].Item<float>(), 0.2f, 1e-2f);
+            EXPECT_NEAR(color_map[240][320][2].Item<float>(), 0.0f, 1e-2f);
+        }
+    }
+
+    // Same byte size as the packed colored voxel, but not a known layout.
+    EXPECT_ANY_THROW(t::geometry::TSDFVoxelGrid(
+            {{"tsdf", core::Dtype::Float32}, {"weight", core::Dtype::UInt16}},
+            0.01f, 0.04f, 16, 1000, device));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, IntegrateIncremental) {
+    core::Device device = GetParam();
+
+    // Fronto-parallel plane at 1m, seen by a camera moving sideways 2cm
+    // every other frame.
+    const int width = 640, height = 480;
+    auto CreateGrid = [&]() {
+        return t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.01f, 0.04f, 16, 1000, device);
+    };
+    t::geometry::TSDFVoxelGrid voxel_grid = CreateGrid();
+    t::geometry::TSDFVoxelGrid incremental_grid = CreateGrid();
+    incremental_grid.SetIncrementalIntegration(true);
+
+    core::Device host("CPU:0");
+    core::Tensor intrinsics(
+            std::vector<float>{525, 0, 319.5, 0, 525, 239.5, 0, 0, 1}, {3, 3},
+            core::Dtype::Float32);
+    t::geometry::Image depth(core::Tensor::Full(
+            {height, width, 1}, 1000, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Zeros(
+            {height, width, 3}, core::Dtype::UInt8, device));
+    for (int i = 0; i < 8; ++i) {
+        core::Tensor extrinsics =
+                core::Tensor::Eye(4, core::Dtype::Float32, host);
+        extrinsics[0][3] = -0.02f * (i / 2);
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+        incremental_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+
+    // Both grids render the same surface.
+    using Mask = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Dtype::Float32, host);
+    core::Tensor depth_map =
+            voxel_grid.RayCast(intrinsics, extrinsics, width, height)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    core::Tensor incremental_depth_map =
+            incremental_grid.RayCast(intrinsics, extrinsics, width, height)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    for (int v = 40; v < height - 40; v += 20) {
+        for (int u = 40; u < width - 40; u += 20) {
+            EXPECT_NEAR(depth_map[v][u][0].Item<float>(), 1000.0f, 1.0f);
+            EXPECT_NEAR(incremental_depth_map[v][u][0].Item<float>(),
+                        depth_map[v][u][0].Item<float>(), 1.0f);
+        }
+    }
+
+    // The blocks of the plane are behind the truncation band of a closer
+    // surface, hence culled and left unchanged.
+    t::geometry::Image near_depth(core::Tensor::Full(
+            {height, width, 1}, 500, core::Dtype::UInt16, device));
+    incremental_grid.Integrate(near_depth, color, intrinsics, extrinsics);
+    core::Tensor occluded_depth_map =
+            incremental_grid
+                    .RayCast(intrinsics, extrinsics, width, height, 1000.0f,
+                             0.6f)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    for (int v = 40; v < height - 40; v += 20) {
+        for (int u = 40; u < width - 40; u += 20) {
+            EXPECT_NEAR(occluded_depth_map[v][u][0].Item<float>(),
+                        incremental_depth_map[v][u][0].Item<float>(), 1e-3f);
+        }
+    }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractSurfaceMeshPatches) {
+    core::Device device = GetParam();
+
+    // Fronto-parallel plane at 1m.
+    const int width = 640, height = 480;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.01f, 0.04f, 16, 1000, device);
+    core::Tensor intrinsics(
+            std::vector<float>{525, 0, 319.5, 0, 525, 239.5, 0, 0, 1}, {3, 3},
+            core::Dtype::Float32);
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0"));
+    t::geometry::Image depth(core::Tensor::Full(
+            {height, width, 1}, 1000, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Zeros(
+            {height, width, 3}, core::Dtype::UInt8, device));
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+    }
+
+    // The stitched patches match the full extraction.
+    core::Device host("CPU:0");
+    auto ExpectStitchedMeshEqual = [&]() {
+        t::geometry::TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+        t::geometry::TriangleMesh stitched =
+                voxel_grid.StitchSurfaceMeshPatches();
+        EXPECT_EQ(stitched.GetVertices().GetLength(),
+                  mesh.GetVertices().GetLength());
+        EXPECT_EQ(stitched.GetTriangles().GetLength(),
+                  mesh.GetTriangles().GetLength());
+        EXPECT_TRUE(stitched.GetVertices()
+                            .Sum({0})
+                            .AllClose(mesh.GetVertices().Sum({0}), 1e-4, 1e-2));
+        EXPECT_TRUE(stitched.HasVertexColors());
+        // Each triangle connects three distinct vertices.
+        core::Tensor triangles = stitched.GetTriangles().To(host);
+        for (int64_t i = 0; i < triangles.GetLength(); i += 97) {
+            int64_t a = triangles[i][0].Item<int64_t>();
+            int64_t b = triangles[i][1].Item<int64_t>();
+            int64_t c = triangles[i][2].Item<int64_t>();
+            EXPECT_TRUE(a != b && b != c && a != c);
+        }
+    };
+
+    auto patches = voxel_grid.ExtractSurfaceMeshPatches();
+    size_t num_patches = patches.size();
+    EXPECT_GT(num_patches, 0);
+    const float block_size = 0.01f * 16;
+    for (const auto &it : patches) {
+        // Vertices lie in the block or on the edges of its far faces.
+        core::Tensor vertices = it.second.GetVertices().To(host);
+        core::Tensor origin = core::Tensor(
+                std::vector<float>{it.first(0) * block_size,
+                                   it.first(1) * block_size,
+                                   it.first(2) * block_size},
+                {1, 3}, core::Dtype::Float32, host);
+        core::Tensor local = vertices - origin;
+        EXPECT_GE(local.Min({0, 1}).Item<float>(), 0.0f);
+        EXPECT_LE(local.Max({0, 1}).Item<float>(), block_size);
+        EXPECT_LT(it.second.GetTriangles().Max({0, 1}).Item<int64_t>(),
+                  vertices.GetLength());
+    }
+    ExpectStitchedMeshEqual();
+
+    // Nothing changed.
+    EXPECT_EQ(voxel_grid.ExtractSurfaceMeshPatches().size(), 0);
+
+    // A small surface in front of the plane only updates the blocks around
+    // it.
+    core::Tensor near_depth_t = core::Tensor::Zeros(
+            {height, width, 1}, core::Dtype::UInt16, device);
+    near_depth_t.Slice(0, 220, 260).Slice(1, 300, 340).Fill(500);
+    t::geometry::Image near_depth(near_depth_t);
+    for (int i = 0; i < 5; ++i) {
+        voxel_grid.Integrate(near_depth, color, intrinsics, extrinsics);
+    }
+    patches = voxel_grid.ExtractSurfaceMeshPatches();
+    EXPECT_GT(patches.size(), 0);
+    EXPECT_LT(patches.size(), num_patches);
+    ExpectStitchedMeshEqual();
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, Streaming) {
+    core::Device device = GetParam();
+
+    // Declared before the grids, whose stores must be closed before the
+    // directory is removed.
+    TemporaryDirectory directory("tsdf_streaming_test");
+
+    // A camera sweeps 6m sideways along a fronto-parallel plane at 1m.
+    const int width = 640, height = 480;
+    auto CreateGrid = [&]() {
+        return t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.01f, 0.04f, 16, 1000, device);
+    };
+    t::geometry::TSDFVoxelGrid voxel_grid = CreateGrid();
+    t::geometry::TSDFVoxelGrid streamed_grid = CreateGrid();
+    streamed_grid.EnableStreaming(directory.GetPath(), 1.5f);
+
+    core::Device host("CPU:0");
+    core::Tensor intrinsics(
+            std::vector<float>{525, 0, 319.5, 0, 525, 239.5, 0, 0, 1}, {3, 3},
+            core::Dtype::Float32);
+    t::geometry::Image depth(core::Tensor::Full(
+            {height, width, 1}, 1000, core::Dtype::UInt16, device));
+    t::geometry::Image color(core::Tensor::Zeros(
+            {height, width, 3}, core::Dtype::UInt8, device));
+    auto Integrate = [&](float x) {
+        core::Tensor extrinsics =
+                core::Tensor::Eye(4, core::Dtype::Float32, host);
+        extrinsics[0][3] = -x;
+        voxel_grid.Integrate(depth, color, intrinsics, extrinsics);
+        streamed_grid.Integrate(depth, color, intrinsics, extrinsics);
+        return extrinsics;
+    };
+    for (int i = 0; i <= 60; ++i) {
+        Integrate(0.1f * i);
+    }
+
+    // Only the blocks around the camera are resident.
+    EXPECT_GT(streamed_grid.GetNumStoredBlocks(), 0);
+    EXPECT_LT(streamed_grid.ExtractSurfaceMesh(0).GetTriangles().GetLength(),
+              voxel_grid.ExtractSurfaceMesh(0).GetTriangles().GetLength());
+
+    // Revisited blocks are paged back in.
+    core::Tensor extrinsics = Integrate(0.0f);
+    using Mask = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    core::Tensor depth_map =
+            voxel_grid.RayCast(intrinsics, extrinsics, width, height)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    core::Tensor streamed_depth_map =
+            streamed_grid.RayCast(intrinsics, extrinsics, width, height)
+                    .at(Mask::DepthMap)
+                    .To(host);
+    EXPECT_TRUE(streamed_depth_map.AllClose(depth_map));
+
+    streamed_grid.DisableStreaming();
+    EXPECT_EQ(streamed_grid.GetNumStoredBlocks(), 0);
+    EXPECT_EQ(streamed_grid.ExtractSurfaceMesh(0).GetTriangles().GetLength(),
+              voxel_grid.ExtractSurfaceMesh(0).GetTriangles().GetLength());
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(directory.GetPath(), filenames);
+    EXPECT_TRUE(filenames.empty());
+}
+
+TEST(TSDFVoxelGrid, VoxelBlockStoreFailedRead) {
+    TemporaryDirectory directory("voxel_block_store_test");
+    t::geometry::VoxelBlockStore store(directory.GetPath(), 4);
+
+    core::Device host("CPU:0");
+    Eigen::Vector3i cell(1, -2, 0);
+    core::Tensor keys(std::vector<int>{4, -8, 0, 5, -7, 1}, {2, 3},
+                      core::Dtype::Int32, host);
+    core::Tensor values =
+            core::Tensor::Ones({2, 8}, core::Dtype::Float32, host);
+    store.Write(cell, keys, values);
+    store.Flush();
+
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(directory.GetPath(), filenames);
+    ASSERT_EQ(filenames.size(), 1);
+    FILE *file = utility::filesystem::FOpen(filenames[0], "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("not an npz file", file);
+    fclose(file);
+
+    // A failed read keeps the cell.
+    EXPECT_ANY_THROW(store.Read(cell));
+    EXPECT_TRUE(store.Contains(cell));
+    EXPECT_EQ(store.GetNumBlocks(), 2);
+
+    core::Tensor::SaveNpz(filenames[0], {{"keys", keys}, {"values", values}});
+    core::Tensor read_keys, read_values;
+    std::tie(read_keys, read_values) = store.Read(cell);
+    EXPECT_TRUE(read_keys.AllClose(keys));
+    EXPECT_TRUE(read_values.AllClose(values));
+    EXPECT_FALSE(store.Contains(cell));
+    store.Flush();
+    filenames.clear();
+    utility::filesystem::ListFilesInDirectory(directory.GetPath(), filenames);
+    EXPECT_TRUE(filenames.empty());
+}
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "tests/test_utility/TemporaryDirectory.h"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace tests {
+
+TemporaryDirectory::TemporaryDirectory(const std::string &prefix) {
+    std::string root = "/tmp";
+    for (const char *name : {"TMPDIR", "TEMP", "TMP"}) {
+        if (const char *value = std::getenv(name)) {
+            root = value;
+            break;
+        }
+    }
+    std::random_device random;
+    do {
+        path_ = utility::filesystem::GetRegularizedDirectoryName(root) +
+                prefix + "_" + std::to_string(random());
+    } while (utility::filesystem::DirectoryExists(path_));
+    utility::filesystem::MakeDirectoryHierarchy(path_);
+}
+
+TemporaryDirectory::~TemporaryDirectory() {
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(path_, filenames);
+    for (const std::string &filename : filenames) {
+        utility::filesystem::RemoveFile(filename);
+    }
+    utility::filesystem::DeleteDirectory(path_);
+}
+
+std::string TemporaryDirectory::GetFilePath(
+        const std::string &file_name) const {
+    return utility::filesystem::GetRegularizedDirectoryName(path_) + file_name;
+}
+
+}  // namespace tests
+}  // namespace open3d
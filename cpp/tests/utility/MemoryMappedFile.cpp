@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/MemoryMappedFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(MemoryMappedFile, ReadAndPrivateWrite) {
+    const std::string file_name = "memory_mapped_file.bin";
+    const std::string content = "Open3D memory mapped file";
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    ASSERT_NE(fp, nullptr);
+    fwrite(content.data(), 1, content.size(), fp);
+    fclose(fp);
+
+    {
+        utility::MemoryMappedFile file(file_name);
+        EXPECT_EQ(file.GetSize(), static_cast<int64_t>(content.size()));
+        EXPECT_EQ(std::string(file.GetDataPtr(), file.GetSize()), content);
+
+        // Copy-on-write: the file on disk is not modified.
+        file.GetDataPtr()[0] = 'X';
+        EXPECT_EQ(file.GetDataPtr()[0], 'X');
+    }
+    utility::MemoryMappedFile file(file_name);
+    EXPECT_EQ(std::string(file.GetDataPtr(), file.GetSize()), content);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(MemoryMappedFile, EmptyFile) {
+    const std::string file_name = "memory_mapped_file_empty.bin";
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    ASSERT_NE(fp, nullptr);
+    fclose(fp);
+
+    utility::MemoryMappedFile file(file_name);
+    EXPECT_EQ(file.GetSize(), 0);
+    EXPECT_EQ(file.GetDataPtr(), nullptr);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(MemoryMappedFile, MissingFile) {
+    EXPECT_ANY_THROW(utility::MemoryMappedFile("does_not_exist.bin"));
+}
+
+}  // namespace tests
+}  // namespace open3d
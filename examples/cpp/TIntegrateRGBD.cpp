@@ -43,6 +43,7 @@ void PrintHelp() {
     utility::LogInfo("     --max_depth [=3.0]");
     utility::LogInfo("     --sdf_trunc [=0.04]");
     utility::LogInfo("     --device [CPU:0]");
+    utility::LogInfo("     --compact (6-byte voxels)");
     utility::LogInfo("     --mesh");
     utility::LogInfo("     --pointcloud");
     // clang-format on
@@ -119,11 +120,17 @@ int main(int argc, char** argv) {
     }
     core::Device device(device_code);
     utility::LogInfo("Using device: {}", device.ToString());
-    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
-                                           {"weight", core::Dtype::UInt16},
-                                           {"color", core::Dtype::UInt16}},
-                                          voxel_size, sdf_trunc, 16,
-                                          block_count, device);
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map = {
+            {"tsdf", core::Dtype::Float32},
+            {"weight", core::Dtype::UInt16},
+            {"color", core::Dtype::UInt16}};
+    if (utility::ProgramOptionExists(argc, argv, "--compact")) {
+        attr_dtype_map = {{"tsdf", core::Dtype::UInt16},
+                          {"weight", core::Dtype::UInt8},
+                          {"color", core::Dtype::UInt8}};
+    }
+    t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size,
+                                          sdf_trunc, 16, block_count, device);
 
     for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
         // Load image